@@ -0,0 +1,222 @@
+// ini_bench - measures loading FPCameraSettle.ini.
+//
+// Times SettingsIni::Parse (the schema-specialized loader Settings uses) on the
+// INI text in memory and through MappedFile from disk, and, where SimpleIni is
+// available, the CSimpleIni path it replaced: LoadData plus one Get*Value call
+// per schema key, with the same clamps. Both loaders must produce the same
+// SettingsData. Inputs are the shipped INI, the INI with its sections copied
+// into many named profiles (sections the plain parse skips but CSimpleIni still
+// indexes; the time to load every profile is reported separately), and the INI
+// repeated end to end (every key parsed many times, last value wins).
+//
+// Usage: ini_bench [ini path] [copies]
+
+#include "Core/MappedFile.h"
+#include "Core/SettingsIni.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(FPCS_HAVE_SIMPLEINI)
+#	include <SimpleIni.h>
+#endif
+
+namespace
+{
+	using namespace SettleCore;
+
+	using Clock = std::chrono::steady_clock;
+
+	std::string ReadFile(const std::filesystem::path& a_path)
+	{
+		std::ifstream file(a_path, std::ios::binary);
+		return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+	}
+
+	// Every section again as [Profile<n>.<section>], a_copies times
+	std::string MakeProfiles(const std::string& a_ini, int a_copies)
+	{
+		std::string scaled = a_ini;
+		for (int copy = 0; copy < a_copies; ++copy) {
+			std::istringstream lines(a_ini);
+			std::string line;
+			while (std::getline(lines, line)) {
+				if (!line.empty() && line[0] == '[') {
+					scaled += "[" + std::string(SettingsIni::kProfilePrefix) + "P" + std::to_string(copy) + "." + line.substr(1) + "\n";
+				} else {
+					scaled += line + "\n";
+				}
+			}
+		}
+		return scaled;
+	}
+
+	std::string MakeRepeated(const std::string& a_ini, int a_copies)
+	{
+		std::string scaled;
+		for (int copy = 0; copy <= a_copies; ++copy) {
+			scaled += a_ini;
+			scaled += "\n";
+		}
+		return scaled;
+	}
+
+	// Runs a_load until about 200 ms have passed; returns microseconds per load
+	template <class Load>
+	double Time(Load a_load)
+	{
+		int iterations = 0;
+		const auto start = Clock::now();
+		auto elapsed = Clock::duration::zero();
+		do {
+			a_load();
+			++iterations;
+			elapsed = Clock::now() - start;
+		} while (elapsed < std::chrono::milliseconds(200));
+		return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+	}
+
+	bool SameSettings(const SettingsData& a_lhs, const SettingsData& a_rhs)
+	{
+		return SettingsIni::DiffSections(a_lhs, a_rhs) == 0;
+	}
+
+#if defined(FPCS_HAVE_SIMPLEINI)
+	void LoadKeys(CSimpleIniA& a_ini, const char* a_section, std::span<const SettingsIni::Key> a_keys, void* a_base)
+	{
+		auto* base = static_cast<std::uint8_t*>(a_base);
+		for (const auto& key : a_keys) {
+			const bool clamped = key.minValue < key.maxValue;
+			switch (key.type) {
+			case SettingsIni::Type::kBool:
+				{
+					auto& value = *reinterpret_cast<bool*>(base + key.offset);
+					value = a_ini.GetBoolValue(a_section, key.name, value);
+					break;
+				}
+			case SettingsIni::Type::kInt:
+				{
+					auto& value = *reinterpret_cast<int*>(base + key.offset);
+					value = static_cast<int>(a_ini.GetLongValue(a_section, key.name, value));
+					if (clamped) {
+						value = std::clamp(value, static_cast<int>(key.minValue), static_cast<int>(key.maxValue));
+					}
+					break;
+				}
+			case SettingsIni::Type::kFloat:
+				{
+					auto& value = *reinterpret_cast<float*>(base + key.offset);
+					value = static_cast<float>(a_ini.GetDoubleValue(a_section, key.name, value));
+					if (clamped) {
+						value = std::clamp(value, key.minValue, key.maxValue);
+					}
+					break;
+				}
+			}
+		}
+	}
+
+	// The loader Settings used before SettingsIni: parse into CSimpleIni, then look up every key
+	void LoadSimpleIni(const std::string& a_text, SettingsData& a_data)
+	{
+		CSimpleIniA ini;
+		ini.SetUnicode();
+		ini.LoadData(a_text.data(), a_text.size());
+		for (const auto& group : SettingsIni::GlobalGroups()) {
+			LoadKeys(ini, group.section, group.keys, &a_data);
+		}
+		for (int state = 0; state < 2; ++state) {
+			for (int action = 0; action < SettingsIni::kActionCount; ++action) {
+				const std::string section = std::string(SettingsIni::ActionName(static_cast<ActionType>(action))) + SettingsIni::StateSuffix(state);
+				LoadKeys(ini, section.c_str(), SettingsIni::ActionKeys(), &a_data.actionSettings[state][action]);
+			}
+		}
+	}
+#endif
+
+	bool Run(const char* a_name, const std::string& a_text)
+	{
+		const auto path = std::filesystem::temp_directory_path() / "ini_bench.ini";
+		{
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(a_text.data(), static_cast<std::streamsize>(a_text.size()));
+		}
+
+		SettingsData parsed;
+		const double parseUs = Time([&] {
+			parsed = SettingsData{};
+			SettingsIni::Parse(a_text, parsed);
+		});
+
+		SettingsData mapped;
+		const double mappedUs = Time([&] {
+			mapped = SettingsData{};
+			MappedFile file;
+			if (file.Open(path)) {
+				SettingsIni::Parse(file.View(), mapped);
+			}
+		});
+
+		std::error_code removeError;
+		std::filesystem::remove(path, removeError);
+
+		const double kib = static_cast<double>(a_text.size()) / 1024.0;
+		std::printf("  %-14s %8.1f KiB  parse %9.1f us  mmap+parse %9.1f us", a_name, kib, parseUs, mappedUs);
+
+		bool same = SameSettings(parsed, mapped);
+#if defined(FPCS_HAVE_SIMPLEINI)
+		SettingsData reference;
+		const double simpleUs = Time([&] {
+			reference = SettingsData{};
+			LoadSimpleIni(a_text, reference);
+		});
+		same = same && SameSettings(parsed, reference);
+		std::printf("  CSimpleIni %9.1f us (%.1fx)", simpleUs, simpleUs / parseUs);
+#endif
+		// What Settings does on load when the INI defines profiles: one more pass for all of them
+		std::vector<SettingsIni::Profile> profiles;
+		const double profilesUs = Time([&] {
+			profiles = SettingsIni::ParseProfiles(a_text, parsed);
+		});
+		if (!profiles.empty()) {
+			// The profile copies repeat the plain sections, so each must equal the base
+			same = same && std::ranges::all_of(profiles, [&](const SettingsIni::Profile& a_profile) { return SameSettings(a_profile.data, parsed); });
+			std::printf("  %zu profiles %9.1f us", profiles.size(), profilesUs);
+		}
+		std::printf("  %s\n", same ? "match" : "MISMATCH");
+		return same;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const std::filesystem::path iniPath = argc > 1 ? std::filesystem::path(argv[1]) : std::filesystem::path(FPCS_SOURCE_DIR) / "FPCameraSettle.ini";
+	const int copies = std::max(argc > 2 ? std::atoi(argv[2]) : 64, 1);
+
+	const std::string ini = ReadFile(iniPath);
+	if (ini.empty()) {
+		std::printf("ini_bench: cannot read %s\n", iniPath.string().c_str());
+		return 1;
+	}
+
+#if defined(FPCS_HAVE_SIMPLEINI)
+	std::printf("ini_bench: %s, %d copies\n", iniPath.string().c_str(), copies);
+#else
+	std::printf("ini_bench: %s, %d copies (SimpleIni not found, CSimpleIni comparison skipped)\n", iniPath.string().c_str(), copies);
+#endif
+
+	bool ok = Run("shipped", ini);
+	ok = Run("profiles", MakeProfiles(ini, copies)) && ok;
+	ok = Run("repeated", MakeRepeated(ini, copies)) && ok;
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,561 @@
+// settle_bench - measures the per-frame cost of the portable settle core.
+//
+// Runs the same work CameraSettleManager::Update does for its five spring
+// layers (blend update + spring integration), plus idle noise and the FOV
+// punch curve, at fixed 60/144/240 Hz deltas and reports ns/frame.
+// Springs are integrated per layer (UpdateSpring) and through the SoA
+// SpringBank with every kernel the CPU supports, plus the closed-form,
+// implicit Euler and Verlet integrators, and Euler with per-layer automatic
+// sub-steps (bank/auto). The idle rows show the cost of a
+// standing-still frame with and without the quiescent-frame gating. A final
+// check shows how far each integrator drifts between 30 fps and 240 fps for
+// the same impulse, with and without the 240 Hz fixed-timestep clock, and
+// whether it stays stable on a very stiff spring at one step per frame (and
+// Euler and Verlet with automatic sub-steps). The detect row times movement
+// detection on a scripted stream of player state snapshots, as Update feeds
+// DetectActions.
+// The classify rows time routing and classifying a stream of action pairs
+// (spring layer, walk gait, opposite directions) through the ActionTraits
+// table and through the comparison chains it replaced, and check they agree.
+//
+// Usage: settle_bench [frames] [substeps]
+
+#include "Core/ActionTraits.h"
+#include "Core/ClosedFormCache.h"
+#include "Core/FixedStep.h"
+#include "Core/PlayerState.h"
+#include "Core/SettleCore.h"
+#include "Core/SpringBank.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+	using namespace SettleCore;
+
+	constexpr int kMovement = kMovementLayer;
+	constexpr int kJump = kJumpLayer;
+	constexpr int kSneak = kSneakLayer;
+	constexpr int kHit = kHitLayer;
+	constexpr int kArchery = kArcheryLayer;
+	constexpr int kLayerCount = kSpringLayerCount;
+
+	// How springs are integrated: per layer (the pre-bank path) or through SpringBank
+	struct Solver
+	{
+		const char* name;
+		bool useBank;
+		SpringKernel kernel;
+		SpringIntegrator integrator;
+		bool idle;   // No impulses and idle noise off (player standing still)
+		bool gated;  // Skip dormant layers/noise/punch like CameraSettleManager::Update
+		bool autoSubsteps{ false };  // Euler/Verlet sub-steps per layer from its stability bound (substeps is the cap)
+	};
+
+	// Action whose cache slot each layer uses for the closed-form integrator
+	constexpr ActionType LAYER_ACTIONS[kLayerCount] = {
+		ActionType::WalkForward,
+		ActionType::Jump,
+		ActionType::Sneak,
+		ActionType::TakingHit,
+		ActionType::ArrowRelease
+	};
+
+	// Defaults matching Settings::InitializeDefaults for the action that drives each layer
+	ActionSettings MakeSettings(float a_stiffness, float a_damping, float a_posStrength, float a_rotStrength, float a_blendTime,
+		float a_x, float a_y, float a_z, float a_rx, float a_ry, float a_rz)
+	{
+		ActionSettings s;
+		s.Stiffness() = a_stiffness;
+		s.Damping() = a_damping;
+		s.PositionStrength() = a_posStrength;
+		s.RotationStrength() = a_rotStrength;
+		s.BlendTime() = a_blendTime;
+		s.ImpulseX() = a_x;
+		s.ImpulseY() = a_y;
+		s.ImpulseZ() = a_z;
+		s.RotImpulseX() = a_rx;
+		s.RotImpulseY() = a_ry;
+		s.RotImpulseZ() = a_rz;
+		return s;
+	}
+
+	struct BenchState
+	{
+		ActionSettings settings[kLayerCount];
+		SpringState springs[kLayerCount];
+		PendingBlend blends[kLayerCount];
+		SpringBank bank;
+		ClosedFormCache closedFormCache;
+		Vec3 springTotalPos;
+		Vec3 springTotalRot;
+		float noisePhase{ 0.0f };
+		float noiseAmplitude{ 0.0f };
+		Vec3 noisePos;
+		Vec3 noiseRot;
+		float punchTimer{ 1.0f };
+		float punchValue{ 0.0f };
+		float settlingFactor{ 0.0f };
+		float timeSinceAction{ 0.0f };
+	};
+
+	void InitState(BenchState& a_state)
+	{
+		a_state.settings[kMovement] = MakeSettings(100.0f, 7.0f, 4.0f, 2.5f, 0.08f, 0.0f, 3.0f, 1.0f, 1.0f, 0.0f, 0.0f);
+		a_state.settings[kJump] = MakeSettings(40.0f, 3.0f, 6.0f, 3.0f, 0.1f, 0.0f, 4.0f, 8.0f, -2.0f, 0.0f, 0.0f);
+		a_state.settings[kSneak] = MakeSettings(50.0f, 8.0f, 4.0f, 2.0f, 0.1f, 0.0f, 1.0f, -5.0f, 2.0f, 0.0f, 0.0f);
+		a_state.settings[kHit] = MakeSettings(150.0f, 12.0f, 12.0f, 8.0f, 0.1f, 0.0f, -5.0f, -3.0f, 5.0f, 0.0f, 3.0f);
+		a_state.settings[kArchery] = MakeSettings(150.0f, 10.0f, 5.0f, 4.0f, 0.0f, 0.0f, -3.0f, 2.0f, -3.0f, 0.0f, 0.0f);
+
+		// Stability bounds at the full settle damping, as Settings::RefreshStepBounds does
+		for (auto& settings : a_state.settings) {
+			settings.maxStableStep = GetMaxStableStep(settings.Stiffness(), settings.Damping() * 2.0f);
+		}
+	}
+
+	void GetLayerSubsteps(const BenchState& a_state, const Solver& a_solver, float a_delta, int a_substeps, int (&a_out)[kLayerCount])
+	{
+		for (int i = 0; i < kLayerCount; ++i) {
+			a_out[i] = a_solver.autoSubsteps ?
+			               GetAutoSubstepCount(a_delta, a_state.settings[i].maxStableStep, a_substeps) :
+			               GetSubstepCount(a_delta, a_substeps);
+		}
+	}
+
+	// One frame of the Update() physics path
+	void StepFrame(BenchState& a_state, const Solver& a_solver, float a_delta, int a_substeps, int a_frame, int a_impulseInterval)
+	{
+		// Re-fire an impulse on one layer periodically so springs stay active
+		if (!a_solver.idle && a_frame % a_impulseInterval == 0) {
+			int layer = (a_frame / a_impulseInterval) % kLayerCount;
+			ApplyImpulse(a_state.springs[layer], a_state.blends[layer], a_state.settings[layer], 1.0f);
+			a_state.timeSinceAction = 0.0f;
+			if (layer == kHit) {
+				a_state.punchTimer = 0.0f;
+			}
+		}
+
+		// Settling factor (Settings defaults: delay 0.1s, speed 3, damping mult 2)
+		a_state.timeSinceAction += a_delta;
+		a_state.settlingFactor = a_state.timeSinceAction > 0.1f ? std::min(1.0f, (a_state.timeSinceAction - 0.1f) * 3.0f) : 0.0f;
+		float dampingMult = 1.0f + a_state.settlingFactor * (2.0f - 1.0f);
+
+		// Quiescent gating: only layers with a pending blend or non-zero state need work
+		std::uint32_t springMask = Activity::kSpringLayers;
+		if (a_solver.gated) {
+			springMask = 0;
+			for (int i = 0; i < kLayerCount; ++i) {
+				if (a_state.blends[i].IsActive() || !a_state.springs[i].IsAtRest()) {
+					springMask |= Activity::Layer(i);
+				}
+			}
+		}
+
+		if (springMask == 0) {
+			// Dormant: bank totals are already zero
+		} else if (a_solver.useBank) {
+			for (int i = 0; i < kLayerCount; ++i) {
+				UpdateBlend(a_state.springs[i], a_state.blends[i], a_delta);
+			}
+			const bool euler = a_solver.integrator == SpringIntegrator::Euler;
+			int layerSubsteps[kLayerCount];
+			GetLayerSubsteps(a_state, a_solver, a_delta, a_substeps, layerSubsteps);
+			for (int i = 0; i < kLayerCount; ++i) {
+				a_state.bank.Load(i, a_state.springs[i], a_state.settings[i], dampingMult);
+				if (a_solver.integrator == SpringIntegrator::ClosedForm) {
+					int slot = ClosedFormCache::Slot(LAYER_ACTIONS[i], false);
+					a_state.bank.SetTransition(i, a_state.closedFormCache.Get(slot, a_state.settings[i], 0, a_delta, dampingMult));
+				} else if (!euler) {
+					// Verlet is sub-stepped like Euler, as SpringRig::Step does
+					const ActionSettings& settings = a_state.settings[i];
+					const int steps = a_solver.integrator == SpringIntegrator::Verlet ? layerSubsteps[i] : 1;
+					a_state.bank.SetTransition(i, ComputeStepTransition(a_solver.integrator, settings.Stiffness(), settings.Damping() * dampingMult, a_delta, steps));
+				}
+			}
+			if (euler) {
+				a_state.bank.Integrate(a_delta, layerSubsteps);
+			} else {
+				a_state.bank.IntegrateClosedForm();
+			}
+			if (a_solver.gated) {
+				a_state.bank.SettleLayers(1e-8f);
+			}
+			for (int i = 0; i < kLayerCount; ++i) {
+				a_state.bank.Store(i, a_state.springs[i]);
+			}
+			a_state.springTotalPos = a_state.bank.TotalPosition();
+			a_state.springTotalRot = a_state.bank.TotalRotation();
+		} else {
+			for (int i = 0; i < kLayerCount; ++i) {
+				UpdateBlend(a_state.springs[i], a_state.blends[i], a_delta);
+			}
+			for (int i = 0; i < kLayerCount; ++i) {
+				UpdateSpring(a_state.springs[i], a_state.settings[i], a_delta, dampingMult, a_substeps);
+			}
+
+			// Per-layer sum, as ApplyCameraOffset did before the bank
+			Vec3 pos;
+			Vec3 rot;
+			for (const auto& spring : a_state.springs) {
+				pos.x += spring.positionOffset.x;
+				pos.y += spring.positionOffset.y;
+				pos.z += spring.positionOffset.z;
+				rot.x += spring.rotationOffset.x;
+				rot.y += spring.rotationOffset.y;
+				rot.z += spring.rotationOffset.z;
+			}
+			a_state.springTotalPos = pos;
+			a_state.springTotalRot = rot;
+		}
+
+		// Idle noise (sheathed defaults); the phase always advances
+		a_state.noisePhase = AdvanceNoisePhase(a_state.noisePhase, a_delta, 0.25f);
+		const bool noiseEnabled = !a_solver.idle;
+		if (a_solver.gated && !noiseEnabled && a_state.noiseAmplitude <= 0.0f) {
+			a_state.noisePos = {};
+			a_state.noiseRot = {};
+		} else {
+			a_state.noiseAmplitude = MoveTowards(a_state.noiseAmplitude, noiseEnabled ? 1.0f : 0.0f, 12.0f * a_delta);
+			EvaluateIdleNoise(a_state.noisePhase, { 0.0f, 0.0f, 0.03f }, { 0.15f, 0.0f, 0.08f }, a_state.noiseAmplitude,
+				a_state.noisePos, a_state.noiseRot);
+		}
+
+		// FOV punch
+		if (!a_solver.gated || a_state.punchTimer < 0.25f) {
+			a_state.punchTimer += a_delta;
+			a_state.punchValue = FovPunchCurve(a_state.punchTimer / 0.25f);
+		}
+	}
+
+	float SumOffsets(const BenchState& a_state)
+	{
+		const Vec3& pos = a_state.springTotalPos;
+		const Vec3& rot = a_state.springTotalRot;
+		return (pos.x + a_state.noisePos.x) + (pos.y + a_state.noisePos.y) + (pos.z + a_state.noisePos.z) +
+		       (rot.x + a_state.noiseRot.x) + (rot.y + a_state.noiseRot.y) + (rot.z + a_state.noiseRot.z) +
+		       a_state.punchValue;
+	}
+
+	double RunBench(const Solver& a_solver, float a_hz, int a_frames, int a_substeps, float& a_sink)
+	{
+		if (a_solver.useBank) {
+			SetSpringKernel(a_solver.kernel);
+		}
+
+		BenchState state;
+		InitState(state);
+
+		float delta = 1.0f / a_hz;
+		int impulseInterval = std::max(1, static_cast<int>(a_hz * 0.5f));  // One impulse every half second
+
+		// Warm up caches and branch predictors
+		for (int frame = 0; frame < 1000; ++frame) {
+			StepFrame(state, a_solver, delta, a_substeps, frame, impulseInterval);
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < a_frames; ++frame) {
+			StepFrame(state, a_solver, delta, a_substeps, frame, impulseInterval);
+			a_sink += SumOffsets(state);
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		double ns = std::chrono::duration<double, std::nano>(end - start).count();
+		return ns / static_cast<double>(a_frames);
+	}
+
+	// Position offset of the hit layer 0.2s after one impulse, rendered at a_hz.
+	// With a_fixedRate > 0 the spring runs on a FixedStepClock and the result is interpolated.
+	float ImpulseResponse(SpringIntegrator a_integrator, float a_hz, int a_substeps, int a_fixedRate)
+	{
+		BenchState state;
+		InitState(state);
+
+		ActionSettings settings = state.settings[kHit];
+		settings.BlendTime() = 0.0f;
+		PendingBlend blend;
+		SpringState spring;
+		ApplyImpulse(spring, blend, settings, 1.0f);
+
+		FixedStepClock clock;
+		float alpha = 1.0f;
+		float delta = 1.0f / a_hz;
+		int frames = static_cast<int>(0.2f * a_hz + 0.5f);
+		for (int frame = 0; frame < frames; ++frame) {
+			int numSteps = 1;
+			float stepDelta = delta;
+			if (a_fixedRate > 0) {
+				numSteps = clock.Advance(delta, a_fixedRate, 16);
+				stepDelta = clock.GetStepDelta();
+				alpha = clock.GetAlpha();
+			}
+
+			for (int step = 0; step < numSteps; ++step) {
+				state.bank.SavePrevious();
+				state.bank.Load(0, spring, settings, 1.0f);
+				if (a_integrator == SpringIntegrator::ClosedForm) {
+					state.bank.SetTransition(0, state.closedFormCache.Get(0, settings, 0, stepDelta, 1.0f));
+					state.bank.IntegrateClosedForm();
+				} else if (a_integrator != SpringIntegrator::Euler) {
+					const int steps = a_integrator == SpringIntegrator::Verlet ? GetSubstepCount(stepDelta, a_substeps) : 1;
+					state.bank.SetTransition(0, ComputeStepTransition(a_integrator, settings.Stiffness(), settings.Damping(), stepDelta, steps));
+					state.bank.IntegrateClosedForm();
+				} else {
+					state.bank.Integrate(stepDelta, a_substeps);
+				}
+				state.bank.Store(0, spring);
+			}
+		}
+		return state.bank.InterpolatedPosition(alpha).y;
+	}
+
+	// Movement detection over a_frames snapshots circling the input stick, switching gait every second;
+	// counts action changes into a_sink. Returns ns per frame.
+	double DetectBench(int a_frames, float& a_sink)
+	{
+		constexpr int STICK_STEPS = 240;
+		float stick[STICK_STEPS][2];
+		for (int step = 0; step < STICK_STEPS; ++step) {
+			const float angle = static_cast<float>(step) * (2.0f * PI / STICK_STEPS);
+			stick[step][0] = std::sin(angle);
+			stick[step][1] = std::cos(angle);
+		}
+
+		PlayerStateSnapshot state;
+		state.delta = 1.0f / 60.0f;
+		ActionType previous = ActionType::kTotal;
+		int changes = 0;
+
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < a_frames; ++frame) {
+			state.moveInputX = stick[frame % STICK_STEPS][0];
+			state.moveInputY = stick[frame % STICK_STEPS][1];
+			state.walking = (frame / 60) % 2 == 0;
+			state.sneaking = (frame / 180) % 3 == 2;
+			state.sprinting = (frame / 120) % 4 == 3;
+			const ActionType movement = DetectMovementAction(state);
+			changes += movement != previous;
+			previous = movement;
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		a_sink += static_cast<float>(changes);
+		return std::chrono::duration<double, std::nano>(end - start).count() / a_frames;
+	}
+
+	// The switch and comparison chains ActionTraits replaced, kept as the classify baseline
+	namespace Chains
+	{
+		int Layer(ActionType a_action)
+		{
+			switch (a_action) {
+			case ActionType::Jump:
+			case ActionType::Land:
+				return kJumpLayer;
+			case ActionType::Sneak:
+			case ActionType::UnSneak:
+				return kSneakLayer;
+			case ActionType::TakingHit:
+			case ActionType::Hitting:
+				return kHitLayer;
+			case ActionType::ArrowRelease:
+				return kArcheryLayer;
+			default:
+				return kMovementLayer;
+			}
+		}
+
+		bool IsWalk(ActionType a_action)
+		{
+			return a_action == ActionType::WalkForward || a_action == ActionType::WalkBackward ||
+			       a_action == ActionType::WalkLeft || a_action == ActionType::WalkRight ||
+			       a_action == ActionType::SneakWalkForward || a_action == ActionType::SneakWalkBackward ||
+			       a_action == ActionType::SneakWalkLeft || a_action == ActionType::SneakWalkRight;
+		}
+
+		bool AreOpposite(ActionType a_action1, ActionType a_action2)
+		{
+			auto is = [](ActionType a_action, ActionType a_walk, ActionType a_run, ActionType a_sneakWalk, ActionType a_sneakRun) {
+				return a_action == a_walk || a_action == a_run || a_action == a_sneakWalk || a_action == a_sneakRun;
+			};
+			using enum ActionType;
+			bool fwd1 = is(a_action1, WalkForward, RunForward, SneakWalkForward, SneakRunForward);
+			bool back1 = is(a_action1, WalkBackward, RunBackward, SneakWalkBackward, SneakRunBackward);
+			bool left1 = is(a_action1, WalkLeft, RunLeft, SneakWalkLeft, SneakRunLeft);
+			bool right1 = is(a_action1, WalkRight, RunRight, SneakWalkRight, SneakRunRight);
+			bool fwd2 = is(a_action2, WalkForward, RunForward, SneakWalkForward, SneakRunForward);
+			bool back2 = is(a_action2, WalkBackward, RunBackward, SneakWalkBackward, SneakRunBackward);
+			bool left2 = is(a_action2, WalkLeft, RunLeft, SneakWalkLeft, SneakRunLeft);
+			bool right2 = is(a_action2, WalkRight, RunRight, SneakWalkRight, SneakRunRight);
+			return (fwd1 && back2) || (back1 && fwd2) || (left1 && right2) || (right1 && left2);
+		}
+	}
+
+	// Routes and classifies a_frames (action, previous action) pairs from a scrambled stream covering every
+	// action and kTotal, as DetectActions/ApplyActionImpulse do; folds the results into a_sink.
+	// Returns ns per pair.
+	template <bool Table>
+	double ClassifyBench(int a_frames, std::uint32_t& a_sink)
+	{
+		constexpr int STREAM = 1024;
+		ActionType stream[STREAM];
+		std::uint32_t seed = 0x9E3779B9u;
+		for (auto& action : stream) {
+			seed = seed * 1664525u + 1013904223u;
+			action = static_cast<ActionType>((seed >> 16) % (static_cast<std::uint32_t>(ActionType::kTotal) + 1));
+		}
+
+		std::uint32_t hash = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < a_frames; ++frame) {
+			const ActionType action = stream[frame % STREAM];
+			const ActionType previous = stream[(frame + STREAM - 1) % STREAM];
+			int layer;
+			bool walk;
+			bool opposite;
+			if constexpr (Table) {
+				layer = GetActionTraits(action).layer;
+				walk = IsWalkAction(action);
+				opposite = AreOppositeDirections(action, previous);
+			} else {
+				layer = Chains::Layer(action);
+				walk = Chains::IsWalk(action);
+				opposite = Chains::AreOpposite(action, previous);
+			}
+			hash = hash * 31u + static_cast<std::uint32_t>(layer * 4 + walk * 2 + opposite);
+		}
+		auto end = std::chrono::steady_clock::now();
+
+		a_sink = hash;
+		return std::chrono::duration<double, std::nano>(end - start).count() / a_frames;
+	}
+
+	// Largest |offset| over 1s after an impulse on a very stiff spring (k=5000, c=20) at 30 fps, one
+	// step per frame or Euler/Verlet with automatic sub-steps up to a_autoSubstepCap. A stable spring
+	// stays well under 1; a blow-up runs into the 3.0 offset clamp.
+	float StiffPeak(SpringIntegrator a_integrator, int a_autoSubstepCap = 0)
+	{
+		ActionSettings settings = MakeSettings(5000.0f, 20.0f, 1.0f, 1.0f, 0.0f, 0.0f, -5.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+		PendingBlend blend;
+		SpringState spring;
+		ApplyImpulse(spring, blend, settings, 1.0f);
+
+		SpringBank bank;
+		ClosedFormCache cache;
+		constexpr float DELTA = 1.0f / 30.0f;
+		float peak = 0.0f;
+		const int steps = a_autoSubstepCap > 0 ? GetAutoSubstepCount(DELTA, GetMaxStableStep(settings.Stiffness(), settings.Damping()), a_autoSubstepCap) : 1;
+		for (int frame = 0; frame < 30; ++frame) {
+			bank.Load(0, spring, settings, 1.0f);
+			if (a_integrator == SpringIntegrator::Euler) {
+				const int layerSteps[SpringBank::kLayers] = { steps, 1, 1, 1, 1 };
+				bank.Integrate(DELTA, layerSteps);
+			} else {
+				bank.SetTransition(0, a_integrator == SpringIntegrator::ClosedForm ?
+					cache.Get(0, settings, 0, DELTA, 1.0f) :
+					ComputeStepTransition(a_integrator, settings.Stiffness(), settings.Damping(), DELTA, steps));
+				bank.IntegrateClosedForm();
+			}
+			bank.Store(0, spring);
+			peak = std::max(peak, std::abs(spring.positionOffset.y));
+		}
+		return peak;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	int frames = argc > 1 ? std::atoi(argv[1]) : 2000000;
+	int substeps = argc > 2 ? std::atoi(argv[2]) : 4;
+	frames = std::max(frames, 1);
+	substeps = std::clamp(substeps, 1, 8);
+
+	std::printf("settle_bench: %d frames, springSubsteps=%d, best kernel=%s\n", frames, substeps,
+		GetSpringKernelName(GetBestSpringKernel()));
+
+	const Solver solvers[] = {
+		{ "per-layer", false, SpringKernel::kScalar, SpringIntegrator::Euler, false, false },
+		{ "bank/Scalar", true, SpringKernel::kScalar, SpringIntegrator::Euler, false, false },
+		{ "bank/SSE", true, SpringKernel::kSSE, SpringIntegrator::Euler, false, false },
+		{ "bank/AVX", true, SpringKernel::kAVX, SpringIntegrator::Euler, false, false },
+		{ "bank/auto", true, GetBestSpringKernel(), SpringIntegrator::Euler, false, false, true },
+		{ "exact/Scalar", true, SpringKernel::kScalar, SpringIntegrator::ClosedForm, false, false },
+		{ "exact/best", true, GetBestSpringKernel(), SpringIntegrator::ClosedForm, false, false },
+		{ "implicit", true, GetBestSpringKernel(), SpringIntegrator::ImplicitEuler, false, false },
+		{ "verlet", true, GetBestSpringKernel(), SpringIntegrator::Verlet, false, false },
+		{ "idle/ungated", true, GetBestSpringKernel(), SpringIntegrator::Euler, true, false },
+		{ "idle/gated", true, GetBestSpringKernel(), SpringIntegrator::Euler, true, true },
+	};
+	constexpr float RATES[] = { 60.0f, 144.0f, 240.0f };
+
+	for (const auto& solver : solvers) {
+		if (solver.useBank && !IsSpringKernelSupported(solver.kernel)) {
+			std::printf("  %-12s (not supported on this CPU)\n", solver.name);
+			continue;
+		}
+
+		// Each solver gets its own sink so the checksums can be compared
+		float sink = 0.0f;
+		for (float hz : RATES) {
+			double nsPerFrame = RunBench(solver, hz, frames, substeps, sink);
+			std::printf("  %-12s %5.0f Hz (dt=%.4fs): %8.1f ns/frame\n", solver.name, hz, 1.0f / hz, nsPerFrame);
+		}
+
+		if (solver.autoSubsteps) {
+			BenchState state;
+			InitState(state);
+			for (float hz : RATES) {
+				int layerSubsteps[kLayerCount];
+				GetLayerSubsteps(state, solver, 1.0f / hz, substeps, layerSubsteps);
+				std::printf("  %-12s %5.0f Hz sub-steps per layer: %d %d %d %d %d (fixed: %d)\n", solver.name, hz, layerSubsteps[0],
+					layerSubsteps[1], layerSubsteps[2], layerSubsteps[3], layerSubsteps[4], GetSubstepCount(1.0f / hz, substeps));
+			}
+		}
+
+		// Print the sink so the optimizer cannot drop the work
+		std::printf("  %-12s checksum: %.9g\n", solver.name, static_cast<double>(sink));
+	}
+
+	float detectSink = 0.0f;
+	double detectNs = DetectBench(frames, detectSink);
+	std::printf("  %-12s %8.1f ns/frame (checksum %.0f)\n", "detect", detectNs, static_cast<double>(detectSink));
+
+	std::uint32_t chainSink = 0;
+	std::uint32_t tableSink = 0;
+	double chainNs = ClassifyBench<false>(frames, chainSink);
+	double tableNs = ClassifyBench<true>(frames, tableSink);
+	std::printf("  %-12s %8.2f ns/pair\n", "classify/chain", chainNs);
+	std::printf("  %-12s %8.2f ns/pair (%s)\n", "classify/table", tableNs, chainSink == tableSink ? "match" : "MISMATCH");
+
+	// Frame-rate consistency: the same hit impulse sampled 0.2s later at 30 and 240 fps
+	SetSpringKernel(GetBestSpringKernel());
+	const SpringIntegrator integrators[] = { SpringIntegrator::Euler, SpringIntegrator::ClosedForm, SpringIntegrator::ImplicitEuler, SpringIntegrator::Verlet };
+	const char* integratorNames[] = { "Euler", "closed-form", "implicit", "Verlet" };
+	for (int fixedRate : { 0, 240 }) {
+		for (int i = 0; i < 4; ++i) {
+			float at30 = ImpulseResponse(integrators[i], 30.0f, substeps, fixedRate);
+			float at240 = ImpulseResponse(integrators[i], 240.0f, substeps, fixedRate);
+			std::printf("  %-12s %-9s hit offset @0.2s: 30 fps=%.5f  240 fps=%.5f  (diff %.5f)\n",
+				integratorNames[i], fixedRate > 0 ? "fixed" : "variable", at30, at240, std::abs(at30 - at240));
+		}
+	}
+
+	// Stability at one step per frame (the closed form is the reference peak)
+	for (int i = 0; i < 4; ++i) {
+		float peak = StiffPeak(integrators[i]);
+		std::printf("  %-12s stiff spring @30 fps, 1 step: peak offset %.4g%s\n", integratorNames[i], peak,
+			peak < 1.0f ? "" : "  (unstable)");
+	}
+	// Euler and Verlet as SpringRig runs them, with automatic sub-steps
+	for (int i : { 0, 3 }) {
+		float autoPeak = StiffPeak(integrators[i], 8);
+		std::printf("  %-12s stiff spring @30 fps, auto (max 8): peak offset %.4g%s\n", integratorNames[i], autoPeak,
+			autoPeak < 1.0f ? "" : "  (unstable)");
+	}
+	return 0;
+}
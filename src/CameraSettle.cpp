@@ -7,32 +7,71 @@ namespace CameraSettle
 {
 	namespace
 	{
-		constexpr float PI = 3.14159265358979323846f;
-		constexpr float DEG_TO_RAD = PI / 180.0f;
-		constexpr float RAD_TO_DEG = 180.0f / PI;
+		// How often (in frames) the quiescent-frame share is logged
+		constexpr std::uint32_t ACTIVITY_LOG_INTERVAL = 600;
 		
-		RE::NiPoint3 ClampVector(const RE::NiPoint3& a_vec, float a_max)
+		// Settings for the movement layer while no movement action is active
+		constexpr ActionSettings COMMON_SETTINGS{};
+		
+		// Movement stop counter-impulse, relative to the start impulse
+		constexpr SettleCore::Vec3 STOP_POSITION_SCALE{ -0.5f, -0.5f, -0.3f };
+		constexpr SettleCore::Vec3 STOP_ROTATION_SCALE{ -0.5f, -0.5f, -0.5f };
+		
+		namespace Ini = SettleCore::SettingsIni;
+		
+		// INI sections the movement blend space is built from: every walk/run and sneak walk/run action
+		// in either weapon state, plus the multipliers it folds in
+		constexpr Ini::SectionMask BlendSpaceSections()
 		{
-			return {
-				std::clamp(a_vec.x, -a_max, a_max),
-				std::clamp(a_vec.y, -a_max, a_max),
-				std::clamp(a_vec.z, -a_max, a_max)
-			};
+			Ini::SectionMask sections = Ini::SectionBit(Ini::kGeneral) | Ini::SectionBit(Ini::kWeaponState);
+			for (int state = 0; state < 2; ++state) {
+				for (int action = 0; action < static_cast<int>(ActionType::kTotal); ++action) {
+					if (SettleCore::GetActionTraits(static_cast<ActionType>(action)).blendCardinal >= 0) {
+						sections |= Ini::ActionSectionBit(state, action);
+					}
+				}
+			}
+			return sections;
 		}
 		
-		RE::NiPoint3 LerpVector(const RE::NiPoint3& a_from, const RE::NiPoint3& a_to, float a_t)
+		// Weapon drawn/sheathed and sneak changes ease across the blend space over 1 / this seconds
+		constexpr float STATE_BLEND_SPEED = 4.0f;
+		
+		// Sections that differ between the snapshot in use and its replacement: the publisher's
+		// record when the replacement was made straight from it, otherwise (a profile switch, or
+		// several publishes between two frames) a diff of the two
+		Ini::SectionMask ChangedSections(const SettingsSnapshot* a_from, const SettingsSnapshot& a_to)
 		{
-			return {
-				a_from.x + (a_to.x - a_from.x) * a_t,
-				a_from.y + (a_to.y - a_from.y) * a_t,
-				a_from.z + (a_to.z - a_from.z) * a_t
-			};
+			if (!a_from) {
+				return Ini::kAllSections;
+			}
+			if (a_to.previousVersion == a_from->version) {
+				return a_to.changedSections;
+			}
+			return Ini::DiffSections(*a_from, a_to);
 		}
-
-		float SmoothStep(float a_t)
+		
+		// Bow/crossbow attack states that count as "drawing" (release itself excluded)
+		bool IsBowDrawState(RE::ATTACK_STATE_ENUM a_state)
 		{
-			a_t = std::clamp(a_t, 0.0f, 1.0f);
-			return a_t * a_t * (3.0f - 2.0f * a_t);
+			switch (a_state) {
+			case RE::ATTACK_STATE_ENUM::kBowDraw:
+			case RE::ATTACK_STATE_ENUM::kBowAttached:
+			case RE::ATTACK_STATE_ENUM::kBowDrawn:
+			case RE::ATTACK_STATE_ENUM::kBowReleasing:
+			case RE::ATTACK_STATE_ENUM::kBowNextAttack:
+			case RE::ATTACK_STATE_ENUM::kBowFollowThrough:
+				return true;
+			default:
+				return false;
+			}
+		}
+		
+		bool IsBowEquipped(RE::PlayerCharacter* a_player)
+		{
+			auto* weapon = a_player->GetEquippedObject(false);
+			auto* weap = weapon ? weapon->As<RE::TESObjectWEAP>() : nullptr;
+			return weap && (weap->IsBow() || weap->IsCrossbow());
 		}
 		
 		// Create rotation matrix from euler angles (pitch, yaw, roll order)
@@ -60,134 +99,140 @@ namespace CameraSettle
 		}
 	}
 	
-	void CameraSettleManager::ApplyImpulse(SpringState& a_state, PendingBlend& a_blend, const ActionSettings& a_settings, float a_multiplier, Settings* a_globalSettings)
+	void CameraSettleManager::ApplyImpulse(SpringState& a_state, PendingBlend& a_blend, const SettleCore::ResolvedImpulse& a_impulse, float a_scale, const SettingsData* a_globalSettings)
 	{
-		// Early out before any string operations
-		if (!a_settings.enabled || a_multiplier <= 0.0f || a_settings.multiplier <= 0.0f) {
-			// Only do debug work if debug is actually enabled
+		if (a_globalSettings->debugLogging && a_impulse.enabled && a_scale > 0.0f) {
+			logger::info("[FPCameraSettle] ApplyImpulse: enabled={}, totalMult={:.2f}, scale={:.2f}, blendTime={:.2f}",
+				a_impulse.enabled, a_impulse.multiplier, a_scale, a_impulse.blendTime);
+		}
+		
+		auto result = SettleCore::ApplyImpulse(a_state, a_blend, a_impulse, a_scale);
+		
+		// Only do debug work if debug is actually enabled
+		if (!a_globalSettings->debugLogging && !a_globalSettings->debugOnScreen) {
+			return;
+		}
+		
+		float totalMult = a_impulse.multiplier * a_scale;
+		switch (result) {
+		case SettleCore::ImpulseResult::kBlocked:
 			if (a_globalSettings->debugLogging) {
-				logger::info("[FPCameraSettle] ApplyImpulse: BLOCKED (enabled={}, globalMult={:.2f}, actionMult={:.2f})",
-					a_settings.enabled, a_multiplier, a_settings.multiplier);
+				logger::info("[FPCameraSettle] ApplyImpulse: BLOCKED (enabled={}, scale={:.2f})",
+					a_impulse.enabled, a_scale);
 			}
 			if (a_globalSettings->debugOnScreen) {
 				char buf[128];
-				snprintf(buf, sizeof(buf), "FPCam: BLOCKED mult=%.1fx%.1f", a_multiplier, a_settings.multiplier);
+				snprintf(buf, sizeof(buf), "FPCam: BLOCKED scale=%.1f", a_scale);
 				RE::DebugNotification(buf);
 			}
-			return;
-		}
-		
-		if (a_globalSettings->debugLogging) {
-			logger::info("[FPCameraSettle] ApplyImpulse: enabled={}, globalMult={:.2f}, actionMult={:.2f}, posStr={:.2f}",
-				a_settings.enabled, a_multiplier, a_settings.multiplier, a_settings.positionStrength);
-		}
-		
-		// Include per-action multiplier (0-10x range)
-		float totalMult = a_multiplier * a_settings.multiplier;
-		float posMult = a_settings.positionStrength * totalMult;
-		float rotMult = a_settings.rotationStrength * DEG_TO_RAD * totalMult;
-		
-		// Calculate target impulse
-		RE::NiPoint3 posImpulse = {
-			a_settings.impulseX * posMult,
-			a_settings.impulseY * posMult,
-			a_settings.impulseZ * posMult
-		};
-		
-		RE::NiPoint3 rotImpulse = {
-			a_settings.rotImpulseX * rotMult,
-			a_settings.rotImpulseY * rotMult,
-			a_settings.rotImpulseZ * rotMult
-		};
-		
-		// If blend time is 0 or very small, apply instantly
-		if (a_settings.blendTime < 0.001f) {
-			a_state.positionVelocity.x += posImpulse.x;
-			a_state.positionVelocity.y += posImpulse.y;
-			a_state.positionVelocity.z += posImpulse.z;
-			a_state.rotationVelocity.x += rotImpulse.x;
-			a_state.rotationVelocity.y += rotImpulse.y;
-			a_state.rotationVelocity.z += rotImpulse.z;
-			
+			break;
+		case SettleCore::ImpulseResult::kInstant:
 			if (a_globalSettings->debugLogging) {
 				logger::info("[FPCameraSettle] Impulse applied instantly: posVel=({:.2f},{:.2f},{:.2f}) totalMult={:.2f}",
 					a_state.positionVelocity.x, a_state.positionVelocity.y, a_state.positionVelocity.z, totalMult);
 			}
 			if (a_globalSettings->debugOnScreen) {
 				char buf[128];
-				snprintf(buf, sizeof(buf), "FPCam: impulse %.1fx%.1f=%.1f", a_multiplier, a_settings.multiplier, totalMult);
+				snprintf(buf, sizeof(buf), "FPCam: impulse %.1fx%.1f=%.1f", a_impulse.multiplier, a_scale, totalMult);
 				RE::DebugNotification(buf);
 			}
-		} else {
-			// Start a blend - add to any existing blend
-			if (a_blend.active) {
-				// Add remaining impulse from previous blend instantly
-				float remaining = 1.0f - a_blend.progress;
-				a_state.positionVelocity.x += a_blend.posImpulse.x * remaining;
-				a_state.positionVelocity.y += a_blend.posImpulse.y * remaining;
-				a_state.positionVelocity.z += a_blend.posImpulse.z * remaining;
-				a_state.rotationVelocity.x += a_blend.rotImpulse.x * remaining;
-				a_state.rotationVelocity.y += a_blend.rotImpulse.y * remaining;
-				a_state.rotationVelocity.z += a_blend.rotImpulse.z * remaining;
-			}
-			
-			// Set up new blend
-			a_blend.active = true;
-			a_blend.progress = 0.0f;
-			a_blend.duration = a_settings.blendTime;
-			a_blend.multiplier = totalMult;
-			a_blend.posImpulse = posImpulse;
-			a_blend.rotImpulse = rotImpulse;
-			
+			break;
+		case SettleCore::ImpulseResult::kBlended:
 			if (a_globalSettings->debugLogging) {
-				logger::info("[FPCameraSettle] Impulse blend started: duration={:.2f}s target=({:.2f},{:.2f},{:.2f}) totalMult={:.2f}",
-					a_settings.blendTime, posImpulse.x, posImpulse.y, posImpulse.z, totalMult);
+				const auto& blend = a_blend.Newest();
+				logger::info("[FPCameraSettle] Impulse blend started: duration={:.2f}s target=({:.2f},{:.2f},{:.2f}) totalMult={:.2f} (active blends: {})",
+					a_impulse.blendTime, blend.posImpulse.x, blend.posImpulse.y, blend.posImpulse.z, totalMult, a_blend.ActiveCount());
 			}
 			if (a_globalSettings->debugOnScreen) {
 				char buf[128];
-				snprintf(buf, sizeof(buf), "FPCam: blend %.1fx%.1f=%.1f (%.2fs)", a_multiplier, a_settings.multiplier, totalMult, a_settings.blendTime);
+				snprintf(buf, sizeof(buf), "FPCam: blend %.1fx%.1f=%.1f (%.2fs)", a_impulse.multiplier, a_scale, totalMult, a_impulse.blendTime);
 				RE::DebugNotification(buf);
 			}
+			break;
 		}
 	}
 	
-	void CameraSettleManager::UpdateBlend(SpringState& a_state, PendingBlend& a_blend, float a_delta)
+	const SettingsSnapshot* CameraSettleManager::AcquireSettings()
 	{
-		if (!a_blend.active || a_delta <= 0.0f) {
-			return;
+		// Only a pointer compare unless the menu, a reload or hot reload published new settings
+		auto* source = Settings::GetSingleton();
+		if (source->PeekSnapshot() != settingsSnapshot.get()) {
+			auto next = source->GetSnapshot();
+			const auto changed = ChangedSections(settingsSnapshot.get(), *next);
+			settingsSnapshot = std::move(next);
+			InvalidateSettingsCaches(changed);
+		}
+		return settingsSnapshot.get();
+	}
+	
+	void CameraSettleManager::InvalidateSettingsCaches(Ini::SectionMask a_changed)
+	{
+		// Impulses fold in globalIntensity ([General]) and the weapon state multipliers
+		if (a_changed & (Ini::SectionBit(Ini::kGeneral) | Ini::SectionBit(Ini::kWeaponState))) {
+			staleImpulses = Ini::kActionSections;
+		} else {
+			staleImpulses |= a_changed & Ini::kActionSections;
 		}
 		
-		// Calculate how much progress this frame
-		float prevProgress = a_blend.progress;
-		a_blend.progress += a_delta / a_blend.duration;
+		if (a_changed & BlendSpaceSections()) {
+			movementBlendSpace.Build(*settingsSnapshot);
+		}
 		
-		if (a_blend.progress >= 1.0f) {
-			// Blend complete - apply remaining impulse
-			float remaining = 1.0f - prevProgress;
-			a_state.positionVelocity.x += a_blend.posImpulse.x * remaining;
-			a_state.positionVelocity.y += a_blend.posImpulse.y * remaining;
-			a_state.positionVelocity.z += a_blend.posImpulse.z * remaining;
-			a_state.rotationVelocity.x += a_blend.rotImpulse.x * remaining;
-			a_state.rotationVelocity.y += a_blend.rotImpulse.y * remaining;
-			a_state.rotationVelocity.z += a_blend.rotImpulse.z * remaining;
-			
-			a_blend.Reset();
-		} else {
-			// Apply this frame's portion of the impulse
-			float deltaProgress = a_blend.progress - prevProgress;
-			a_state.positionVelocity.x += a_blend.posImpulse.x * deltaProgress;
-			a_state.positionVelocity.y += a_blend.posImpulse.y * deltaProgress;
-			a_state.positionVelocity.z += a_blend.posImpulse.z * deltaProgress;
-			a_state.rotationVelocity.x += a_blend.rotImpulse.x * deltaProgress;
-			a_state.rotationVelocity.y += a_blend.rotImpulse.y * deltaProgress;
-			a_state.rotationVelocity.z += a_blend.rotImpulse.z * deltaProgress;
+		// Built aside and swapped in whole; a sink still holding the old table keeps its tags alive
+		if (a_changed & Ini::SectionBit(Ini::kAnimationEvents)) {
+			animEventRouting.store(BuildAnimEventTable(*settingsSnapshot), std::memory_order_release);
+		}
+	}
+	
+	std::shared_ptr<const CameraSettleManager::AnimEventRouting> CameraSettleManager::BuildAnimEventTable(const SettingsData& a_settings)
+	{
+		// BSFixedString interns case-insensitively, so "ArrowRelease" in the INI is the built-in tag
+		auto routing = std::make_shared<AnimEventRouting>();
+		auto& [table, tags] = *routing;
+		tags.reserve(SettleCore::kBuiltInAnimEventCount + SettingsData::kMaxAnimEventBindings);
+		for (const auto& builtIn : SettleCore::kBuiltInAnimEvents) {
+			const auto& tag = tags.emplace_back(builtIn.tag);
+			table.Add(tag.data(), { builtIn.handler });
+		}
+		for (const auto& binding : a_settings.animEventBindings) {
+			if (binding.tag[0] == '\0') {
+				continue;
+			}
+			const auto& tag = tags.emplace_back(binding.tag);
+			if (!table.Add(tag.data(), { SettleCore::AnimEventHandler::kAction, binding.action })) {
+				logger::warn("[FPCameraSettle] [AnimationEvents] {} is already handled, ignoring its binding to {}", binding.tag, Settings::GetActionName(binding.action));
+			}
+		}
+		if (a_settings.debugLogging) {
+			logger::info("[FPCameraSettle] Animation event table: {} tags, max probe {}", table.Count(), table.MaxProbe());
+		}
+		return routing;
+	}
+	
+	const SettleCore::ResolvedImpulse& CameraSettleManager::GetImpulse(ActionType a_type, bool a_weaponDrawn)
+	{
+		const auto index = static_cast<unsigned>(a_type) < static_cast<unsigned>(ActionType::kTotal) ? static_cast<int>(a_type) : 0;
+		const int state = a_weaponDrawn ? SettingsData::kDrawn : SettingsData::kSheathed;
+		
+		// Resolved on first use after its section (or a multiplier it folds in) changed
+		const auto section = Ini::ActionSectionBit(state, index);
+		if (staleImpulses & section) {
+			impulseTable[state][index] = ResolveImpulse(static_cast<ActionType>(index), a_weaponDrawn, *settingsSnapshot);
+			staleImpulses &= ~section;
 		}
+		return impulseTable[state][index];
+	}
+	
+	SettleCore::ResolvedImpulse CameraSettleManager::ResolveImpulse(ActionType a_type, bool a_weaponDrawn, const SettingsData& a_settings)
+	{
+		const auto type = static_cast<unsigned>(a_type) < static_cast<unsigned>(ActionType::kTotal) ? a_type : ActionType::WalkForward;
+		float globalMult = a_settings.globalIntensity * (a_weaponDrawn ? a_settings.weaponDrawnMult : a_settings.weaponSheathedMult);
+		return SettleCore::ResolveImpulse(a_settings.GetActionSettingsForState(type, a_weaponDrawn), globalMult);
 	}
 
-	void CameraSettleManager::StartFovPunch(float a_strengthPercent)
+	void CameraSettleManager::StartFovPunch(float a_strengthPercent, const SettingsData* a_globalSettings)
 	{
-		auto* settings = Settings::GetSingleton();
-		if (!settings || a_strengthPercent <= 0.0f) {
+		if (!a_globalSettings || a_strengthPercent <= 0.0f) {
 			return;
 		}
 		
@@ -198,7 +243,7 @@ namespace CameraSettle
 		
 		fovPunchActive = true;
 		fovPunchTimer = 0.0f;
-		fovPunchDuration = std::max(settings->fovPunchDuration, 0.05f);
+		fovPunchDuration = std::max(a_globalSettings->fovPunchDuration, 0.05f);
 		fovPunchStrength = std::clamp(a_strengthPercent / 100.0f, 0.0f, 0.5f);
 		fovPunchValue = 0.0f;
 	}
@@ -243,7 +288,8 @@ namespace CameraSettle
 			return;
 		}
 		
-		auto* settings = Settings::GetSingleton();
+		const auto snapshot = Settings::GetSingleton()->GetSnapshot();  // Own reference: only Update swaps settingsSnapshot (see AcquireSettings)
+		const auto* settings = snapshot.get();
 		if (!settings || !settings->enabled) {
 			return;
 		}
@@ -258,614 +304,157 @@ namespace CameraSettle
 		}
 		
 		bool weaponDrawn = player->AsActorState()->IsWeaponDrawn();
-		float stateMult = weaponDrawn ? settings->weaponDrawnMult : settings->weaponSheathedMult;
-		float globalMult = settings->globalIntensity * stateMult;
 		
-		float hitScale = a_hitDataVanilla.flags.any(RE::HitData::Flag::kBlocked) ? 0.5f : 1.0f;
+		bool blocked = a_hitDataVanilla.flags.any(RE::HitData::Flag::kBlocked);
+		float hitScale = blocked ? 0.5f : 1.0f;
+		replayRecorder.RecordEvent({ 0.0f, SettleCore::Replay::EventType::kPrecisionHit, static_cast<std::uint8_t>(blocked), hitScale });
 		
-		const auto& hitSettings = settings->GetActionSettingsForState(ActionType::TakingHit, weaponDrawn);
-		ApplyImpulse(hitSpring, hitBlend, hitSettings, globalMult * hitScale, settings);
+		ApplyImpulse(hitSpring, hitBlend, ResolveImpulse(ActionType::TakingHit, weaponDrawn, *settings), hitScale, settings);
 		if (settings->fovPunchHitEnabled) {
-			StartFovPunch(settings->fovPunchHitStrength);
+			StartFovPunch(settings->fovPunchHitStrength, settings);
 		}
 		hitCooldown = 0.15f;
 		timeSinceAction = 0.0f;
 	}
 	
-	void CameraSettleManager::UpdateSpring(SpringState& a_state, const ActionSettings& a_settings, float a_delta, Settings* a_globalSettings)
-	{
-		if (a_delta <= 0.0f) {
-			return;
-		}
-		
-		// Spring parameters
-		float k = a_settings.stiffness;
-		float c = a_settings.damping;
-		
-		// Apply settling - increase damping when idle
-		float dampingMult = 1.0f + (settlingFactor * (a_globalSettings->settleDampingMult - 1.0f));
-		c *= dampingMult;
-		
-		float m = 1.0f;
-		
-		// Sub-stepping for stability (configurable via settings)
-		constexpr float MAX_SUBSTEP = 0.016f;
-		int numSteps = static_cast<int>(std::ceil(a_delta / MAX_SUBSTEP));
-		numSteps = std::clamp(numSteps, 1, a_globalSettings->springSubsteps);
-		float stepDelta = a_delta / static_cast<float>(numSteps);
-		
-		constexpr float MAX_POS_VELOCITY = 200.0f;
-		constexpr float MAX_ROT_VELOCITY = 20.0f;
-		
-		for (int step = 0; step < numSteps; ++step) {
-			// Position spring: F = -k * position - c * velocity (target is 0,0,0)
-			RE::NiPoint3 posForce = {
-				-k * a_state.positionOffset.x - c * a_state.positionVelocity.x,
-				-k * a_state.positionOffset.y - c * a_state.positionVelocity.y,
-				-k * a_state.positionOffset.z - c * a_state.positionVelocity.z
-			};
-			
-			a_state.positionVelocity.x += (posForce.x / m) * stepDelta;
-			a_state.positionVelocity.y += (posForce.y / m) * stepDelta;
-			a_state.positionVelocity.z += (posForce.z / m) * stepDelta;
-			
-			a_state.positionVelocity = ClampVector(a_state.positionVelocity, MAX_POS_VELOCITY);
-			
-			a_state.positionOffset.x += a_state.positionVelocity.x * stepDelta;
-			a_state.positionOffset.y += a_state.positionVelocity.y * stepDelta;
-			a_state.positionOffset.z += a_state.positionVelocity.z * stepDelta;
-			
-			a_state.positionOffset = ClampVector(a_state.positionOffset, a_settings.positionStrength * 3.0f);
-			
-			// Rotation spring
-			RE::NiPoint3 rotForce = {
-				-k * a_state.rotationOffset.x - c * a_state.rotationVelocity.x,
-				-k * a_state.rotationOffset.y - c * a_state.rotationVelocity.y,
-				-k * a_state.rotationOffset.z - c * a_state.rotationVelocity.z
-			};
-			
-			a_state.rotationVelocity.x += (rotForce.x / m) * stepDelta;
-			a_state.rotationVelocity.y += (rotForce.y / m) * stepDelta;
-			a_state.rotationVelocity.z += (rotForce.z / m) * stepDelta;
-			
-			a_state.rotationVelocity = ClampVector(a_state.rotationVelocity, MAX_ROT_VELOCITY);
-			
-			a_state.rotationOffset.x += a_state.rotationVelocity.x * stepDelta;
-			a_state.rotationOffset.y += a_state.rotationVelocity.y * stepDelta;
-			a_state.rotationOffset.z += a_state.rotationVelocity.z * stepDelta;
-			
-			float maxRotRad = a_settings.rotationStrength * DEG_TO_RAD * 3.0f;
-			a_state.rotationOffset = ClampVector(a_state.rotationOffset, maxRotRad);
-		}
-	}
-	
-	// Helper function to check if two movement actions are opposite directions
-	bool AreOppositeDirections(ActionType a_action1, ActionType a_action2)
-	{
-		// Check forward/backward opposites
-		bool fwd1 = (a_action1 == ActionType::WalkForward || a_action1 == ActionType::RunForward || 
-		             a_action1 == ActionType::SneakWalkForward || a_action1 == ActionType::SneakRunForward);
-		bool back1 = (a_action1 == ActionType::WalkBackward || a_action1 == ActionType::RunBackward ||
-		              a_action1 == ActionType::SneakWalkBackward || a_action1 == ActionType::SneakRunBackward);
-		bool left1 = (a_action1 == ActionType::WalkLeft || a_action1 == ActionType::RunLeft ||
-		              a_action1 == ActionType::SneakWalkLeft || a_action1 == ActionType::SneakRunLeft);
-		bool right1 = (a_action1 == ActionType::WalkRight || a_action1 == ActionType::RunRight ||
-		               a_action1 == ActionType::SneakWalkRight || a_action1 == ActionType::SneakRunRight);
-		
-		bool fwd2 = (a_action2 == ActionType::WalkForward || a_action2 == ActionType::RunForward ||
-		             a_action2 == ActionType::SneakWalkForward || a_action2 == ActionType::SneakRunForward);
-		bool back2 = (a_action2 == ActionType::WalkBackward || a_action2 == ActionType::RunBackward ||
-		              a_action2 == ActionType::SneakWalkBackward || a_action2 == ActionType::SneakRunBackward);
-		bool left2 = (a_action2 == ActionType::WalkLeft || a_action2 == ActionType::RunLeft ||
-		              a_action2 == ActionType::SneakWalkLeft || a_action2 == ActionType::SneakRunLeft);
-		bool right2 = (a_action2 == ActionType::WalkRight || a_action2 == ActionType::RunRight ||
-		               a_action2 == ActionType::SneakWalkRight || a_action2 == ActionType::SneakRunRight);
-		
-		// Forward vs backward OR left vs right
-		return (fwd1 && back2) || (back1 && fwd2) || (left1 && right2) || (right1 && left2);
-	}
-	
-	ActionType CameraSettleManager::DetectMovementAction(RE::PlayerCharacter* a_player)
-	{
-		auto* playerControls = RE::PlayerControls::GetSingleton();
-		if (!playerControls) {
-			return ActionType::kTotal;
-		}
-		
-		RE::NiPoint2 inputVec = playerControls->data.moveInputVec;
-		
-		// Threshold for movement detection
-		constexpr float THRESHOLD = 0.3f;
-		
-		bool movingForward = inputVec.y > THRESHOLD;
-		bool movingBackward = inputVec.y < -THRESHOLD;
-		bool movingLeft = inputVec.x < -THRESHOLD;
-		bool movingRight = inputVec.x > THRESHOLD;
-		
-		auto* actorState = a_player->AsActorState();
-		bool isSprinting = actorState->IsSprinting();
-		bool isSneaking = actorState->IsSneaking();
-		// IsWalking() returns true if the walk/run toggle is set to walk
-		// If not walking, player runs when moving
-		bool isWalking = actorState->IsWalking();
-		
-		// Determine action based on movement
-		if (isSprinting && movingForward) {
-			return ActionType::SprintForward;
-		}
-		
-		// Handle sneak movement
-		if (isSneaking) {
-			if (!isWalking) {
-				// Sneak running
-				if (movingForward) return ActionType::SneakRunForward;
-				if (movingBackward) return ActionType::SneakRunBackward;
-				if (movingLeft) return ActionType::SneakRunLeft;
-				if (movingRight) return ActionType::SneakRunRight;
-			} else {
-				// Sneak walking
-				if (movingForward) return ActionType::SneakWalkForward;
-				if (movingBackward) return ActionType::SneakWalkBackward;
-				if (movingLeft) return ActionType::SneakWalkLeft;
-				if (movingRight) return ActionType::SneakWalkRight;
-			}
-		}
-		
-		// Normal (not sneaking) movement
-		// If walking flag is not set, player runs
-		if (!isWalking) {
-			if (movingForward) return ActionType::RunForward;
-			if (movingBackward) return ActionType::RunBackward;
-			if (movingLeft) return ActionType::RunLeft;
-			if (movingRight) return ActionType::RunRight;
-		} else {
-			if (movingForward) return ActionType::WalkForward;
-			if (movingBackward) return ActionType::WalkBackward;
-			if (movingLeft) return ActionType::WalkLeft;
-			if (movingRight) return ActionType::WalkRight;
-		}
-		
-		return ActionType::kTotal;  // No movement
-	}
-	
-	void CameraSettleManager::DetectActions(RE::PlayerCharacter* a_player, float a_delta)
+	void CameraSettleManager::DetectActions(const SettleCore::PlayerStateSnapshot& a_state)
 	{
-		// Use cached settings pointer (passed from Update)
-		auto* settings = Settings::GetSingleton();
+		// Snapshot acquired at the top of Update
+		const auto* settings = settingsSnapshot.get();
 		
-		auto* actorState = a_player->AsActorState();
-		if (!actorState) return;
-		
-		bool weaponDrawn = actorState->IsWeaponDrawn();
-		bool isSprinting = actorState->IsSprinting();
-		bool isSneaking = actorState->IsSneaking();
-		bool isInAir = a_player->IsInMidair();
+		bool weaponDrawn = a_state.weaponDrawn;
 		
 		// Determine which settings to use
 		bool useDrawnSettings = weaponDrawn && settings->weaponDrawnEnabled;
 		bool useSheathedSettings = !weaponDrawn && settings->weaponSheathedEnabled;
 		
-		float stateMult = weaponDrawn ? settings->weaponDrawnMult : settings->weaponSheathedMult;
-		float globalMult = settings->globalIntensity * stateMult;
+		// Movement impulses follow weapon and sneak state through the blend space instead of switching
+		weaponStateBlend = SettleCore::MoveTowards(weaponStateBlend, weaponDrawn ? 1.0f : 0.0f, STATE_BLEND_SPEED * a_state.delta);
+		sneakStateBlend = SettleCore::MoveTowards(sneakStateBlend, a_state.sneaking ? 1.0f : 0.0f, STATE_BLEND_SPEED * a_state.delta);
 		
 		if (!useDrawnSettings && !useSheathedSettings) {
 			return;
 		}
 		
-		// Update cooldowns
-		if (landingCooldown > 0.0f) landingCooldown -= a_delta;
-		if (hitCooldown > 0.0f) hitCooldown -= a_delta;
-		if (movementDebounce > 0.0f) movementDebounce -= a_delta;
+		if (hitCooldown > 0.0f) hitCooldown -= a_state.delta;
 		
-		// === SNEAK DETECTION ===
-		if (isSneaking && !wasSneaking) {
-			const auto& sneakSettings = settings->GetActionSettingsForState(ActionType::Sneak, weaponDrawn);
-			ApplyImpulse(sneakSpring, sneakBlend, sneakSettings, globalMult, settings);
-			timeSinceAction = 0.0f;
-			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Sneak");
-		} else if (!isSneaking && wasSneaking) {
-			const auto& unSneakSettings = settings->GetActionSettingsForState(ActionType::UnSneak, weaponDrawn);
-			ApplyImpulse(sneakSpring, sneakBlend, unSneakSettings, globalMult, settings);
-			timeSinceAction = 0.0f;
-			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: UnSneak");
-		}
-		wasSneaking = isSneaking;
-		
-		// === JUMP/LAND DETECTION ===
-		// Track air time for landing impulse scaling
-		if (isInAir) {
-			airTime += a_delta;
-		}
+		// Every edge, debounce and grace period is a row of the transition table; this frame's rows come back as commands
+		const auto frame = actionStateMachine.Step(a_state, *settings);
 		
-		// Just left the ground - check if it was an actual jump or just walking off a ledge
-		if (isInAir && !wasInAir) {
-			// Check if player actually jumped using behavior graph variable
-			// bAnimationDriven is true during jump animations
-			bool bAnimDriven = false;
-			a_player->GetGraphVariableBool("bAnimationDriven", bAnimDriven);
-			
-			// Also check jumping state
-			bool isJumping = false;
-			a_player->GetGraphVariableBool("IsJumping", isJumping);
-			
-			// Player jumped if either animation driven or in jumping state
-			didJump = bAnimDriven || isJumping;
-			jumpStartZ = a_player->GetPosition().z;
-			
-			// Only apply jump impulse if player actually jumped (not walking off ledge)
-			if (didJump) {
-				const auto& jumpSettings = settings->GetActionSettingsForState(ActionType::Jump, weaponDrawn);
-				ApplyImpulse(jumpSpring, jumpBlend, jumpSettings, globalMult, settings);
-				timeSinceAction = 0.0f;
-				if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Jump (actual jump)");
-			} else {
-				if (settings->debugLogging) logger::info("[FPCameraSettle] Leaving ground (walk off ledge, no jump impulse)");
-			}
-		} 
-		// Just landed
-		else if (!isInAir && wasInAir && landingCooldown <= 0.0f) {
-			// Calculate landing impulse scale based on air time
-			float landingMult = 1.0f;
-			
-			if (settings->scaleJumpByAirTime) {
-				// Only apply landing if air time exceeds minimum
-				if (airTime < settings->jumpMinAirTime) {
-					// Too short of a drop, skip landing impulse
-					if (settings->debugLogging) logger::info("[FPCameraSettle] Short drop (airTime={:.3f}s < min={:.3f}s), skipping land impulse", 
-						airTime, settings->jumpMinAirTime);
-					airTime = 0.0f;
-					didJump = false;
-					wasInAir = isInAir;
-					return;  // Skip the landing impulse entirely
-				}
-				
-				// Calculate normalized air time (0 to 1 based on max scale time)
-				float normalizedAirTime = std::clamp(
-					(airTime - settings->jumpMinAirTime) / (settings->jumpMaxAirTimeScale - settings->jumpMinAirTime), 
-					0.0f, 1.0f
-				);
-				
-				// Base scale always applies, plus additional scale based on air time
-				landingMult = settings->landBaseScale + normalizedAirTime * settings->landAirTimeScale;
-				
-				// If didn't actually jump (just fell), reduce slightly
-				if (!didJump) {
-					landingMult *= 0.8f;
-				}
-			} else {
-				// Old behavior - simple scaling
-				landingMult = std::clamp(0.3f + airTime * 0.7f, 0.3f, 2.0f);
-			}
-			
-			const auto& landSettings = settings->GetActionSettingsForState(ActionType::Land, weaponDrawn);
-			ApplyImpulse(jumpSpring, jumpBlend, landSettings, globalMult * landingMult, settings);
-			timeSinceAction = 0.0f;
-			landingCooldown = 0.25f;
-			
-			if (settings->debugLogging) {
-				float fallDistance = jumpStartZ - a_player->GetPosition().z;
-				logger::info("[FPCameraSettle] Action: Land (airTime={:.2f}s, fallDist={:.0f}, mult={:.2f}, wasJump={})", 
-					airTime, fallDistance, landingMult, didJump ? "yes" : "no");
-			}
-			
-			airTime = 0.0f;
-			didJump = false;
+		// Direction is kept from the last moving frame so the stop impulse mirrors the last movement
+		if (actionStateMachine.Moving()) {
+			movementCoords.direction = SettleCore::MovementBlendSpace::Direction(a_state.moveInputX, a_state.moveInputY);
 		}
-		wasInAir = isInAir;
+		movementCoords.speed = actionStateMachine.WalkRunBlend();
+		movementCoords.weapon = weaponStateBlend;
+		movementCoords.sneak = sneakStateBlend;
 		
-		// === SPRINT DETECTION ===
-		if (isSprinting && !wasSprinting) {
-			const auto& sprintSettings = settings->GetActionSettingsForState(ActionType::SprintForward, weaponDrawn);
-			ApplyImpulse(movementSpring, movementBlend, sprintSettings, globalMult, settings);
-			timeSinceAction = 0.0f;
+		if (frame.Fired(SettleCore::Transition::kSprintStart)) {
 			idleNoiseAllowedAfterSprint = false;  // Block idle noise until sprint effects blend out
-			sprintStopTriggeredByAnim = false;    // Reset flag when starting new sprint (for rapid toggle)
-			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Sprint Start");
-		} else if (!isSprinting && wasSprinting) {
-			if (!sprintStopTriggeredByAnim) {
-				const auto& sprintSettings = settings->GetActionSettingsForState(ActionType::SprintForward, weaponDrawn);
-				ActionSettings reverseSettings = sprintSettings;
-				reverseSettings.impulseY = -reverseSettings.impulseY * 0.7f;
-				reverseSettings.rotImpulseX = -reverseSettings.rotImpulseX * 0.7f;
-				ApplyImpulse(movementSpring, movementBlend, reverseSettings, globalMult, settings);
-				timeSinceAction = 0.0f;
-				if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Sprint Stop (state fallback)");
-			}
-			sprintStopTriggeredByAnim = false;
 		}
-		wasSprinting = isSprinting;
-		
-		// === MOVEMENT DETECTION (walk/run start/stop) ===
-		ActionType currentMovement = DetectMovementAction(a_player);
-		bool isMoving = (currentMovement != ActionType::kTotal);
-		
-		// OPTIMIZATION: Only check walk state when moving (avoid unnecessary function call)
-		bool isWalking = isMoving ? actorState->IsWalking() : wasWalking;
+		ApplyActionFrame(frame, weaponDrawn, settings);
+	}
+	
+	void CameraSettleManager::ApplyActionFrame(const SettleCore::ActionFrame& a_frame, bool a_weaponDrawn, const SettingsData* a_globalSettings)
+	{
+		using SettleCore::ImpulseSource;
 		
-		// Get current movement speed for speed-based blending
-		auto* playerControls = RE::PlayerControls::GetSingleton();
-		float inputMagnitude = 0.0f;
-		if (playerControls) {
-			RE::NiPoint2 inputVec = playerControls->data.moveInputVec;
-			inputMagnitude = std::sqrt(inputVec.x * inputVec.x + inputVec.y * inputVec.y);
-		}
-		currentSpeed = inputMagnitude;
+		// Walk/run impulses are sampled from the blend space at the current speed, input direction and
+		// weapon/sneak blend (no per-frame Blend); sprint isn't in the blend space and has its own settings
+		auto getMovementImpulse = [&](ActionType moveType) -> SettleCore::ResolvedImpulse {
+			if (SettleCore::GetActionTraits(moveType).blendCardinal < 0) {
+				return GetImpulse(moveType, a_weaponDrawn);
+			}
+			return movementBlendSpace.Sample(movementCoords);
+		};
 		
-		// === SPEED-BASED WALK/RUN BLENDING ===
-		if (isMoving) {
-			constexpr float WALK_RUN_BLEND_SPEED = 5.0f;
-			float targetBlend;
+		for (int index = 0; index < a_frame.commandCount; ++index) {
+			const auto& command = a_frame.commands[index];
+			
+			SettleCore::ResolvedImpulse impulse;
+			switch (command.source) {
+			case ImpulseSource::kAction:
+				impulse = GetImpulse(command.action, a_weaponDrawn);
+				break;
+			case ImpulseSource::kMovement:
+				impulse = getMovementImpulse(command.action);
+				break;
+			case ImpulseSource::kMovementStop:
+				// Counter-impulse: half the start impulse in the opposite direction (less vertical)
+				impulse = SettleCore::ScaleImpulse(getMovementImpulse(command.action), STOP_POSITION_SCALE, STOP_ROTATION_SCALE);
+				break;
+			case ImpulseSource::kSprintReverse:
+				impulse = GetImpulse(ActionType::SprintForward, a_weaponDrawn);
+				impulse.position.y = -impulse.position.y * 0.7f;
+				impulse.rotation.x = -impulse.rotation.x * 0.7f;
+				break;
+			default:
+				continue;
+			}
 			
-			if (settings->speedBasedBlending) {
-				// Use input magnitude to determine blend
-				// Walk is typically 0.3-0.5, run is 0.7-1.0
-				// Blend smoothly between walk and run based on input magnitude
-				constexpr float WALK_THRESHOLD = 0.4f;
-				constexpr float RUN_THRESHOLD = 0.7f;
-				
-				if (inputMagnitude < WALK_THRESHOLD) {
-					targetBlend = 0.0f;  // Walk
-				} else if (inputMagnitude > RUN_THRESHOLD) {
-					targetBlend = 1.0f;  // Run
-				} else {
-					// Blend between walk and run
-					targetBlend = (inputMagnitude - WALK_THRESHOLD) / (RUN_THRESHOLD - WALK_THRESHOLD);
-				}
+			auto& spring = springRig.springs[command.layer];
+			auto& blend = springRig.blends[command.layer];
+			if (command.flags & SettleCore::ImpulseCommand::kCancelMomentum) {
+				// Instead of applying a full impulse (which fights with existing spring state), dampen the
+				// current velocity by 70% and fold in a little of the blends still pending from the old direction
+				constexpr float DAMPING_FACTOR = 0.3f;
+				spring.positionVelocity.x *= DAMPING_FACTOR;
+				spring.positionVelocity.y *= DAMPING_FACTOR;
+				spring.positionVelocity.z *= DAMPING_FACTOR;
+				spring.rotationVelocity.x *= DAMPING_FACTOR;
+				spring.rotationVelocity.y *= DAMPING_FACTOR;
+				spring.rotationVelocity.z *= DAMPING_FACTOR;
 				
-				// If player has walk toggle on, cap at walk
-				if (isWalking) {
-					targetBlend = std::min(targetBlend, 0.3f);
+				if (blend.IsActive()) {
+					for (int slot = 0; slot < PendingBlend::kSlots; ++slot) {
+						if (!blend.IsSlotActive(slot)) {
+							continue;
+						}
+						const auto& pending = blend.slots[slot];
+						float remainingProgress = 1.0f - pending.progress;
+						if (remainingProgress > 0.1f) {
+							float reducedRemaining = remainingProgress * 0.2f;
+							spring.positionVelocity.x += pending.posImpulse.x * reducedRemaining;
+							spring.positionVelocity.y += pending.posImpulse.y * reducedRemaining;
+							spring.positionVelocity.z += pending.posImpulse.z * reducedRemaining;
+						}
+					}
+					blend.Reset();
 				}
-			} else {
-				// Binary walk/run based on toggle
-				targetBlend = isWalking ? 0.0f : 1.0f;
 			}
+			ApplyImpulse(spring, blend, impulse, command.scale, a_globalSettings);
 			
-			if (walkRunBlend < targetBlend) {
-				walkRunBlend = std::min(walkRunBlend + WALK_RUN_BLEND_SPEED * a_delta, targetBlend);
-			} else if (walkRunBlend > targetBlend) {
-				walkRunBlend = std::max(walkRunBlend - WALK_RUN_BLEND_SPEED * a_delta, targetBlend);
+			if (a_globalSettings->debugOnScreen && (command.flags & SettleCore::ImpulseCommand::kNotify)) {
+				char buf[128];
+				snprintf(buf, sizeof(buf), "FPCam: %s %s [%s]", SettleCore::TransitionName(command.transition),
+					Settings::GetActionName(command.action), a_weaponDrawn ? "DRAWN" : "SHEATH");
+				RE::DebugNotification(buf);
 			}
-			
-			// Update speed blend for grace period tracking
-			speedBlend = walkRunBlend;
 		}
 		
-		// === WALK-TO-RUN GRACE PERIOD ===
-		// Track when movement starts, block walk impulse if player accelerates quickly to run
-		if (isMoving && !wasMovingForGrace) {
-			// Just started moving
-			movementStartTime = 0.0f;
-			walkImpulseBlocked = false;
+		if (a_frame.settled) {
+			timeSinceAction = 0.0f;
 		}
-		if (isMoving) {
-			movementStartTime += a_delta;
-			
-			// If within grace period and player is running/accelerating, block walk impulse
-			if (movementStartTime < settings->walkToRunGracePeriod && walkRunBlend > 0.5f) {
-				walkImpulseBlocked = true;
-			}
-		} else {
-			walkImpulseBlocked = false;
-		}
-		wasMovingForGrace = isMoving;
-		
-		// OPTIMIZATION: Cache blended settings - only recalculate when blend, weapon state, or settings change
-		// Only check settings version when edit mode is enabled (for performance)
-		uint32_t currentSettingsVersion = settings->GetVersion();
-		bool settingsChanged = settings->IsEditMode() && (currentSettingsVersion != lastSettingsVersion);
-		bool needsBlendRecalc = (std::abs(walkRunBlend - lastWalkRunBlend) > 0.01f) || 
-		                        (weaponDrawn != lastBlendWeaponDrawn) ||
-		                        settingsChanged;
-		if (needsBlendRecalc) {
-			// Update cached blended settings for all 4 directions
-			const auto& walkFwd = settings->GetActionSettingsForState(ActionType::WalkForward, weaponDrawn);
-			const auto& runFwd = settings->GetActionSettingsForState(ActionType::RunForward, weaponDrawn);
-			cachedBlendedWalkRun[0] = ActionSettings::Blend(walkFwd, runFwd, walkRunBlend);
-			
-			const auto& walkBack = settings->GetActionSettingsForState(ActionType::WalkBackward, weaponDrawn);
-			const auto& runBack = settings->GetActionSettingsForState(ActionType::RunBackward, weaponDrawn);
-			cachedBlendedWalkRun[1] = ActionSettings::Blend(walkBack, runBack, walkRunBlend);
-			
-			const auto& walkLeft = settings->GetActionSettingsForState(ActionType::WalkLeft, weaponDrawn);
-			const auto& runLeft = settings->GetActionSettingsForState(ActionType::RunLeft, weaponDrawn);
-			cachedBlendedWalkRun[2] = ActionSettings::Blend(walkLeft, runLeft, walkRunBlend);
-			
-			const auto& walkRight = settings->GetActionSettingsForState(ActionType::WalkRight, weaponDrawn);
-			const auto& runRight = settings->GetActionSettingsForState(ActionType::RunRight, weaponDrawn);
-			cachedBlendedWalkRun[3] = ActionSettings::Blend(walkRight, runRight, walkRunBlend);
-			
-			lastWalkRunBlend = walkRunBlend;
-			lastBlendWeaponDrawn = weaponDrawn;
-			lastSettingsVersion = currentSettingsVersion;
-		}
-		
-		// Helper to get cached blended movement settings (no allocation)
-		// Sneak movements use their own settings (no walk/run blending for sneak)
-		auto getCachedBlendedSettings = [&](ActionType moveType) -> const ActionSettings& {
-			switch (moveType) {
-				case ActionType::WalkForward:
-				case ActionType::RunForward:
-					return cachedBlendedWalkRun[0];
-				case ActionType::WalkBackward:
-				case ActionType::RunBackward:
-					return cachedBlendedWalkRun[1];
-				case ActionType::WalkLeft:
-				case ActionType::RunLeft:
-					return cachedBlendedWalkRun[2];
-				case ActionType::WalkRight:
-				case ActionType::RunRight:
-					return cachedBlendedWalkRun[3];
-				// Sneak movements - use directly, no walk/run blending
-				case ActionType::SneakWalkForward:
-				case ActionType::SneakWalkBackward:
-				case ActionType::SneakWalkLeft:
-				case ActionType::SneakWalkRight:
-				case ActionType::SneakRunForward:
-				case ActionType::SneakRunBackward:
-				case ActionType::SneakRunLeft:
-				case ActionType::SneakRunRight:
-					return settings->GetActionSettingsForState(moveType, weaponDrawn);
-				default:
-					return settings->GetActionSettingsForState(moveType, weaponDrawn);
-			}
-		};
 		
-		// Detect walk/run state change while moving
-		if (isMoving && wasMoving && wasWalking != isWalking && movementDebounce <= 0.0f) {
-			const ActionSettings& blendedSettings = getCachedBlendedSettings(currentMovement);
-			ApplyImpulse(movementSpring, movementBlend, blendedSettings, globalMult * 0.3f, settings);
-			timeSinceAction = 0.0f;
-			movementDebounce = 0.1f;
-			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Walk/Run Transition (blend={:.2f}, weapon={})", walkRunBlend, weaponDrawn ? "drawn" : "sheathed");
-		}
-		wasWalking = isWalking;
-		
-		// Detect movement start
-		if (isMoving && !wasMoving && movementDebounce <= 0.0f) {
-			// Check if walk impulse should be blocked (grace period for accelerating to run)
-			// Only block if this is a walk-type movement and grace period is enabled
-			bool isWalkMovement = (currentMovement == ActionType::WalkForward || 
-			                       currentMovement == ActionType::WalkBackward ||
-			                       currentMovement == ActionType::WalkLeft || 
-			                       currentMovement == ActionType::WalkRight ||
-			                       currentMovement == ActionType::SneakWalkForward ||
-			                       currentMovement == ActionType::SneakWalkBackward ||
-			                       currentMovement == ActionType::SneakWalkLeft ||
-			                       currentMovement == ActionType::SneakWalkRight);
-			
-			// For walk movements with grace period, defer the impulse
-			// We'll apply the run impulse instead if player accelerates quickly
-			if (isWalkMovement && settings->walkToRunGracePeriod > 0.0f && settings->speedBasedBlending) {
-				// Don't apply impulse yet - wait for grace period
-				// The impulse will be applied after grace period if still walking
-				// Or the run impulse will apply when speed increases
-				if (settings->debugLogging) {
-					logger::info("[FPCameraSettle] Walk start - grace period active (waiting {:.2f}s)", settings->walkToRunGracePeriod);
-				}
-			} else {
-				// Normal case - apply impulse immediately
-				const ActionSettings& moveSettings = getCachedBlendedSettings(currentMovement);
-				ApplyImpulse(movementSpring, movementBlend, moveSettings, globalMult, settings);
-				timeSinceAction = 0.0f;
-				if (settings->debugLogging) logger::info("[FPCameraSettle] Action: {} Start (blend={:.2f}, weapon={})", Settings::GetActionName(currentMovement), walkRunBlend, weaponDrawn ? "drawn" : "sheathed");
-				if (settings->debugOnScreen) {
-					char buf[128];
-					snprintf(buf, sizeof(buf), "FPCam: %s [%s] mult=%.2f", 
-						Settings::GetActionName(currentMovement),
-						weaponDrawn ? "DRAWN" : "SHEATH",
-						globalMult);
-					RE::DebugNotification(buf);
-				}
-			}
-			movementDebounce = 0.15f;
-		}
-		// Apply deferred walk impulse after grace period (if still walking)
-		else if (isMoving && wasMoving && movementStartTime >= settings->walkToRunGracePeriod && 
-		         movementStartTime < settings->walkToRunGracePeriod + a_delta * 2.0f && 
-		         !walkImpulseBlocked && settings->speedBasedBlending && movementDebounce <= 0.0f) {
-			// Grace period just ended and player is still walking - apply the walk impulse now
-			if (walkRunBlend < 0.5f) {
-				const ActionSettings& moveSettings = getCachedBlendedSettings(currentMovement);
-				ApplyImpulse(movementSpring, movementBlend, moveSettings, globalMult, settings);
-				timeSinceAction = 0.0f;
-				movementDebounce = 0.1f;
-				if (settings->debugLogging) logger::info("[FPCameraSettle] Action: {} Start (deferred after grace period)", Settings::GetActionName(currentMovement));
-			}
+		if (!a_globalSettings->debugLogging) {
+			return;
 		}
-		// Detect movement stop
-		else if (!isMoving && wasMoving && movementDebounce <= 0.0f) {
-			if (lastMovementAction != ActionType::kTotal) {
-				const ActionSettings& moveSettings = getCachedBlendedSettings(lastMovementAction);
-				ActionSettings stopSettings = moveSettings;
-				stopSettings.impulseX = -stopSettings.impulseX * 0.5f;
-				stopSettings.impulseY = -stopSettings.impulseY * 0.5f;
-				stopSettings.impulseZ = -stopSettings.impulseZ * 0.3f;
-				stopSettings.rotImpulseX = -stopSettings.rotImpulseX * 0.5f;
-				stopSettings.rotImpulseY = -stopSettings.rotImpulseY * 0.5f;
-				stopSettings.rotImpulseZ = -stopSettings.rotImpulseZ * 0.5f;
-				ApplyImpulse(movementSpring, movementBlend, stopSettings, globalMult, settings);
+		const char* weapon = a_weaponDrawn ? "drawn" : "sheathed";
+		for (int index = 0; index < static_cast<int>(SettleCore::Transition::kTotal); ++index) {
+			const auto transition = static_cast<SettleCore::Transition>(index);
+			if (!a_frame.Fired(transition)) {
+				continue;
 			}
-			timeSinceAction = 0.0f;
-			movementDebounce = 0.15f;
-			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Movement Stop");
-		}
-		// Detect movement direction change
-		else if (isMoving && currentMovement != currentMovementAction && currentMovementAction != ActionType::kTotal && movementDebounce <= 0.0f) {
-			// Check if this is an opposite direction change (forward<->back, left<->right)
-			bool isOppositeDirection = AreOppositeDirections(currentMovement, currentMovementAction);
-			
-			if (isOppositeDirection) {
-				// === OPPOSITE DIRECTION HANDLING ===
-				// Instead of applying a full impulse (which fights with existing spring state),
-				// we dampen the current spring velocity and apply a reduced impulse.
-				// This creates a smooth "decelerate then accelerate" transition.
-				
-				// Dampen existing spring velocity to reduce fighting
-				// This smoothly cancels the momentum from the previous direction
-				float dampingFactor = 0.3f;  // Reduce velocity by 70%
-				movementSpring.positionVelocity.x *= dampingFactor;
-				movementSpring.positionVelocity.y *= dampingFactor;
-				movementSpring.positionVelocity.z *= dampingFactor;
-				movementSpring.rotationVelocity.x *= dampingFactor;
-				movementSpring.rotationVelocity.y *= dampingFactor;
-				movementSpring.rotationVelocity.z *= dampingFactor;
-				
-				// Cancel any pending blend from the previous direction
-				if (movementBlend.active) {
-					// Apply remaining blend at reduced strength instead of fighting
-					float remainingProgress = 1.0f - movementBlend.progress;
-					if (remainingProgress > 0.1f) {
-						// Only apply a small portion to avoid fighting
-						float reducedRemaining = remainingProgress * 0.2f;
-						movementSpring.positionVelocity.x += movementBlend.posImpulse.x * reducedRemaining;
-						movementSpring.positionVelocity.y += movementBlend.posImpulse.y * reducedRemaining;
-						movementSpring.positionVelocity.z += movementBlend.posImpulse.z * reducedRemaining;
-					}
-					movementBlend.Reset();
-				}
-				
-				// Apply the new direction's impulse at reduced strength
-				// The dampened velocity + reduced impulse = smooth transition
-				const ActionSettings& moveSettings = getCachedBlendedSettings(currentMovement);
-				ApplyImpulse(movementSpring, movementBlend, moveSettings, globalMult * 0.25f, settings);
-				
-				// Longer debounce for opposite directions to prevent rapid oscillation
-				movementDebounce = 0.15f;
-				
-				if (settings->debugLogging) {
-					logger::info("[FPCameraSettle] Action: Opposite Direction {} -> {} (dampened)", 
-						Settings::GetActionName(currentMovementAction), Settings::GetActionName(currentMovement));
-				}
+			const char* name = SettleCore::TransitionName(transition);
+			if (transition == SettleCore::Transition::kLand) {
+				logger::info("[FPCameraSettle] Action: {} (airTime={:.2f}s, weapon={})", name, actionStateMachine.LastAirTime(), weapon);
+			} else if (transition >= SettleCore::Transition::kWalkToRun) {
+				logger::info("[FPCameraSettle] Action: {} {} (blend={:.2f}, weapon={})", name,
+					Settings::GetActionName(actionStateMachine.LastMovementAction()), movementCoords.speed, weapon);
 			} else {
-				// === NORMAL DIRECTION CHANGE (e.g., forward to left) ===
-				// These don't fight as much, apply normal impulse
-				const ActionSettings& moveSettings = getCachedBlendedSettings(currentMovement);
-				ApplyImpulse(movementSpring, movementBlend, moveSettings, globalMult * 0.5f, settings);
-				movementDebounce = 0.1f;
-				
-				if (settings->debugLogging) {
-					logger::info("[FPCameraSettle] Action: Direction Change to {} (weapon={})", 
-						Settings::GetActionName(currentMovement), weaponDrawn ? "drawn" : "sheathed");
-				}
-				if (settings->debugOnScreen) {
-					char buf[128];
-					snprintf(buf, sizeof(buf), "FPCam: -> %s [%s]", 
-						Settings::GetActionName(currentMovement),
-						weaponDrawn ? "DRAWN" : "SHEATH");
-					RE::DebugNotification(buf);
-				}
+				logger::info("[FPCameraSettle] Action: {} (weapon={})", name, weapon);
 			}
-			
-			timeSinceAction = 0.0f;
 		}
-		
-		wasMoving = isMoving;
-		if (isMoving) {
-			lastMovementAction = currentMovement;
-		}
-		currentMovementAction = currentMovement;
-		wasWeaponDrawn = weaponDrawn;
 	}
 	
 	RE::BSEventNotifyControl CameraSettleManager::ProcessEvent(const RE::TESHitEvent* a_event, RE::BSTEventSource<RE::TESHitEvent>*)
@@ -874,7 +463,8 @@ namespace CameraSettle
 			return RE::BSEventNotifyControl::kContinue;
 		}
 		
-		auto* settings = Settings::GetSingleton();
+		const auto snapshot = Settings::GetSingleton()->GetSnapshot();
+		const auto* settings = snapshot.get();
 		if (!settings->enabled) {
 			return RE::BSEventNotifyControl::kContinue;
 		}
@@ -902,8 +492,6 @@ namespace CameraSettle
 		// Note: Hits with no cause (environmental) are now allowed
 		
 		bool weaponDrawn = player->AsActorState()->IsWeaponDrawn();
-		float stateMult = weaponDrawn ? settings->weaponDrawnMult : settings->weaponSheathedMult;
-		float globalMult = settings->globalIntensity * stateMult;
 		
 		// Check if player is involved
 		bool playerHit = (a_event->target.get() == player);
@@ -955,19 +543,19 @@ namespace CameraSettle
 			if (!confirmedHit) {
 				return RE::BSEventNotifyControl::kContinue;
 			}
+			replayRecorder.RecordEvent({ 0.0f, SettleCore::Replay::EventType::kHitTaken, static_cast<std::uint8_t>(hitScale < 1.0f), hitScale });
 			
-			const auto& hitSettings = settings->GetActionSettingsForState(ActionType::TakingHit, weaponDrawn);
-			ApplyImpulse(hitSpring, hitBlend, hitSettings, globalMult * hitScale, settings);
+			ApplyImpulse(hitSpring, hitBlend, ResolveImpulse(ActionType::TakingHit, weaponDrawn, *settings), hitScale, settings);
 			if (settings->fovPunchHitEnabled) {
-				StartFovPunch(settings->fovPunchHitStrength);
+				StartFovPunch(settings->fovPunchHitStrength, settings);
 			}
 			hitCooldown = 0.15f;  // Slightly longer cooldown to prevent rapid re-triggers
 			timeSinceAction = 0.0f;
 			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Taking Hit (source: {:X})", 
 				a_event->source);
 		} else if (playerHitting) {
-			const auto& hittingSettings = settings->GetActionSettingsForState(ActionType::Hitting, weaponDrawn);
-			ApplyImpulse(hitSpring, hitBlend, hittingSettings, globalMult, settings);
+			replayRecorder.RecordEvent({ 0.0f, SettleCore::Replay::EventType::kHitting, 0, 1.0f });
+			ApplyImpulse(hitSpring, hitBlend, ResolveImpulse(ActionType::Hitting, weaponDrawn, *settings), 1.0f, settings);
 			hitCooldown = 0.05f;
 			timeSinceAction = 0.0f;
 			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Hitting");
@@ -988,55 +576,124 @@ namespace CameraSettle
 			return RE::BSEventNotifyControl::kContinue;
 		}
 		
-		auto* settings = Settings::GetSingleton();
+		const auto snapshot = Settings::GetSingleton()->GetSnapshot();
+		const auto* settings = snapshot.get();
 		if (!settings->enabled) {
 			return RE::BSEventNotifyControl::kContinue;
 		}
 		
+		// Interned tag identity: one slot read, and nothing else for the many tags we don't handle.
+		// The table is only read here; Update swaps in a rebuilt one, and this reference keeps ours intact.
+		const auto routing = animEventRouting.load(std::memory_order_acquire);
+		const auto* route = routing ? routing->table.Find(a_event->tag.data()) : nullptr;
+		if (!route) {
+			return RE::BSEventNotifyControl::kContinue;
+		}
+		
 		bool weaponDrawn = player->AsActorState()->IsWeaponDrawn();
-		float stateMult = weaponDrawn ? settings->weaponDrawnMult : settings->weaponSheathedMult;
-		float globalMult = settings->globalIntensity * stateMult;
-		
-		// Check for arrow release event
-		if (a_event->tag == "arrowRelease" || a_event->tag == "BoltRelease") {
-			const auto& arrowSettings = settings->GetActionSettingsForState(ActionType::ArrowRelease, weaponDrawn);
-			ApplyImpulse(archerySpring, archeryBlend, arrowSettings, globalMult, settings);
-			if (settings->fovPunchArrowEnabled) {
-				StartFovPunch(settings->fovPunchArrowStrength);
+		
+		switch (route->handler) {
+		case SettleCore::AnimEventHandler::kArrowRelease:
+		case SettleCore::AnimEventHandler::kBoltRelease:
+			{
+				auto tag = route->handler == SettleCore::AnimEventHandler::kArrowRelease ? SettleCore::Replay::AnimTag::kArrowRelease : SettleCore::Replay::AnimTag::kBoltRelease;
+				replayRecorder.RecordEvent({ 0.0f, SettleCore::Replay::EventType::kAnimation, static_cast<std::uint8_t>(tag), 1.0f });
+				ApplyImpulse(archerySpring, archeryBlend, ResolveImpulse(ActionType::ArrowRelease, weaponDrawn, *settings), 1.0f, settings);
+				if (settings->fovPunchArrowEnabled) {
+					StartFovPunch(settings->fovPunchArrowStrength, settings);
+				}
+				archeryDrawActive = false;
+				archeryReleaseTimer = 0.15f;
+				timeSinceAction = 0.0f;
+				if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Arrow/Bolt Release (anim event)");
+				break;
 			}
-			archeryDrawActive = false;
-			archeryReleaseTimer = 0.15f;
-			timeSinceAction = 0.0f;
-			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Arrow/Bolt Release (anim event)");
-		}
-		// Check for sprint stop animation event (EndAnimatedCameraDelta)
-		// Only trigger sprint stop if we were sprinting AND are no longer sprinting
+		// Sprint stop animation event: only trigger sprint stop if we were sprinting AND are no longer sprinting
 		// (EndAnimatedCameraDelta can fire during sprint when the initial tilt animation ends)
-		else if (a_event->tag == "EndAnimatedCameraDelta") {
-			bool currentlySprinting = player->AsActorState() && player->AsActorState()->IsSprinting();
-			if (wasSprinting && !currentlySprinting) {
-				const auto& sprintSettings = settings->GetActionSettingsForState(ActionType::SprintForward, weaponDrawn);
-				ActionSettings reverseSettings = sprintSettings;
-				reverseSettings.impulseY = -reverseSettings.impulseY * 0.7f;
-				reverseSettings.rotImpulseX = -reverseSettings.rotImpulseX * 0.7f;
-				ApplyImpulse(movementSpring, movementBlend, reverseSettings, globalMult, settings);
-				timeSinceAction = 0.0f;
-				sprintStopTriggeredByAnim = true;
-				idleNoiseAllowedAfterSprint = true;  // Allow idle noise to blend in now
-				if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Sprint Stop (anim event)");
-			} else if (wasSprinting && currentlySprinting) {
-				// Still sprinting - this is just the sprint start animation ending, allow idle noise
-				idleNoiseAllowedAfterSprint = true;
-				if (settings->debugLogging) logger::info("[FPCameraSettle] Sprint camera animation ended (still sprinting)");
+		case SettleCore::AnimEventHandler::kEndAnimatedCameraDelta:
+			{
+				replayRecorder.RecordEvent({ 0.0f, SettleCore::Replay::EventType::kAnimation, static_cast<std::uint8_t>(SettleCore::Replay::AnimTag::kEndAnimatedCameraDelta), 1.0f });
+				bool currentlySprinting = player->AsActorState() && player->AsActorState()->IsSprinting();
+				if (actionStateMachine.Sprinting() && !currentlySprinting) {
+					SettleCore::ResolvedImpulse reverseImpulse = ResolveImpulse(ActionType::SprintForward, weaponDrawn, *settings);
+					reverseImpulse.position.y = -reverseImpulse.position.y * 0.7f;
+					reverseImpulse.rotation.x = -reverseImpulse.rotation.x * 0.7f;
+					ApplyImpulse(movementSpring, movementBlend, reverseImpulse, 1.0f, settings);
+					timeSinceAction = 0.0f;
+					replayRecorder.RecordEvent({ 0.0f, SettleCore::Replay::EventType::kSprintStopAnimated, 0, 1.0f });
+					actionStateMachine.SetSprintStopAnimated();
+					idleNoiseAllowedAfterSprint = true;  // Allow idle noise to blend in now
+					if (settings->debugLogging) logger::info("[FPCameraSettle] Action: Sprint Stop (anim event)");
+				} else if (actionStateMachine.Sprinting() && currentlySprinting) {
+					// Still sprinting - this is just the sprint start animation ending, allow idle noise
+					idleNoiseAllowedAfterSprint = true;
+					if (settings->debugLogging) logger::info("[FPCameraSettle] Sprint camera animation ended (still sprinting)");
+				}
+				break;
 			}
+		// [AnimationEvents] binding: the same path as TriggerAction, recorded as one for replay
+		case SettleCore::AnimEventHandler::kAction:
+			replayRecorder.RecordEvent({ 0.0f, SettleCore::Replay::EventType::kTriggerAction, static_cast<std::uint8_t>(route->action), 1.0f });
+			ApplyActionImpulse(route->action, weaponDrawn, settings);
+			if (settings->debugLogging) logger::info("[FPCameraSettle] Action: {} (anim event {})", Settings::GetActionName(route->action), a_event->tag.c_str());
+			break;
+		default:
+			break;
 		}
 		
 		return RE::BSEventNotifyControl::kContinue;
 	}
 	
+	RE::BSEventNotifyControl CameraSettleManager::ProcessEvent(RE::InputEvent* const* a_event, RE::BSTEventSource<RE::InputEvent*>*)
+	{
+		if (!a_event) {
+			return RE::BSEventNotifyControl::kContinue;
+		}
+		
+		// Profile hotkey; ignored while the game is paused so typing in the console or a menu can't trigger it
+		const auto snapshot = Settings::GetSingleton()->GetSnapshot();
+		const auto* settings = snapshot.get();
+		if (settings->profileCycleKey <= 0) {
+			return RE::BSEventNotifyControl::kContinue;
+		}
+		auto* ui = RE::UI::GetSingleton();
+		if (ui && ui->GameIsPaused()) {
+			return RE::BSEventNotifyControl::kContinue;
+		}
+		
+		for (auto* event = *a_event; event; event = event->next) {
+			auto* button = event->AsButtonEvent();
+			if (!button || button->GetDevice() != RE::INPUT_DEVICE::kKeyboard || !button->IsDown()) {
+				continue;
+			}
+			if (static_cast<int>(button->GetIDCode()) == settings->profileCycleKey) {
+				auto* source = Settings::GetSingleton();
+				source->SelectNextProfile();
+				auto names = source->GetProfileNames();
+				const int active = source->GetActiveProfile();
+				if (active < static_cast<int>(names.size())) {
+					RE::DebugNotification(fmt::format("FP Camera Settle: {} profile", names[active]).c_str());
+				}
+				break;
+			}
+		}
+		return RE::BSEventNotifyControl::kContinue;
+	}
+	
+	RE::BSEventNotifyControl CameraSettleManager::ProcessEvent(const RE::MenuOpenCloseEvent* a_event, RE::BSTEventSource<RE::MenuOpenCloseEvent>*)
+	{
+		// Quitting goes through the pause (Journal) menu or the main menu, and the writer thread is killed
+		// with the process, so a save still queued or being written has to finish here. Usually none is.
+		if (a_event && a_event->opening && (a_event->menuName == RE::JournalMenu::MENU_NAME || a_event->menuName == RE::MainMenu::MENU_NAME)) {
+			Settings::GetSingleton()->FlushSave();
+		}
+		return RE::BSEventNotifyControl::kContinue;
+	}
+	
 	void CameraSettleManager::TriggerAction(ActionType a_action)
 	{
-		auto* settings = Settings::GetSingleton();
+		const auto snapshot = Settings::GetSingleton()->GetSnapshot();
+		const auto* settings = snapshot.get();
 		if (!settings->enabled || !isInFirstPerson) {
 			return;
 		}
@@ -1045,39 +702,140 @@ namespace CameraSettle
 		if (!player) return;
 		
 		bool weaponDrawn = player->AsActorState()->IsWeaponDrawn();
-		float stateMult = weaponDrawn ? settings->weaponDrawnMult : settings->weaponSheathedMult;
-		float globalMult = settings->globalIntensity * stateMult;
+		replayRecorder.RecordEvent({ 0.0f, SettleCore::Replay::EventType::kTriggerAction, static_cast<std::uint8_t>(a_action), 1.0f });
+		ApplyActionImpulse(a_action, weaponDrawn, settings);
+	}
+	
+	void CameraSettleManager::ApplyActionImpulse(ActionType a_action, bool a_weaponDrawn, const SettingsData* a_globalSettings)
+	{
+		const auto layer = SettleCore::GetActionTraits(a_action).layer;
+		ApplyImpulse(springRig.springs[layer], springRig.blends[layer], ResolveImpulse(a_action, a_weaponDrawn, *a_globalSettings), 1.0f, a_globalSettings);
 		
-		const auto& actionSettings = settings->GetActionSettingsForState(a_action, weaponDrawn);
+		timeSinceAction = 0.0f;
+	}
+	
+	void CameraSettleManager::RequestReplayDump()
+	{
+		replayDumpRequested = true;
+	}
+	
+	SettleCore::PlayerStateSnapshot CameraSettleManager::GatherPlayerState(RE::PlayerCharacter* a_player, float a_delta)
+	{
+		SettleCore::PlayerStateSnapshot state;
+		state.delta = a_delta;
+		
+		if (auto* playerControls = RE::PlayerControls::GetSingleton()) {
+			state.moveInputX = playerControls->data.moveInputVec.x;
+			state.moveInputY = playerControls->data.moveInputVec.y;
+		}
+		state.positionZ = a_player->GetPosition().z;
+		state.inMidair = a_player->IsInMidair();
+		
+		if (auto* actorState = a_player->AsActorState()) {
+			state.weaponDrawn = actorState->IsWeaponDrawn();
+			state.sprinting = actorState->IsSprinting();
+			state.sneaking = actorState->IsSneaking();
+			state.walking = actorState->IsWalking();
+			state.swimming = actorState->IsSwimming();
+			
+			// Bow draw (and the skill that scales it) can't happen with the weapon sheathed
+			if (state.weaponDrawn && IsBowEquipped(a_player)) {
+				state.bowDrawn = IsBowDrawState(actorState->GetAttackState());
+				if (state.bowDrawn) {
+					state.archerySkill = a_player->AsActorValueOwner()->GetActorValue(RE::ActorValue::kArchery);
+				}
+			}
+		}
 		
-		// Route to appropriate spring
-		switch (a_action) {
-		case ActionType::Jump:
-		case ActionType::Land:
-			ApplyImpulse(jumpSpring, jumpBlend, actionSettings, globalMult, settings);
-			break;
-		case ActionType::Sneak:
-		case ActionType::UnSneak:
-			ApplyImpulse(sneakSpring, sneakBlend, actionSettings, globalMult, settings);
-			break;
-		case ActionType::TakingHit:
-		case ActionType::Hitting:
-			ApplyImpulse(hitSpring, hitBlend, actionSettings, globalMult, settings);
-			break;
-		case ActionType::ArrowRelease:
-			ApplyImpulse(archerySpring, archeryBlend, actionSettings, globalMult, settings);
-			break;
-		default:
-			ApplyImpulse(movementSpring, movementBlend, actionSettings, globalMult, settings);
-			break;
+		// Jump detection only reads the graph variables on the takeoff frame (whether leaving the ground was a jump)
+		if (state.inMidair && !actionStateMachine.InAir()) {
+			ReadGraphVariables(a_player, state);
 		}
 		
-		timeSinceAction = 0.0f;
+		if (auto* ui = RE::UI::GetSingleton()) {
+			state.dialogueOpen = ui->IsMenuOpen(RE::DialogueMenu::MENU_NAME);
+			state.mapOpen = ui->IsMenuOpen(RE::MapMenu::MENU_NAME);
+		}
+		return state;
+	}
+	
+	void CameraSettleManager::ReadGraphVariables(RE::PlayerCharacter* a_player, SettleCore::PlayerStateSnapshot& a_state)
+	{
+		using SettleCore::kGraphVariables;
+		using SettleCore::kGraphVariableCount;
+		
+		RE::hkbBehaviorGraph* behaviorGraph = nullptr;
+		RE::BSTSmartPointer<RE::BSAnimationGraphManager> manager;
+		if (a_player->GetAnimationGraphManager(manager) && manager && manager->activeGraph < manager->graphs.size()) {
+			if (const auto& graph = manager->graphs[manager->activeGraph]) {
+				behaviorGraph = graph->behaviorGraph;
+			}
+		}
+		const auto* stringData = behaviorGraph && behaviorGraph->data ? behaviorGraph->data->stringData.get() : nullptr;
+		const auto* values = behaviorGraph ? behaviorGraph->variableValueSet.get() : nullptr;
+		
+		// No graph to index into (still loading): look the variables up by name
+		if (!stringData || !values) {
+			for (const auto& variable : kGraphVariables) {
+				a_player->GetGraphVariableBool(variable.name, a_state.*variable.field);
+			}
+			return;
+		}
+		
+		// First read from this graph (new game, load, race or skeleton change): resolve every row, then
+		// check each handle against the name lookup once and drop any that disagree
+		const auto nameCount = static_cast<std::int32_t>(stringData->variableNames.size());
+		if (!graphVariables.IsResolvedFor(behaviorGraph, nameCount)) {
+			graphVariables.Resolve(behaviorGraph, nameCount, [&](std::int32_t a_index) {
+				const char* name = stringData->variableNames[a_index].c_str();
+				return std::string_view(name ? name : "");
+			});
+			for (int variable = 0; variable < kGraphVariableCount; ++variable) {
+				const auto index = graphVariables.Get(variable);
+				bool byName = false;
+				a_player->GetGraphVariableBool(kGraphVariables[variable].name, byName);
+				if (index == SettleCore::GraphVariableHandles::kUnresolved || index >= static_cast<std::int32_t>(values->wordVariableValues.size()) ||
+					(values->wordVariableValues[index].value != 0) != byName) {
+					graphVariables.Invalidate(variable);
+					logger::warn("[FPCameraSettle] Graph variable {} has no usable handle; reading it by name", kGraphVariables[variable].name);
+				}
+			}
+		}
+		
+		for (int variable = 0; variable < kGraphVariableCount; ++variable) {
+			const auto index = graphVariables.Get(variable);
+			if (index != SettleCore::GraphVariableHandles::kUnresolved) {
+				a_state.*kGraphVariables[variable].field = values->wordVariableValues[index].value != 0;
+			} else {
+				a_player->GetGraphVariableBool(kGraphVariables[variable].name, a_state.*kGraphVariables[variable].field);
+			}
+		}
 	}
 	
 	void CameraSettleManager::Update(float a_delta)
 	{
-		auto* settings = Settings::GetSingleton();
+		const auto* settings = AcquireSettings();
+		
+		// Handled before any early-out so the menu can dump while the game is paused
+		replayRecorder.SetEnabled(settings->replayRecording);
+		if (replayDumpRequested.exchange(false)) {
+			if (!replayRecorder.IsEnabled()) {
+				logger::warn("[FPCameraSettle] Replay dump requested but the recorder is disabled");
+			} else {
+				std::time_t now = std::time(nullptr);
+				std::tm local{};
+				localtime_s(&local, &now);
+				char stamp[32];
+				std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &local);
+				auto path = fmt::format("Data/SKSE/Plugins/FPCameraSettle_Replay_{}.fpcr", stamp);
+				if (replayRecorder.Dump(path)) {
+					logger::info("[FPCameraSettle] Replay saved to {}", path);
+				} else {
+					logger::error("[FPCameraSettle] Failed to write replay {}", path);
+				}
+			}
+		}
+		
 		if (!settings->enabled) {
 			return;
 		}
@@ -1140,8 +898,16 @@ namespace CameraSettle
 		
 		debugFrameCounter++;
 		
+		// Everything below reads the engine through this, once per frame
+		const auto playerState = GatherPlayerState(player, a_delta);
+		
+		if (replayRecorder.IsEnabled()) {
+			replayRecorder.BeginFrame(SettleCore::ToInputFrame(playerState), springRig, idleNoise, actionStateMachine,
+				SettleCore::Replay::GetDetectorSettings(*settings));
+		}
+		
 		// Detect actions and apply impulses
-		DetectActions(player, a_delta);
+		DetectActions(playerState);
 		
 		// Update settling factor
 		timeSinceAction += a_delta;
@@ -1152,192 +918,150 @@ namespace CameraSettle
 			settlingFactor = 0.0f;
 		}
 		
-		// Get current weapon state for settings lookup
-		bool weaponDrawn = player->AsActorState()->IsWeaponDrawn();
+		// Current weapon state for settings lookup
+		bool weaponDrawn = playerState.weaponDrawn;
 		
 		// Update all springs with their respective settings
-		// Use a common settings template for spring updates
-		ActionSettings commonSettings;
-		commonSettings.stiffness = 100.0f;
-		commonSettings.damping = 8.0f;
-		commonSettings.positionStrength = 5.0f;
-		commonSettings.rotationStrength = 3.0f;
-		
-		// Use specific settings for each spring category
-		// Update pending blends (applies impulses smoothly over time)
-		UpdateBlend(movementSpring, movementBlend, a_delta);
-		UpdateBlend(jumpSpring, jumpBlend, a_delta);
-		UpdateBlend(sneakSpring, sneakBlend, a_delta);
-		UpdateBlend(hitSpring, hitBlend, a_delta);
-		UpdateBlend(archerySpring, archeryBlend, a_delta);
-		
-		// Update spring physics (pass settings pointer to avoid repeated singleton lookups)
-		if (currentMovementAction != ActionType::kTotal) {
-			const auto& moveSettings = settings->GetActionSettingsForState(currentMovementAction, weaponDrawn);
-			UpdateSpring(movementSpring, moveSettings, a_delta, settings);
-		} else {
-			UpdateSpring(movementSpring, commonSettings, a_delta, settings);
+		// Action whose settings drive each layer (kTotal = no movement, use the common template)
+		SettleCore::RigFrame rigFrame;
+		rigFrame.delta = a_delta;
+		rigFrame.layerActions[SettleCore::kMovementLayer] = actionStateMachine.MovementAction();
+		rigFrame.layerActions[SettleCore::kJumpLayer] = ActionType::Jump;
+		rigFrame.layerActions[SettleCore::kSneakLayer] = ActionType::Sneak;
+		rigFrame.layerActions[SettleCore::kHitLayer] = ActionType::TakingHit;
+		rigFrame.layerActions[SettleCore::kArcheryLayer] = ActionType::ArrowRelease;
+		for (int layer = 0; layer < SettleCore::kSpringLayerCount; ++layer) {
+			ActionType action = rigFrame.layerActions[layer];
+			rigFrame.layerSettings[layer] = action != ActionType::kTotal ?
+				&settings->GetActionSettingsForState(action, weaponDrawn) :
+				&COMMON_SETTINGS;
 		}
 		
-		UpdateSpring(jumpSpring, settings->GetActionSettingsForState(ActionType::Jump, weaponDrawn), a_delta, settings);
-		UpdateSpring(sneakSpring, settings->GetActionSettingsForState(ActionType::Sneak, weaponDrawn), a_delta, settings);
-		UpdateSpring(hitSpring, settings->GetActionSettingsForState(ActionType::TakingHit, weaponDrawn), a_delta, settings);
-		UpdateSpring(archerySpring, settings->GetActionSettingsForState(ActionType::ArrowRelease, weaponDrawn), a_delta, settings);
+		// Apply settling - increase damping when idle
+		rigFrame.dampingMult = 1.0f + (settlingFactor * (settings->settleDampingMult - 1.0f));
+		rigFrame.settingsVersion = settings->version;
+		rigFrame.integrator = static_cast<SpringIntegrator>(settings->springIntegrator);
+		rigFrame.substeps = settings->springSubsteps;
+		rigFrame.autoSubsteps = settings->autoSubsteps;
+		rigFrame.fixedStepRate = settings->fixedTimestep ? settings->fixedStepRate : 0;
+		rigFrame.maxFixedSteps = settings->maxFixedSteps;
+		rigFrame.weaponDrawn = weaponDrawn;
+		
+		// Blends + integration of every spring layer through the SoA bank (dormant layers are skipped)
+		replayRecorder.RecordStep(rigFrame, springRig);
+		std::uint32_t springMask = springRig.Step(rigFrame);
 		
 		// === UPDATE IDLE CAMERA NOISE ===
 		// This is truly additive: phase always advances, amplitude ramps smoothly
 		// No lerping toward a target - noise is calculated directly from phase * amplitude
+		SettleCore::IdleNoiseFrame noiseFrame;
 		{
-			// Check if player is in a state where idle noise should play
-			// IMPORTANT: We do NOT require springs to be inactive!
-			// The noise is truly additive, so it layers on top of settling springs smoothly.
-			// This prevents the "snap" that occurred when waiting for springs to finish.
-			auto* playerState = player->AsActorState();
+			noiseFrame.delta = a_delta;
+			noiseFrame.enabled = weaponDrawn ? settings->idleNoiseEnabledDrawn : settings->idleNoiseEnabledSheathed;
 			
-			bool isGrounded = !wasInAir && !player->IsInMidair();
-			bool isStandingStill = !wasMoving && !playerState->IsSprinting();
-			bool isNotInActiveAction = !playerState->IsSneaking() && !playerState->IsSwimming();
-			
-			// Check if in dialogue or map menu (both should disable idle noise if setting enabled)
-			bool isInDialogue = ui && ui->IsMenuOpen(RE::DialogueMenu::MENU_NAME);
-			bool isInMapMenu = ui && ui->IsMenuOpen(RE::MapMenu::MENU_NAME);
-			
-			// Idle noise can only start after sprint if EndAnimatedCameraDelta has fired
-			// Also disable if in dialogue/map and setting is enabled
-			bool dialogueBlocksNoise = settings->dialogueDisableIdleNoise && (isInDialogue || isInMapMenu);
-			
-			// Player is "idle enough" for noise when standing still and grounded
-			// Springs can still be settling - the noise is additive and will layer smoothly
-			bool shouldPlayIdleNoise = isGrounded && isStandingStill && isNotInActiveAction && 
-			                           idleNoiseAllowedAfterSprint && !dialogueBlocksNoise;
-			bool noiseEnabled = weaponDrawn ? settings->idleNoiseEnabledDrawn : settings->idleNoiseEnabledSheathed;
-			
-			// Determine if player is currently drawing a bow/crossbow
-			bool isArcheryDrawn = false;
-			if (settings->idleNoiseScaleDuringArchery) {
-				if (auto* weapon = player->GetEquippedObject(false)) {
-					if (auto* weap = weapon->As<RE::TESObjectWEAP>()) {
-						if (weap->IsBow() || weap->IsCrossbow()) {
-							auto attackState = playerState->GetAttackState();
-							switch (attackState) {
-							case RE::ATTACK_STATE_ENUM::kBowDraw:
-							case RE::ATTACK_STATE_ENUM::kBowAttached:
-							case RE::ATTACK_STATE_ENUM::kBowDrawn:
-							case RE::ATTACK_STATE_ENUM::kBowReleasing:
-							case RE::ATTACK_STATE_ENUM::kBowNextAttack:
-							case RE::ATTACK_STATE_ENUM::kBowFollowThrough:
-								isArcheryDrawn = true;
-								break;
-							default:
-								break;
-							}
-						}
-					}
-				}
-			}
+			// Get frequency for phase advancement (the phase ALWAYS advances, even when dormant)
+			noiseFrame.frequency = weaponDrawn ? settings->idleNoiseFrequencyDrawn : settings->idleNoiseFrequencySheathed;
 			
 			if (archeryReleaseTimer > 0.0f) {
 				archeryReleaseTimer = std::max(0.0f, archeryReleaseTimer - a_delta);
 			}
-			archeryDrawActive = isArcheryDrawn && archeryReleaseTimer <= 0.0f;
-			
-			// Log dialogue/map state transitions for debugging
-			bool inBlockingMenu = isInDialogue || isInMapMenu;
-			if (settings->debugLogging && inBlockingMenu != wasInDialogue) {
-				const char* menuName = isInDialogue ? "Dialogue" : (isInMapMenu ? "Map" : "Menu");
-				logger::info("[FPCameraSettle] {} menu: {} (noise {})", 
-					menuName,
-					inBlockingMenu ? "ENTERED" : "EXITED",
-					dialogueBlocksNoise ? "blocked" : "allowed");
-			}
-			wasInDialogue = inBlockingMenu;
-			
-			// Get frequency for phase advancement
-			float freq = weaponDrawn ? settings->idleNoiseFrequencyDrawn : settings->idleNoiseFrequencySheathed;
 			
-			// ALWAYS advance phase - the wave is always "there", just with zero amplitude when not idle
-			// This ensures smooth continuity when amplitude ramps up/down
-			idleNoisePhase += a_delta * freq * 2.0f * PI;
-			
-			// Keep phase bounded to avoid float precision issues over long play sessions
-			if (idleNoisePhase > 1000.0f * PI) {
-				idleNoisePhase = std::fmod(idleNoisePhase, 2.0f * PI);
-			}
-			
-			// Smoothly ramp amplitude up/down based on idle state
-			// This is the key to truly additive noise - only amplitude changes, not the wave itself
-			float targetAmplitude = (shouldPlayIdleNoise && noiseEnabled) ? 1.0f : 0.0f;
-			float rampSpeed = 3.0f / std::max(0.05f, settings->idleNoiseBlendTime);  // Match blend time
-			
-			if (idleNoiseAmplitude < targetAmplitude) {
-				idleNoiseAmplitude = std::min(idleNoiseAmplitude + rampSpeed * a_delta, targetAmplitude);
-			} else if (idleNoiseAmplitude > targetAmplitude) {
-				idleNoiseAmplitude = std::max(idleNoiseAmplitude - rampSpeed * a_delta, targetAmplitude);
-			}
-			
-			// Smoothly scale idle noise down while drawing a bow/crossbow
-			float targetArcheryScale = 1.0f;
-			if (settings->idleNoiseScaleDuringArchery && archeryDrawActive) {
-				if (settings->idleNoiseArcheryScaleBySkill) {
-					float archery = player->AsActorValueOwner()->GetActorValue(RE::ActorValue::kArchery);
-					float skillT = std::clamp(archery / 100.0f, 0.0f, 1.0f);
-					targetArcheryScale = std::clamp(1.0f - skillT, 0.0f, 1.0f);
-				} else {
-					targetArcheryScale = settings->idleNoiseArcheryScaleAmount;
+			// Dormant: noise disabled for this weapon state and fully faded out.
+			// Skip the state/equipment checks; UpdateIdleNoise skips the sine evaluation.
+			if (idleNoise.IsDormant(noiseFrame.enabled)) {
+				archeryDrawActive = false;
+			} else {
+				// Check if player is in a state where idle noise should play
+				// IMPORTANT: We do NOT require springs to be inactive!
+				// The noise is truly additive, so it layers on top of settling springs smoothly.
+				// This prevents the "snap" that occurred when waiting for springs to finish.
+				bool isGrounded = !actionStateMachine.InAir() && !playerState.inMidair;
+				bool isStandingStill = !actionStateMachine.Moving() && !playerState.sprinting;
+				bool isNotInActiveAction = !playerState.sneaking && !playerState.swimming;
+				
+				// Check if in dialogue or map menu (both should disable idle noise if setting enabled)
+				bool isInDialogue = playerState.dialogueOpen;
+				bool isInMapMenu = playerState.mapOpen;
+				
+				// Idle noise can only start after sprint if EndAnimatedCameraDelta has fired
+				// Also disable if in dialogue/map and setting is enabled
+				bool dialogueBlocksNoise = settings->dialogueDisableIdleNoise && (isInDialogue || isInMapMenu);
+				
+				// Player is "idle enough" for noise when standing still and grounded
+				// Springs can still be settling - the noise is additive and will layer smoothly
+				bool shouldPlayIdleNoise = isGrounded && isStandingStill && isNotInActiveAction && 
+				                           idleNoiseAllowedAfterSprint && !dialogueBlocksNoise;
+				
+				// Determine if player is currently drawing a bow/crossbow
+				bool isArcheryDrawn = settings->idleNoiseScaleDuringArchery && playerState.bowDrawn;
+				
+				archeryDrawActive = isArcheryDrawn && archeryReleaseTimer <= 0.0f;
+				
+				// Log dialogue/map state transitions for debugging
+				bool inBlockingMenu = isInDialogue || isInMapMenu;
+				if (settings->debugLogging && inBlockingMenu != wasInDialogue) {
+					const char* menuName = isInDialogue ? "Dialogue" : (isInMapMenu ? "Map" : "Menu");
+					logger::info("[FPCameraSettle] {} menu: {} (noise {})", 
+						menuName,
+						inBlockingMenu ? "ENTERED" : "EXITED",
+						dialogueBlocksNoise ? "blocked" : "allowed");
 				}
+				wasInDialogue = inBlockingMenu;
+				
+				// Smoothly ramp amplitude up/down based on idle state
+				// This is the key to truly additive noise - only amplitude changes, not the wave itself
+				noiseFrame.targetAmplitude = (shouldPlayIdleNoise && noiseFrame.enabled) ? 1.0f : 0.0f;
+				noiseFrame.rampSpeed = 3.0f / std::max(0.05f, settings->idleNoiseBlendTime);  // Match blend time
+				
+				// Smoothly scale idle noise down while drawing a bow/crossbow
+				noiseFrame.targetArcheryScale = 1.0f;
+				if (settings->idleNoiseScaleDuringArchery && archeryDrawActive) {
+					if (settings->idleNoiseArcheryScaleBySkill) {
+						float skillT = std::clamp(playerState.archerySkill / 100.0f, 0.0f, 1.0f);
+						noiseFrame.targetArcheryScale = std::clamp(1.0f - skillT, 0.0f, 1.0f);
+					} else {
+						noiseFrame.targetArcheryScale = settings->idleNoiseArcheryScaleAmount;
+					}
+				}
+				
+				// Get amplitude settings
+				noiseFrame.posAmp = weaponDrawn ?
+					Vec3{ settings->idleNoisePosAmpXDrawn, settings->idleNoisePosAmpYDrawn, settings->idleNoisePosAmpZDrawn } :
+					Vec3{ settings->idleNoisePosAmpXSheathed, settings->idleNoisePosAmpYSheathed, settings->idleNoisePosAmpZSheathed };
+				noiseFrame.rotAmpDeg = weaponDrawn ?
+					Vec3{ settings->idleNoiseRotAmpXDrawn, settings->idleNoiseRotAmpYDrawn, settings->idleNoiseRotAmpZDrawn } :
+					Vec3{ settings->idleNoiseRotAmpXSheathed, settings->idleNoiseRotAmpYSheathed, settings->idleNoiseRotAmpZSheathed };
 			}
 			
-			if (idleNoiseArcheryScale < targetArcheryScale) {
-				idleNoiseArcheryScale = std::min(idleNoiseArcheryScale + rampSpeed * a_delta, targetArcheryScale);
-			} else if (idleNoiseArcheryScale > targetArcheryScale) {
-				idleNoiseArcheryScale = std::max(idleNoiseArcheryScale - rampSpeed * a_delta, targetArcheryScale);
-			}
-			
-			// Calculate sine waves from continuous phase
-			float sin1 = std::sin(idleNoisePhase);
-			float sin2 = std::sin(idleNoisePhase * 1.37f + 1.2f);
-			float sin3 = std::sin(idleNoisePhase * 0.73f + 2.5f);
-			
-			// Get amplitude settings
-			float posX = weaponDrawn ? settings->idleNoisePosAmpXDrawn : settings->idleNoisePosAmpXSheathed;
-			float posY = weaponDrawn ? settings->idleNoisePosAmpYDrawn : settings->idleNoisePosAmpYSheathed;
-			float posZ = weaponDrawn ? settings->idleNoisePosAmpZDrawn : settings->idleNoisePosAmpZSheathed;
-			
-			float rotX = weaponDrawn ? settings->idleNoiseRotAmpXDrawn : settings->idleNoiseRotAmpXSheathed;
-			float rotY = weaponDrawn ? settings->idleNoiseRotAmpYDrawn : settings->idleNoiseRotAmpYSheathed;
-			float rotZ = weaponDrawn ? settings->idleNoiseRotAmpZDrawn : settings->idleNoiseRotAmpZSheathed;
-			
-			// Calculate noise DIRECTLY - no lerping toward a target!
-			// The amplitude smoothly ramps, so the noise smoothly appears/disappears
-			// This is truly additive: sine_value * max_amplitude * current_amplitude_factor
-			float finalAmplitude = idleNoiseAmplitude * idleNoiseArcheryScale;
-			idleNoiseOffset.x = sin1 * posX * finalAmplitude;
-			idleNoiseOffset.y = sin2 * posY * finalAmplitude;
-			idleNoiseOffset.z = sin3 * posZ * finalAmplitude;
-			
-			idleNoiseRotation.x = sin3 * rotX * DEG_TO_RAD * finalAmplitude;
-			idleNoiseRotation.y = sin1 * rotY * DEG_TO_RAD * finalAmplitude;
-			idleNoiseRotation.z = sin2 * rotZ * DEG_TO_RAD * finalAmplitude;
+			// Advance the phase, ramp, and calculate noise DIRECTLY - no lerping toward a target!
+			SettleCore::UpdateIdleNoise(idleNoise, noiseFrame);
 		}
 		
+		replayRecorder.EndFrame(rigFrame, noiseFrame, springRig, idleNoise);
+		
 		// === UPDATE SPRINT EFFECTS (FOV + BLUR) ===
 		{
 			// Early-out: skip if sprint effects disabled and no active effects to blend out
-			bool hasActiveSprintEffects = std::abs(currentFovOffset) > 0.001f || std::abs(currentBlurStrength) > 0.001f;
+			bool hasActiveSprintEffects = std::abs(currentFovOffset) > 0.001f || std::abs(currentBlurStrength) > 0.001f || blurEffectActive;
 			bool sprintEffectsEnabled = settings->sprintFovEnabled || settings->sprintBlurEnabled;
 			
-			if (!sprintEffectsEnabled && !hasActiveSprintEffects) {
-				// Nothing to do - skip this section entirely
-			} else {
-				// Only check actual sprint state when we need to (effects enabled or blending out)
-				auto* playerState = player->AsActorState();
-				bool actuallySprintingNow = playerState && playerState->IsSprinting() && !player->IsInMidair();
+			// Only check actual sprint state when we need to (effects enabled or blending out)
+			bool isSprinting = false;
+			if (sprintEffectsEnabled || hasActiveSprintEffects) {
+				bool actuallySprintingNow = playerState.sprinting && !playerState.inMidair;
 				
 				// Sprint effects deactivate when EndAnimatedCameraDelta fires AND player stopped sprinting
-				bool isSprinting = actuallySprintingNow && !sprintStopTriggeredByAnim;
+				isSprinting = actuallySprintingNow && !actionStateMachine.SprintStopAnimated();
+			}
+			
+			if (!isSprinting && !hasActiveSprintEffects) {
+				// Nothing to blend in or out - skip this section entirely (no IMOD writes)
+				currentFovOffset = 0.0f;
+				currentBlurStrength = 0.0f;
+			} else {
 
 				// Capture base FOV exactly when sprint starts to prevent punch drift
-				if (isSprinting && !wasSprinting && baseFovReady) {
+				if (isSprinting && !actionStateMachine.Sprinting() && baseFovReady) {
 					if (auto* playerCamera = RE::PlayerCamera::GetSingleton()) {
 						float currentNoPunch = playerCamera->worldFOV - currentFovPunchOffset;
 						baseFov = currentNoPunch;
@@ -1431,30 +1155,40 @@ namespace CameraSettle
 				fovPunchActive = false;
 				fovPunchValue = 0.0f;
 			} else {
-				constexpr float PHASE1 = 0.4f;  // In -> overshoot
-				float value = 0.0f;
-				
-				if (t < PHASE1) {
-					float u = SmoothStep(t / PHASE1);
-					value = -1.0f + (2.0f * u);  // -1 to +1
-				} else {
-					float u = SmoothStep((t - PHASE1) / (1.0f - PHASE1));
-					value = 1.0f + (-1.0f * u);  // +1 to 0
-				}
-				fovPunchValue = value;
+				fovPunchValue = SettleCore::FovPunchCurve(t);
 			}
 		}
 		
+		// Track what is still moving so dormant work (and ApplyCameraOffset) can be skipped
+		activityMask = springMask;
+		if (idleNoise.amplitude > 0.0f) {
+			activityMask |= SettleCore::Activity::kIdleNoise;
+		}
+		if (currentFovOffset != 0.0f || currentBlurStrength != 0.0f || blurEffectActive) {
+			activityMask |= SettleCore::Activity::kSprintEffects;
+		}
+		if (fovPunchActive) {
+			activityMask |= SettleCore::Activity::kFovPunch;
+		}
+		
+		++activityStatFrames;
+		if (activityMask == 0) {
+			++quiescentFrames;
+		}
+		if (activityStatFrames >= ACTIVITY_LOG_INTERVAL) {
+			if (settings->debugLogging) {
+				logger::info("[FPCameraSettle] Quiescent frames: {}/{} ({:.1f}%)",
+					quiescentFrames, activityStatFrames, 100.0f * static_cast<float>(quiescentFrames) / static_cast<float>(activityStatFrames));
+			}
+			activityStatFrames = 0;
+			quiescentFrames = 0;
+		}
+		
 		// Debug logging
 		if (settings->debugLogging && debugFrameCounter % 60 == 0) {
-			bool anyActive = movementSpring.IsActive() || jumpSpring.IsActive() || 
-			                 sneakSpring.IsActive() || hitSpring.IsActive() || archerySpring.IsActive();
+			bool anyActive = (springMask & SettleCore::Activity::kSpringLayers) != 0;
 			if (anyActive) {
-				RE::NiPoint3 totalPos = {
-					movementSpring.positionOffset.x + jumpSpring.positionOffset.x + sneakSpring.positionOffset.x + hitSpring.positionOffset.x + archerySpring.positionOffset.x,
-					movementSpring.positionOffset.y + jumpSpring.positionOffset.y + sneakSpring.positionOffset.y + hitSpring.positionOffset.y + archerySpring.positionOffset.y,
-					movementSpring.positionOffset.z + jumpSpring.positionOffset.z + sneakSpring.positionOffset.z + hitSpring.positionOffset.z + archerySpring.positionOffset.z
-				};
+				Vec3 totalPos = springRig.bank.TotalPosition();
 				logger::info("[FPCameraSettle] Total offset: pos=({:.2f},{:.2f},{:.2f}) settling={:.2f}",
 					totalPos.x, totalPos.y, totalPos.z, settlingFactor);
 			}
@@ -1467,8 +1201,13 @@ namespace CameraSettle
 			return;
 		}
 		
+		// Nothing to apply while every spring layer is dormant and idle noise is faded out
+		if ((activityMask & (SettleCore::Activity::kSpringLayers | SettleCore::Activity::kIdleNoise)) == 0) {
+			return;
+		}
+		
 		// Skip applying offsets when game is paused (if resetOnPause is enabled)
-		auto* settings = Settings::GetSingleton();
+		const auto* settings = AcquireSettings();
 		if (settings->resetOnPause) {
 			auto* ui = RE::UI::GetSingleton();
 			if (ui && (ui->GameIsPaused() || ui->numPausesGame > 0)) {
@@ -1476,18 +1215,13 @@ namespace CameraSettle
 			}
 		}
 		
-		// Combine all spring offsets + idle noise
-		RE::NiPoint3 totalPosOffset = {
-			movementSpring.positionOffset.x + jumpSpring.positionOffset.x + sneakSpring.positionOffset.x + hitSpring.positionOffset.x + archerySpring.positionOffset.x + idleNoiseOffset.x,
-			movementSpring.positionOffset.y + jumpSpring.positionOffset.y + sneakSpring.positionOffset.y + hitSpring.positionOffset.y + archerySpring.positionOffset.y + idleNoiseOffset.y,
-			movementSpring.positionOffset.z + jumpSpring.positionOffset.z + sneakSpring.positionOffset.z + hitSpring.positionOffset.z + archerySpring.positionOffset.z + idleNoiseOffset.z
-		};
-		
-		RE::NiPoint3 totalRotOffset = {
-			movementSpring.rotationOffset.x + jumpSpring.rotationOffset.x + sneakSpring.rotationOffset.x + hitSpring.rotationOffset.x + archerySpring.rotationOffset.x + idleNoiseRotation.x,
-			movementSpring.rotationOffset.y + jumpSpring.rotationOffset.y + sneakSpring.rotationOffset.y + hitSpring.rotationOffset.y + archerySpring.rotationOffset.y + idleNoiseRotation.y,
-			movementSpring.rotationOffset.z + jumpSpring.rotationOffset.z + sneakSpring.rotationOffset.z + hitSpring.rotationOffset.z + archerySpring.rotationOffset.z + idleNoiseRotation.z
-		};
+		// Combine all spring offsets (summed by the spring bank pass) + idle noise
+		// In fixed-timestep mode the springs are blended between the last two steps
+		Vec3 combinedPos;
+		Vec3 combinedRot;
+		SettleCore::CombineOffsets(springRig, idleNoise, combinedPos, combinedRot);
+		RE::NiPoint3 totalPosOffset = { combinedPos.x, combinedPos.y, combinedPos.z };
+		RE::NiPoint3 totalRotOffset = { combinedRot.x, combinedRot.y, combinedRot.z };
 		
 		// OPTIMIZATION: Use squared magnitudes to avoid sqrt
 		constexpr float MIN_POS_SQ = 0.001f * 0.001f;  // 0.000001
@@ -1571,7 +1305,7 @@ namespace CameraSettle
 				// Smoothly return to base FOV if needed
 				float currentFov = a_camera->worldFOV;
 				if (std::abs(currentFov - baseFov) > 0.01f) {
-					float blendFactor = 1.0f - std::pow(1.0f - std::min(Settings::GetSingleton()->sprintFovBlendSpeed * lastDeltaTime, 0.99f), 1.0f);
+					float blendFactor = 1.0f - std::pow(1.0f - std::min(settings->sprintFovBlendSpeed * lastDeltaTime, 0.99f), 1.0f);
 					a_camera->worldFOV = currentFov + (baseFov - currentFov) * blendFactor;
 				}
 			}
@@ -1585,63 +1319,33 @@ namespace CameraSettle
 	
 	void CameraSettleManager::Reset()
 	{
-		movementSpring.Reset();
-		jumpSpring.Reset();
-		sneakSpring.Reset();
-		hitSpring.Reset();
-		archerySpring.Reset();
-		
-		// Reset pending blends
-		movementBlend.Reset();
-		jumpBlend.Reset();
-		sneakBlend.Reset();
-		hitBlend.Reset();
-		archeryBlend.Reset();
-		
-		currentMovementAction = ActionType::kTotal;
-		lastMovementAction = ActionType::kTotal;
-		wasWeaponDrawn = false;
-		wasSprinting = false;
-		wasSneaking = false;
-		wasInAir = false;
-		wasMoving = false;
-		walkRunBlend = 0.0f;
-		wasWalking = true;
-		airTime = 0.0f;
-		landingCooldown = 0.0f;
-		movementDebounce = 0.0f;
+		// Springs, pending blends, bank totals and the fixed-step clock
+		springRig.Reset();
+		activityMask = 0;
+		replayRecorder.RequestKeyframe();
+		
+		actionStateMachine.Reset();
+		movementCoords = {};
+		weaponStateBlend = 0.0f;
+		sneakStateBlend = 0.0f;
 		settlingFactor = 0.0f;
 		timeSinceAction = 0.0f;
 		hitCooldown = 0.0f;
 		debugFrameCounter = 0;
-		sprintStopTriggeredByAnim = false;
 		idleNoiseAllowedAfterSprint = true;
 		
-		// Reset speed-based blending state
-		currentSpeed = 0.0f;
-		speedBlend = 0.0f;
-		movementStartTime = 0.0f;
-		wasMovingForGrace = false;
-		walkImpulseBlocked = false;
-		
-		// Reset jump detection state
-		didJump = false;
-		jumpStartZ = 0.0f;
-		
 		// Reset performance caches
 		cachedNiCamera = nullptr;
 		cachedCameraNode = nullptr;
-		lastWalkRunBlend = -1.0f;  // Force recalculation
-		lastBlendWeaponDrawn = false;
-		hotReloadTimer = 0.0f;
+		graphVariables.Clear();  // Resolved again against whichever graph is active next
 		
 		// Reset idle noise state
-		// Note: We don't reset idleNoisePhase - it continues smoothly
+		// Note: We don't reset the phase - it continues smoothly
 		// Only reset the amplitude so noise fades out naturally
-		idleNoiseAmplitude = 0.0f;
-		idleNoiseArcheryScale = 1.0f;
-		idleNoiseOffset = { 0.0f, 0.0f, 0.0f };
-		idleNoiseRotation = { 0.0f, 0.0f, 0.0f };
+		idleNoise.amplitude = 0.0f;
+		idleNoise.archeryScale = 1.0f;
+		idleNoise.offset = { 0.0f, 0.0f, 0.0f };
+		idleNoise.rotation = { 0.0f, 0.0f, 0.0f };
 		wasInDialogue = false;
 		archeryDrawActive = false;
 		archeryReleaseTimer = 0.0f;
@@ -1709,15 +1413,9 @@ namespace CameraSettle
 				// Clamp delta to reasonable range
 				delta = std::clamp(delta, 0.001f, 0.1f);
 				
-				// OPTIMIZATION: Hot reload timer check moved here (avoid function call overhead)
+				// Hot reload: picks up settings the INI watcher thread has already parsed
 				auto* manager = CameraSettleManager::GetSingleton();
-				auto* settings = Settings::GetSingleton();
-				
-				manager->hotReloadTimer += delta;
-				if (settings->enableHotReload && manager->hotReloadTimer >= settings->hotReloadIntervalSec) {
-					manager->hotReloadTimer = 0.0f;
-					settings->CheckForReload(delta);
-				}
+				Settings::GetSingleton()->CheckForReload();
 				
 				// Update camera settle physics
 				manager->Update(delta);
@@ -1858,9 +1556,24 @@ namespace CameraSettle
 			logger::info("[FPCameraSettle] Registered for hit events");
 		}
 		
+		// Register for input (profile hotkey)
+		auto* inputManager = RE::BSInputDeviceManager::GetSingleton();
+		if (inputManager) {
+			inputManager->AddEventSink<RE::InputEvent*>(CameraSettleManager::GetSingleton());
+			logger::info("[FPCameraSettle] Registered for input events");
+		}
+		
+		// Register for menus (flush pending saves before quitting)
+		auto* ui = RE::UI::GetSingleton();
+		if (ui) {
+			ui->AddEventSink<RE::MenuOpenCloseEvent>(CameraSettleManager::GetSingleton());
+			logger::info("[FPCameraSettle] Registered for menu events");
+		}
+		
 		// Register Precision hit callback if available
 		CameraSettleManager::GetSingleton()->RegisterPrecisionAPI();
 		
+		logger::info("[FPCameraSettle] Spring kernel: {}", SettleCore::GetSpringKernelName(SettleCore::GetSpringKernel()));
 		logger::info("[FPCameraSettle] Camera settle system installed");
 	}
 }
@@ -1,70 +1,29 @@
 #pragma once
 
+#include "Core/ActionStateMachine.h"
+#include "Core/ActionTraits.h"
+#include "Core/AnimEvents.h"
+#include "Core/BlendSpace.h"
+#include "Core/GraphVariables.h"
+#include "Core/PlayerState.h"
+#include "Core/Replay.h"
+#include "Core/SettingsIni.h"
+#include "Core/SettleCore.h"
+#include "Core/SpringRig.h"
 #include "Settings.h"
 #include "PrecisionAPI.h"
 
 namespace CameraSettle
 {
-	// Spring state for tracking camera offset
-	struct SpringState
-	{
-		// Position offset
-		RE::NiPoint3 positionOffset{ 0.0f, 0.0f, 0.0f };
-		RE::NiPoint3 positionVelocity{ 0.0f, 0.0f, 0.0f };
-		
-		// Rotation offset (euler angles in radians)
-		RE::NiPoint3 rotationOffset{ 0.0f, 0.0f, 0.0f };
-		RE::NiPoint3 rotationVelocity{ 0.0f, 0.0f, 0.0f };
-		
-		void Reset()
-		{
-			positionOffset = { 0.0f, 0.0f, 0.0f };
-			positionVelocity = { 0.0f, 0.0f, 0.0f };
-			rotationOffset = { 0.0f, 0.0f, 0.0f };
-			rotationVelocity = { 0.0f, 0.0f, 0.0f };
-		}
-		
-		bool IsActive() const
-		{
-			constexpr float THRESHOLD = 0.0001f;
-			return std::abs(positionOffset.x) > THRESHOLD ||
-			       std::abs(positionOffset.y) > THRESHOLD ||
-			       std::abs(positionOffset.z) > THRESHOLD ||
-			       std::abs(rotationOffset.x) > THRESHOLD ||
-			       std::abs(rotationOffset.y) > THRESHOLD ||
-			       std::abs(rotationOffset.z) > THRESHOLD ||
-			       std::abs(positionVelocity.x) > THRESHOLD ||
-			       std::abs(positionVelocity.y) > THRESHOLD ||
-			       std::abs(positionVelocity.z) > THRESHOLD;
-		}
-	};
-	
-	// Pending blend state for smooth impulse application
-	struct PendingBlend
-	{
-		bool active{ false };
-		float progress{ 0.0f };      // 0 to 1
-		float duration{ 0.1f };      // Blend time in seconds
-		float multiplier{ 1.0f };    // Total multiplier for this impulse
-		
-		// Target impulse values
-		RE::NiPoint3 posImpulse{ 0.0f, 0.0f, 0.0f };
-		RE::NiPoint3 rotImpulse{ 0.0f, 0.0f, 0.0f };
-		
-		void Reset()
-		{
-			active = false;
-			progress = 0.0f;
-			duration = 0.1f;
-			multiplier = 1.0f;
-			posImpulse = { 0.0f, 0.0f, 0.0f };
-			rotImpulse = { 0.0f, 0.0f, 0.0f };
-		}
-	};
+	using SettleCore::PendingBlend;
+	using SettleCore::SpringState;
+	using SettleCore::Vec3;
 
 	class CameraSettleManager : 
 		public RE::BSTEventSink<RE::TESHitEvent>,
-		public RE::BSTEventSink<RE::BSAnimationGraphEvent>
+		public RE::BSTEventSink<RE::BSAnimationGraphEvent>,
+		public RE::BSTEventSink<RE::InputEvent*>,
+		public RE::BSTEventSink<RE::MenuOpenCloseEvent>
 	{
 	public:
 		static CameraSettleManager* GetSingleton()
@@ -73,9 +32,6 @@ namespace CameraSettle
 			return &singleton;
 		}
 		
-		// Hot reload timer (public for hook access)
-		float hotReloadTimer{ 0.0f };
-		
 		// Main update called from hook
 		void Update(float a_delta);
 		
@@ -91,11 +47,20 @@ namespace CameraSettle
 		// Event handling for hit detection
 		RE::BSEventNotifyControl ProcessEvent(const RE::TESHitEvent* a_event, RE::BSTEventSource<RE::TESHitEvent>* a_eventSource) override;
 		
-		// Event handling for animation events (arrow release, etc.)
+		// Event handling for animation events (arrow release, sprint stop and [AnimationEvents] bindings)
 		RE::BSEventNotifyControl ProcessEvent(const RE::BSAnimationGraphEvent* a_event, RE::BSTEventSource<RE::BSAnimationGraphEvent>* a_eventSource) override;
 		
+		// Event handling for input (profile hotkey)
+		RE::BSEventNotifyControl ProcessEvent(RE::InputEvent* const* a_event, RE::BSTEventSource<RE::InputEvent*>* a_eventSource) override;
+		
+		// Event handling for menus (finishes pending INI saves before the player can quit)
+		RE::BSEventNotifyControl ProcessEvent(const RE::MenuOpenCloseEvent* a_event, RE::BSTEventSource<RE::MenuOpenCloseEvent>* a_eventSource) override;
+		
 		// Trigger a specific action effect
 		void TriggerAction(ActionType a_action);
+		
+		// Write the replay ring to disk on the next Update (safe to call from the menu)
+		void RequestReplayDump();
 
 	private:
 		CameraSettleManager() = default;
@@ -105,77 +70,90 @@ namespace CameraSettle
 		CameraSettleManager& operator=(const CameraSettleManager&) = delete;
 		CameraSettleManager& operator=(CameraSettleManager&&) = delete;
 		
-		// Action detection
-		void DetectActions(RE::PlayerCharacter* a_player, float a_delta);
+		// Action detection from this frame's player state (no engine queries)
+		void DetectActions(const SettleCore::PlayerStateSnapshot& a_state);
 		
-		// Movement action detection
-		ActionType DetectMovementAction(RE::PlayerCharacter* a_player);
+		// Apply a resolved impulse scaled by a_scale (starts a blend if blendTime > 0)
+		void ApplyImpulse(SpringState& a_state, PendingBlend& a_blend, const SettleCore::ResolvedImpulse& a_impulse, float a_scale, const SettingsData* a_globalSettings);
 		
-		// Update spring physics (pass settings pointer to avoid repeated singleton lookup)
-		void UpdateSpring(SpringState& a_state, const ActionSettings& a_settings, float a_delta, Settings* a_globalSettings);
+		// Latest published settings; swaps in a new snapshot and drops the caches built from the old one.
+		// Game thread only (Update, ApplyCameraOffset): event sinks and callbacks can run on other threads,
+		// so they hold their own Settings::GetSnapshot() reference instead of swapping this one under Update.
+		const SettingsSnapshot* AcquireSettings();
 		
-		// Apply impulse to spring (starts a blend if blendTime > 0)
-		void ApplyImpulse(SpringState& a_state, PendingBlend& a_blend, const ActionSettings& a_settings, float a_multiplier, Settings* a_globalSettings);
+		// Marks the cached impulses built from a_changed sections for rebuilding, and rebuilds the blend space
+		// and the animation event table if they read them. Only AcquireSettings calls it (game thread).
+		void InvalidateSettingsCaches(SettleCore::SettingsIni::SectionMask a_changed);
+		
+		// Animation event tags by interned identity; tags keeps the pool entries the table's keys point at alive
+		struct AnimEventRouting
+		{
+			SettleCore::AnimEventTable table;
+			std::vector<RE::BSFixedString> tags;
+		};
+		
+		// A new table with the built-in tags and a_settings' [AnimationEvents] bindings interned into it
+		static std::shared_ptr<const AnimEventRouting> BuildAnimEventTable(const SettingsData& a_settings);
+		
+		// Apply one frame's detected commands to their spring layers, in order
+		void ApplyActionFrame(const SettleCore::ActionFrame& a_frame, bool a_weaponDrawn, const SettingsData* a_globalSettings);
+		
+		// Apply an action's impulse, resolved from a_globalSettings, to the spring layer its category drives
+		void ApplyActionImpulse(ActionType a_action, bool a_weaponDrawn, const SettingsData* a_globalSettings);
+		
+		// Resolved impulse for an action in a weapon state (re-resolved only after its settings change).
+		// Game thread only: it fills impulseTable from settingsSnapshot.
+		const SettleCore::ResolvedImpulse& GetImpulse(ActionType a_type, bool a_weaponDrawn);
+		
+		// The same impulse resolved from a_settings without touching the shared table (event sinks)
+		static SettleCore::ResolvedImpulse ResolveImpulse(ActionType a_type, bool a_weaponDrawn, const SettingsData& a_settings);
 		
-		// Update pending blend and apply impulse incrementally
-		void UpdateBlend(SpringState& a_state, PendingBlend& a_blend, float a_delta);
-
 		// Start a FOV punch sequence
-		void StartFovPunch(float a_strengthPercent);
+		void StartFovPunch(float a_strengthPercent, const SettingsData* a_globalSettings);
 
 		void OnPrecisionHit(const PRECISION_API::PrecisionHitData& a_hitData, const RE::HitData& a_hitDataVanilla);
 		
+		// Every engine value one Update() reads, queried once (also what the replay recorder stores)
+		SettleCore::PlayerStateSnapshot GatherPlayerState(RE::PlayerCharacter* a_player, float a_delta);
+		
+		// Every kGraphVariables row into a_state, through handles resolved once per behavior graph
+		void ReadGraphVariables(RE::PlayerCharacter* a_player, SettleCore::PlayerStateSnapshot& a_state);
+		
+		// All spring layers, their blends, the SoA bank and the fixed-step clock
+		SettleCore::SpringRig springRig;
+		
 		// Springs for different action categories (combined additively)
-		SpringState movementSpring;   // Walk/run/sprint
-		SpringState jumpSpring;       // Jump/land
-		SpringState sneakSpring;      // Sneak/unsneak
-		SpringState hitSpring;        // Taking hits and hitting
-		SpringState archerySpring;    // Arrow release
+		SpringState& movementSpring{ springRig.springs[SettleCore::kMovementLayer] };  // Walk/run/sprint
+		SpringState& jumpSpring{ springRig.springs[SettleCore::kJumpLayer] };          // Jump/land
+		SpringState& sneakSpring{ springRig.springs[SettleCore::kSneakLayer] };        // Sneak/unsneak
+		SpringState& hitSpring{ springRig.springs[SettleCore::kHitLayer] };            // Taking hits and hitting
+		SpringState& archerySpring{ springRig.springs[SettleCore::kArcheryLayer] };    // Arrow release
+		
+		// Recent frames for offline replay (settle_replay)
+		SettleCore::Replay::Recorder replayRecorder;
+		std::atomic<bool> replayDumpRequested{ false };
+		
+		// SettleCore::Activity bits from the last Update (0 = fully quiescent frame)
+		std::uint32_t activityMask{ 0 };
+		std::uint32_t activityStatFrames{ 0 };
+		std::uint32_t quiescentFrames{ 0 };
 		
 		// Pending blends for each spring
-		PendingBlend movementBlend;
-		PendingBlend jumpBlend;
-		PendingBlend sneakBlend;
-		PendingBlend hitBlend;
-		PendingBlend archeryBlend;
+		PendingBlend& movementBlend{ springRig.blends[SettleCore::kMovementLayer] };
+		PendingBlend& jumpBlend{ springRig.blends[SettleCore::kJumpLayer] };
+		PendingBlend& sneakBlend{ springRig.blends[SettleCore::kSneakLayer] };
+		PendingBlend& hitBlend{ springRig.blends[SettleCore::kHitLayer] };
+		PendingBlend& archeryBlend{ springRig.blends[SettleCore::kArcheryLayer] };
 		
-		// Active action tracking
-		ActionType currentMovementAction{ ActionType::kTotal };
-		ActionType lastMovementAction{ ActionType::kTotal };
+		// Sneak/jump/land/sprint/walk/run transitions (owns the edge state, cooldowns and walk/run blend)
+		SettleCore::ActionStateMachine actionStateMachine;
 		
 		// State tracking
 		bool isInFirstPerson{ false };
-		bool wasWeaponDrawn{ false };
 		bool wasGamePaused{ false };
-		bool wasSprinting{ false };
-		bool wasSneaking{ false };
-		bool wasInAir{ false };
-		bool wasMoving{ false };
 		bool baseFovReady{ false };
 		float lastDeltaTime{ 0.016f };
 		
-		// Jump tracking
-		float airTime{ 0.0f };
-		float landingCooldown{ 0.0f };
-		
-		// Movement debounce (to trigger only on movement start/stop)
-		float movementDebounce{ 0.0f };
-		
-		// Walk/Run blend factor (0.0 = pure walk, 1.0 = pure run)
-		float walkRunBlend{ 0.0f };
-		bool wasWalking{ true };  // Track previous walk/run state
-		
-		// Speed-based blending state
-		float currentSpeed{ 0.0f };          // Current movement speed (0-1 normalized)
-		float speedBlend{ 0.0f };            // Blend factor based on actual speed
-		float movementStartTime{ 0.0f };     // Time when movement started (for grace period)
-		bool wasMovingForGrace{ false };     // Track if we were moving (for grace period)
-		bool walkImpulseBlocked{ false };    // If true, block walk impulse (accelerating to run)
-		
-		// Jump detection state
-		bool didJump{ false };               // True if player actually jumped (not just walked off ledge)
-		float jumpStartZ{ 0.0f };            // Z position when leaving ground (for fall distance)
-		
 		// Settling factor
 		float settlingFactor{ 0.0f };
 		float timeSinceAction{ 0.0f };
@@ -189,32 +167,36 @@ namespace CameraSettle
 		// Animation event registration
 		bool animEventRegistered{ false };
 		
-		// Sprint stop tracking (for anim event vs state fallback)
-		bool sprintStopTriggeredByAnim{ false };
-		
 		// Idle noise from sprint - only allow after EndAnimatedCameraDelta fires
 		bool idleNoiseAllowedAfterSprint{ true };
 		
 		// === PERFORMANCE CACHES ===
+		// Settings snapshot in use; held so the menu can publish a new one without freeing it mid-frame
+		std::shared_ptr<const SettingsSnapshot> settingsSnapshot;
+		
 		// Cached NiCamera pointer (avoid RTTI cast every frame)
 		RE::NiCamera* cachedNiCamera{ nullptr };
 		RE::NiNode* cachedCameraNode{ nullptr };
 		
-		// Cached blended movement settings (avoid creating new ActionSettings every frame)
-		ActionSettings cachedBlendedWalkRun[4];  // Forward, Backward, Left, Right
-		float lastWalkRunBlend{ -1.0f };         // Track when to recalculate
-		bool lastBlendWeaponDrawn{ false };
-		uint32_t lastSettingsVersion{ 0 };       // Track settings changes for cache invalidation
+		// Walk/run impulses over speed, direction, weapon and sneak state (rebuilt when their settings change)
+		SettleCore::MovementBlendSpace movementBlendSpace;
+		SettleCore::BlendCoords movementCoords;  // Where movement impulses are sampled; direction holds the last moving input
+		float weaponStateBlend{ 0.0f };          // Eases to 1 when the weapon is drawn, 0 when sheathed
+		float sneakStateBlend{ 0.0f };           // Eases to 1 while sneaking
+		
+		// Watched graph variables' indices in the player's active behavior graph
+		SettleCore::GraphVariableHandles graphVariables;
+		
+		// Published by Update, read by the animation event sink (possibly on another thread)
+		std::atomic<std::shared_ptr<const AnimEventRouting>> animEventRouting;
+		
+		// Every action's impulse with globalIntensity and the weapon state multiplier folded in
+		SettleCore::ResolvedImpulse impulseTable[2][static_cast<int>(ActionType::kTotal)];  // [weaponDrawn][action]
+		SettleCore::SettingsIni::SectionMask staleImpulses{ SettleCore::SettingsIni::kActionSections };  // Entries to resolve again, by INI section
 		
 		// === IDLE NOISE STATE ===
-		// Phase advances continuously (never resets) - the "wave" is always there
-		float idleNoisePhase{ 0.0f };            // Continuous phase, never reset abruptly
-		// Amplitude ramps smoothly when entering/exiting idle (0 to 1)
-		float idleNoiseAmplitude{ 0.0f };        // Current amplitude multiplier
-		float idleNoiseArcheryScale{ 1.0f };     // Current archery scaling multiplier
-		// Final noise values (calculated directly, no lerping)
-		RE::NiPoint3 idleNoiseOffset{ 0.0f, 0.0f, 0.0f };    // Current position noise offset
-		RE::NiPoint3 idleNoiseRotation{ 0.0f, 0.0f, 0.0f };  // Current rotation noise offset
+		// Phase advances continuously (never resets), amplitude ramps when entering/exiting idle
+		SettleCore::IdleNoiseState idleNoise;
 		bool wasInDialogue{ false };             // Track dialogue state for transitions
 		bool archeryDrawActive{ false };
 		float archeryReleaseTimer{ 0.0f };
@@ -0,0 +1,51 @@
+#include "Core/ActionSettings.h"
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#	define ACTION_SETTINGS_SSE 1
+#	include <xmmintrin.h>
+#else
+#	define ACTION_SETTINGS_SSE 0
+#endif
+
+// Blend loads and stores values as aligned 4-float vectors
+static_assert(offsetof(ActionSettings, values) % 16 == 0);
+static_assert(ActionSettings::kFloatCount % 4 == 0, "Blend works in whole 4-float vectors");
+
+void ActionSettings::CopyFrom(const ActionSettings& other)
+{
+	*this = other;
+}
+
+ActionSettings ActionSettings::Blend(const ActionSettings& a, const ActionSettings& b, float t)
+{
+	t = std::clamp(t, 0.0f, 1.0f);
+	float invT = 1.0f - t;
+
+	ActionSettings result;
+	// Use the enabled state of whichever has higher weight, or both if equal
+	result.enabled = t < 0.5f ? a.enabled : b.enabled;
+	result.integrator = t < 0.5f ? a.integrator : b.integrator;
+
+	// a * (1 - t) + b * t on every float, same operations as the scalar form so results match bit for bit
+	const float* from = a.values;
+	const float* to = b.values;
+	float* out = result.values;
+#if ACTION_SETTINGS_SSE
+	const __m128 weightA = _mm_set1_ps(invT);
+	const __m128 weightB = _mm_set1_ps(t);
+	for (int i = 0; i < kFloatCount; i += 4) {
+		_mm_store_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_load_ps(from + i), weightA), _mm_mul_ps(_mm_load_ps(to + i), weightB)));
+	}
+#else
+	for (int i = 0; i < kFloatCount; ++i) {
+		out[i] = from[i] * invT + to[i] * t;
+	}
+#endif
+
+	// Neither side's bound holds for the blended stiffness/damping; leave it to be computed per frame
+	result.maxStableStep = 0.0f;
+	return result;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+
+// Action types that trigger camera settle effects
+enum class ActionType : int
+{
+	WalkForward = 0,
+	WalkBackward,
+	WalkLeft,
+	WalkRight,
+	RunForward,
+	RunBackward,
+	RunLeft,
+	RunRight,
+	SprintForward,
+	// Sneak movement actions
+	SneakWalkForward,
+	SneakWalkBackward,
+	SneakWalkLeft,
+	SneakWalkRight,
+	SneakRunForward,
+	SneakRunBackward,
+	SneakRunLeft,
+	SneakRunRight,
+	// Other actions
+	Jump,
+	Land,
+	Sneak,
+	UnSneak,
+	TakingHit,
+	Hitting,
+	ArrowRelease,  // Bow/crossbow shot
+	kTotal
+};
+
+// How spring layers are integrated each frame
+enum class SpringIntegrator : int
+{
+	Euler = 0,     // Semi-implicit (symplectic) Euler with sub-steps (springSubsteps)
+	ClosedForm,    // Exact damped-oscillator solution, one step per frame
+	ImplicitEuler, // Backward Euler, one step per frame; unconditionally stable, slightly over-damped
+	Verlet,        // Velocity Verlet with Euler's sub-steps; second order, same stability limit as Euler
+	kTotal
+};
+
+// Settings for a specific action type.
+//
+// The twelve blendable values are stored as one 16-byte aligned float array
+// (values, indexed by FloatIndex and read through the named accessors), so
+// Blend and copies work on whole SIMD vectors; the integer and flag fields
+// follow. One entry is exactly one 64-byte cache line.
+struct ActionSettings
+{
+	enum FloatIndex : int
+	{
+		kMultiplier = 0,    // Per-action intensity multiplier (0-10x)
+		kBlendTime,         // Time to blend impulse into spring (0 = instant, up to 1.0 sec)
+		kStiffness,         // Spring stiffness (higher = faster return)
+		kDamping,           // Damping coefficient (higher = less oscillation)
+		kPositionStrength,  // Position offset strength
+		kRotationStrength,  // Rotation offset strength (degrees)
+		kImpulseX,          // Initial impulse direction X
+		kImpulseY,          // Initial impulse direction Y (forward/back)
+		kImpulseZ,          // Initial impulse direction Z (up/down)
+		kRotImpulseX,       // Initial rotation impulse (pitch)
+		kRotImpulseY,       // Initial rotation impulse (yaw)
+		kRotImpulseZ,       // Initial rotation impulse (roll)
+		kFloatCount
+	};
+
+	alignas(16) float values[kFloatCount]{ 1.0f, 0.1f, 100.0f, 8.0f, 5.0f, 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+	float maxStableStep{ 0.0f };     // Largest stable Euler step at full settle damping (derived on load/edit, 0 = compute per frame)
+	int   integrator{ -1 };          // SpringIntegrator for this action (-1 = global iSpringIntegrator)
+	bool  enabled{ true };           // Enable settle effect for this action
+
+	float& Multiplier() { return values[kMultiplier]; }
+	float& BlendTime() { return values[kBlendTime]; }
+	float& Stiffness() { return values[kStiffness]; }
+	float& Damping() { return values[kDamping]; }
+	float& PositionStrength() { return values[kPositionStrength]; }
+	float& RotationStrength() { return values[kRotationStrength]; }
+	float& ImpulseX() { return values[kImpulseX]; }
+	float& ImpulseY() { return values[kImpulseY]; }
+	float& ImpulseZ() { return values[kImpulseZ]; }
+	float& RotImpulseX() { return values[kRotImpulseX]; }
+	float& RotImpulseY() { return values[kRotImpulseY]; }
+	float& RotImpulseZ() { return values[kRotImpulseZ]; }
+
+	float Multiplier() const { return values[kMultiplier]; }
+	float BlendTime() const { return values[kBlendTime]; }
+	float Stiffness() const { return values[kStiffness]; }
+	float Damping() const { return values[kDamping]; }
+	float PositionStrength() const { return values[kPositionStrength]; }
+	float RotationStrength() const { return values[kRotationStrength]; }
+	float ImpulseX() const { return values[kImpulseX]; }
+	float ImpulseY() const { return values[kImpulseY]; }
+	float ImpulseZ() const { return values[kImpulseZ]; }
+	float RotImpulseX() const { return values[kRotImpulseX]; }
+	float RotImpulseY() const { return values[kRotImpulseY]; }
+	float RotImpulseZ() const { return values[kRotImpulseZ]; }
+
+	// Byte offset of values[a_index] (INI key tables)
+	static constexpr std::size_t FloatOffset(FloatIndex a_index) { return offsetof(ActionSettings, values) + a_index * sizeof(float); }
+
+	// Copy all values from another ActionSettings
+	void CopyFrom(const ActionSettings& other);
+
+	// Blend between two ActionSettings (t=0 returns a, t=1 returns b)
+	static ActionSettings Blend(const ActionSettings& a, const ActionSettings& b, float t);
+};
+
+static_assert(sizeof(ActionSettings) == 64, "ActionSettings should fill exactly one cache line");
@@ -0,0 +1,304 @@
+#include "Core/ActionStateMachine.h"
+#include "Core/ActionTraits.h"
+#include "Core/SettleCore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace SettleCore
+{
+	namespace
+	{
+		using namespace Condition;
+		using T = Transition;
+		using G = TransitionGroup;
+		using Row = TransitionRow;
+
+		constexpr float KEEP = -1.0f;  // Row leaves the movement debounce as it is
+
+		constexpr ImpulseCommand NO_IMPULSE{};
+
+		// The action's impulse on the layer it drives
+		constexpr ImpulseCommand Impulse(ActionType a_action)
+		{
+			return { GetActionTraits(a_action).layer, ImpulseSource::kAction, a_action };
+		}
+
+		constexpr ImpulseCommand Movement(float a_scale, std::uint8_t a_flags = 0)
+		{
+			return { kMovementLayer, ImpulseSource::kMovement, ActionType::kTotal, a_scale, a_flags };
+		}
+
+		// a_set must be set and a_clear clear for the row to fire
+		constexpr Row MakeRow(T a_transition, G a_group, std::uint32_t a_set, std::uint32_t a_clear, ImpulseCommand a_command,
+			float a_debounce = KEEP, std::uint8_t a_effects = 0)
+		{
+			a_command.transition = a_transition;
+			return { a_transition, a_group, a_set | a_clear, a_set, a_command, a_debounce, a_effects };
+		}
+
+		constexpr Row TRANSITIONS[] = {
+			MakeRow(T::kSneak, G::kSneak, kSneaking, kWasSneaking, Impulse(ActionType::Sneak)),
+			MakeRow(T::kUnSneak, G::kSneak, kWasSneaking, kSneaking, Impulse(ActionType::UnSneak)),
+
+			// Leaving the ground only counts as a jump when the behavior graph says so; landing scales with air time
+			MakeRow(T::kJump, G::kAir, kInAir | kJumpAnimation, kWasInAir, Impulse(ActionType::Jump)),
+			MakeRow(T::kLeaveGround, G::kAir, kInAir, kWasInAir, NO_IMPULSE),
+			MakeRow(T::kLand, G::kAir, kWasInAir | kLandReady | kLongFall, kInAir, Impulse(ActionType::Land), KEEP,
+				Row::kEndAirTime | Row::kLandingCooldown | Row::kScaleByAirTime),
+			MakeRow(T::kShortDrop, G::kAir, kWasInAir | kLandReady, kInAir, NO_IMPULSE, KEEP, Row::kEndAirTime),
+
+			// Sprint stop falls back to the state change only when EndAnimatedCameraDelta didn't handle it
+			MakeRow(T::kSprintStart, G::kSprint, kSprinting, kWasSprinting, Impulse(ActionType::SprintForward), KEEP, Row::kRearmSprintStop),
+			MakeRow(T::kSprintStop, G::kSprint, kWasSprinting, kSprinting | kSprintStopAnimated,
+				{ kMovementLayer, ImpulseSource::kSprintReverse, ActionType::SprintForward }, KEEP, Row::kRearmSprintStop),
+			MakeRow(T::kSprintStopAnimated, G::kSprint, kWasSprinting, kSprinting, NO_IMPULSE, KEEP, Row::kRearmSprintStop),
+
+			MakeRow(T::kWalkToRun, G::kGait, kMoving | kWasMoving | kWasWalking | kDebounceReady, kWalking, Movement(0.3f), 0.1f),
+			MakeRow(T::kRunToWalk, G::kGait, kMoving | kWasMoving | kWalking | kDebounceReady, kWasWalking, Movement(0.3f), 0.1f),
+
+			// A walk start waits out the grace period, so a quick walk-to-run only gets the run
+			MakeRow(T::kWalkStartDeferred, G::kMovement, kMoving | kDebounceReady | kWalkGait | kGraceEnabled, kWasMoving, NO_IMPULSE, 0.15f),
+			MakeRow(T::kMoveStart, G::kMovement, kMoving | kDebounceReady, kWasMoving, Movement(1.0f, ImpulseCommand::kNotify), 0.15f),
+			MakeRow(T::kDeferredWalkStart, G::kMovement, kMoving | kWasMoving | kGraceEnded | kWalkBlend | kDebounceReady, 0, Movement(1.0f), 0.1f),
+			MakeRow(T::kDeferredWalkDropped, G::kMovement, kMoving | kWasMoving | kGraceEnded | kDebounceReady, 0, NO_IMPULSE),
+			MakeRow(T::kMoveStop, G::kMovement, kWasMoving | kDebounceReady | kHasLastMovement, kMoving,
+				{ kMovementLayer, ImpulseSource::kMovementStop }, 0.15f),
+			MakeRow(T::kMoveStop, G::kMovement, kWasMoving | kDebounceReady, kMoving, NO_IMPULSE, 0.15f, Row::kSettles),
+			// Reversing damps the momentum of the old direction instead of fighting it with a full impulse
+			MakeRow(T::kOppositeDirection, G::kMovement, kMoving | kDirectionChanged | kOpposite | kDebounceReady, 0,
+				Movement(0.25f, ImpulseCommand::kCancelMomentum), 0.15f),
+			MakeRow(T::kDirectionChange, G::kMovement, kMoving | kDirectionChanged | kDebounceReady, 0, Movement(0.5f, ImpulseCommand::kNotify), 0.1f)
+		};
+
+		constexpr const char* TRANSITION_NAMES[] = {
+			"Sneak",
+			"UnSneak",
+			"Jump",
+			"Leave Ground (no jump)",
+			"Land",
+			"Short Drop (no land)",
+			"Sprint Start",
+			"Sprint Stop",
+			"Sprint Stop (anim event)",
+			"Walk To Run",
+			"Run To Walk",
+			"Walk Start (grace period)",
+			"Movement Start",
+			"Walk Start (after grace period)",
+			"Walk Start Dropped (running)",
+			"Movement Stop",
+			"Opposite Direction",
+			"Direction Change"
+		};
+		static_assert(std::size(TRANSITION_NAMES) == static_cast<std::size_t>(T::kTotal), "TRANSITION_NAMES must cover every Transition");
+		static_assert(static_cast<int>(T::kTotal) <= 32, "ActionFrame::fired has a bit per Transition");
+
+		// First row of each group, plus the end of the table
+		constexpr auto GROUP_BEGIN = [] {
+			std::array<int, static_cast<int>(G::kTotal) + 1> begin{};
+			int row = 0;
+			for (int group = 0; group < static_cast<int>(G::kTotal); ++group) {
+				begin[group] = row;
+				while (row < static_cast<int>(std::size(TRANSITIONS)) && static_cast<int>(TRANSITIONS[row].group) == group) {
+					++row;
+				}
+			}
+			begin[static_cast<int>(G::kTotal)] = row;
+			return begin;
+		}();
+		static_assert(GROUP_BEGIN.back() == static_cast<int>(std::size(TRANSITIONS)), "TRANSITIONS must be sorted by group");
+
+		// A row is dead if an earlier row of its group matches every key it matches
+		constexpr bool NoShadowedRows()
+		{
+			for (std::size_t later = 0; later < std::size(TRANSITIONS); ++later) {
+				for (std::size_t earlier = 0; earlier < later; ++earlier) {
+					const auto& a = TRANSITIONS[earlier];
+					const auto& b = TRANSITIONS[later];
+					if (a.group == b.group && (a.mask & ~b.mask) == 0 && (b.match & a.mask) == a.match) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+		static_assert(NoShadowedRows(), "a transition row can never fire");
+
+		constexpr std::uint32_t Bit(bool a_set, std::uint32_t a_bit)
+		{
+			return a_set ? a_bit : 0;
+		}
+	}
+
+	std::span<const TransitionRow> TransitionTable()
+	{
+		return TRANSITIONS;
+	}
+
+	const char* TransitionName(Transition a_transition)
+	{
+		const auto index = static_cast<unsigned>(a_transition);
+		return index < std::size(TRANSITION_NAMES) ? TRANSITION_NAMES[index] : "Unknown";
+	}
+
+	ActionFrame ActionStateMachine::Step(const PlayerStateSnapshot& a_state, const SettingsData& a_settings)
+	{
+		const float delta = a_state.delta;
+		ActionFrame frame;
+
+		if (landingCooldown > 0.0f) landingCooldown -= delta;
+		if (movementDebounce > 0.0f) movementDebounce -= delta;
+
+		Fire(G::kSneak, Bit(a_state.sneaking, kSneaking) | Bit(wasSneaking, kWasSneaking), ActionType::kTotal, a_settings, frame);
+		wasSneaking = a_state.sneaking;
+
+		// Air time drives the land impulse; whether leaving the ground was a jump is decided on takeoff
+		if (a_state.inMidair) {
+			airTime += delta;
+			if (!wasInAir) {
+				didJump = a_state.animationDriven || a_state.jumping;
+			}
+		}
+		const bool longFall = !a_settings.scaleJumpByAirTime || airTime >= a_settings.jumpMinAirTime;
+		Fire(G::kAir,
+			Bit(a_state.inMidair, kInAir) | Bit(wasInAir, kWasInAir) | Bit(didJump, kJumpAnimation) |
+				Bit(landingCooldown <= 0.0f, kLandReady) | Bit(longFall, kLongFall),
+			ActionType::kTotal, a_settings, frame);
+		wasInAir = a_state.inMidair;
+
+		Fire(G::kSprint, Bit(a_state.sprinting, kSprinting) | Bit(wasSprinting, kWasSprinting) | Bit(sprintStopAnimated, kSprintStopAnimated),
+			ActionType::kTotal, a_settings, frame);
+		wasSprinting = a_state.sprinting;
+
+		const ActionType movement = DetectMovementAction(a_state);
+		const bool isMoving = movement != ActionType::kTotal;
+
+		// Walk state only matters while moving; keep the last one when standing
+		const bool isWalking = isMoving ? a_state.walking : wasWalking;
+
+		// Walk/run blend eases toward the input magnitude (or the walk toggle)
+		if (isMoving) {
+			constexpr float WALK_RUN_BLEND_SPEED = 5.0f;
+			float targetBlend;
+			if (a_settings.speedBasedBlending) {
+				// Walk is typically 0.3-0.5, run is 0.7-1.0
+				constexpr float WALK_THRESHOLD = 0.4f;
+				constexpr float RUN_THRESHOLD = 0.7f;
+				const float inputMagnitude = std::sqrt(a_state.moveInputX * a_state.moveInputX + a_state.moveInputY * a_state.moveInputY);
+				targetBlend = std::clamp((inputMagnitude - WALK_THRESHOLD) / (RUN_THRESHOLD - WALK_THRESHOLD), 0.0f, 1.0f);
+
+				// If player has walk toggle on, cap at walk
+				if (isWalking) {
+					targetBlend = std::min(targetBlend, 0.3f);
+				}
+			} else {
+				targetBlend = isWalking ? 0.0f : 1.0f;
+			}
+			walkRunBlend = MoveTowards(walkRunBlend, targetBlend, WALK_RUN_BLEND_SPEED * delta);
+		}
+
+		// Walk-to-run grace period: a run reached within it blocks the deferred walk impulse
+		if (isMoving && !wasMoving) {
+			movementStartTime = 0.0f;
+			walkImpulseBlocked = false;
+		}
+		if (isMoving) {
+			movementStartTime += delta;
+			if (movementStartTime < a_settings.walkToRunGracePeriod && walkRunBlend > 0.5f) {
+				walkImpulseBlocked = true;
+			}
+		} else {
+			walkImpulseBlocked = false;
+		}
+		const float grace = a_settings.walkToRunGracePeriod;
+		const bool graceEnded = a_settings.speedBasedBlending && !walkImpulseBlocked && movementStartTime >= grace && movementStartTime < grace + delta * 2.0f;
+
+		const std::uint32_t moving = Bit(isMoving, kMoving) | Bit(wasMoving, kWasMoving);
+		Fire(G::kGait, moving | Bit(isWalking, kWalking) | Bit(wasWalking, kWasWalking) | DebounceBit(), movement, a_settings, frame);
+		wasWalking = isWalking;
+
+		const bool directionChanged = movement != movementAction && movementAction != ActionType::kTotal;
+		Fire(G::kMovement,
+			moving | DebounceBit() | Bit(IsWalkAction(movement), kWalkGait) |
+				Bit(grace > 0.0f && a_settings.speedBasedBlending, kGraceEnabled) | Bit(graceEnded, kGraceEnded) |
+				Bit(walkRunBlend < 0.5f, kWalkBlend) | Bit(directionChanged, kDirectionChanged) |
+				Bit(directionChanged && AreOppositeDirections(movement, movementAction), kOpposite) |
+				Bit(lastMovementAction != ActionType::kTotal, kHasLastMovement),
+			movement, a_settings, frame);
+
+		wasMoving = isMoving;
+		if (isMoving) {
+			lastMovementAction = movement;
+		}
+		movementAction = movement;
+		return frame;
+	}
+
+	void ActionStateMachine::Fire(TransitionGroup a_group, std::uint32_t a_key, ActionType a_movement, const SettingsData& a_settings, ActionFrame& a_frame)
+	{
+		const int end = GROUP_BEGIN[static_cast<int>(a_group) + 1];
+		for (int index = GROUP_BEGIN[static_cast<int>(a_group)]; index < end; ++index) {
+			const auto& row = TRANSITIONS[index];
+			if (!row.Matches(a_key)) {
+				continue;
+			}
+
+			a_frame.fired |= 1u << static_cast<int>(row.transition);
+			if (row.command.source != ImpulseSource::kNone) {
+				auto& command = a_frame.commands[a_frame.commandCount++];
+				command = row.command;
+				if (command.source == ImpulseSource::kMovement) {
+					command.action = a_movement;
+				} else if (command.source == ImpulseSource::kMovementStop) {
+					command.action = lastMovementAction;
+				}
+				if (row.effects & Row::kScaleByAirTime) {
+					command.scale *= LandingScale(a_settings);
+				}
+				a_frame.settled = true;
+			}
+			if (row.effects & Row::kSettles) {
+				a_frame.settled = true;
+			}
+
+			if (row.debounce >= 0.0f) {
+				movementDebounce = row.debounce;
+			}
+			if (row.effects & Row::kLandingCooldown) {
+				landingCooldown = 0.25f;
+			}
+			if (row.effects & Row::kEndAirTime) {
+				lastAirTime = airTime;
+				airTime = 0.0f;
+				didJump = false;
+			}
+			if (row.effects & Row::kRearmSprintStop) {
+				sprintStopAnimated = false;
+			}
+			return;
+		}
+	}
+
+	float ActionStateMachine::LandingScale(const SettingsData& a_settings) const
+	{
+		if (!a_settings.scaleJumpByAirTime) {
+			// Simple scaling
+			return std::clamp(0.3f + airTime * 0.7f, 0.3f, 2.0f);
+		}
+
+		// Base scale always applies, plus additional scale from air time normalized to [min, max]
+		const float normalizedAirTime = std::clamp(
+			(airTime - a_settings.jumpMinAirTime) / (a_settings.jumpMaxAirTimeScale - a_settings.jumpMinAirTime), 0.0f, 1.0f);
+		const float scale = a_settings.landBaseScale + normalizedAirTime * a_settings.landAirTimeScale;
+
+		// Falls that weren't jumps land slightly softer
+		return didJump ? scale : scale * 0.8f;
+	}
+
+	void ActionStateMachine::Reset()
+	{
+		*this = ActionStateMachine{};
+	}
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "Core/PlayerState.h"
+#include "Core/SettingsData.h"
+#include "Core/SpringBank.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+// Action detection as a transition table.
+//
+// Every frame the player state and the detector's own edge state (previous
+// frame's flags, cooldowns, grace period) are packed into one word of
+// condition bits. Each transition is a table row: the bits it needs set, the
+// bits it needs clear, and what it does (an impulse command, a debounce, state
+// effects). Rows are grouped like the old if/else chains (sneak, air, sprint,
+// gait, movement); within a group the first matching row fires. The result of
+// a frame is a short list of impulse commands the plugin applies in one batch.
+//
+// The detector reads nothing but a PlayerStateSnapshot and settings, so it runs
+// unchanged over recorded sessions (settle_replay). A new trigger is a row here.
+namespace SettleCore
+{
+	enum class Transition : std::uint8_t
+	{
+		kSneak,
+		kUnSneak,
+		kJump,
+		kLeaveGround,          // Walked off a ledge: no jump impulse
+		kLand,
+		kShortDrop,            // Landed below jumpMinAirTime: no land impulse
+		kSprintStart,
+		kSprintStop,
+		kSprintStopAnimated,   // Already handled by EndAnimatedCameraDelta
+		kWalkToRun,
+		kRunToWalk,
+		kWalkStartDeferred,    // Walk start held back for the walk-to-run grace period
+		kMoveStart,
+		kDeferredWalkStart,    // Grace period ended still walking
+		kDeferredWalkDropped,  // Grace period ended running: the run is already under way
+		kMoveStop,
+		kOppositeDirection,
+		kDirectionChange,
+
+		kTotal
+	};
+
+	enum class TransitionGroup : std::uint8_t
+	{
+		kSneak,
+		kAir,
+		kSprint,
+		kGait,
+		kMovement,
+
+		kTotal
+	};
+
+	// Where a command's impulse comes from
+	enum class ImpulseSource : std::uint8_t
+	{
+		kNone,           // No impulse (the row only updates state)
+		kAction,         // The action's resolved impulse
+		kMovement,       // Sprint: its resolved impulse; walk/run: the movement blend space
+		kMovementStop,   // kMovement of the last movement, scaled by the stop counter-impulse factors
+		kSprintReverse   // Sprint impulse with forward push and pitch reversed at 70%
+	};
+
+	struct ImpulseCommand
+	{
+		static constexpr std::uint8_t kCancelMomentum = 1 << 0;  // Damp the layer and fold in its pending blends first
+		static constexpr std::uint8_t kNotify = 1 << 1;          // On-screen debug notification
+
+		SpringLayer layer{ kMovementLayer };
+		ImpulseSource source{ ImpulseSource::kNone };
+		ActionType action{ ActionType::kTotal };
+		float scale{ 1.0f };
+		std::uint8_t flags{ 0 };
+		Transition transition{ Transition::kTotal };  // Row that issued it (logging, replay analysis)
+	};
+
+	// Condition bits of the packed frame key
+	namespace Condition
+	{
+		constexpr std::uint32_t kSneaking = 1u << 0;
+		constexpr std::uint32_t kWasSneaking = 1u << 1;
+		constexpr std::uint32_t kInAir = 1u << 2;
+		constexpr std::uint32_t kWasInAir = 1u << 3;
+		constexpr std::uint32_t kSprinting = 1u << 4;
+		constexpr std::uint32_t kWasSprinting = 1u << 5;
+		constexpr std::uint32_t kMoving = 1u << 6;
+		constexpr std::uint32_t kWasMoving = 1u << 7;
+		constexpr std::uint32_t kWalking = 1u << 8;            // Walk toggle, kept from the last moving frame
+		constexpr std::uint32_t kWasWalking = 1u << 9;
+		constexpr std::uint32_t kJumpAnimation = 1u << 10;     // bAnimationDriven or IsJumping
+		constexpr std::uint32_t kLandReady = 1u << 11;         // Landing cooldown elapsed
+		constexpr std::uint32_t kLongFall = 1u << 12;          // Air time reached jumpMinAirTime (or air time scaling is off)
+		constexpr std::uint32_t kSprintStopAnimated = 1u << 13;
+		constexpr std::uint32_t kDebounceReady = 1u << 14;     // Movement debounce elapsed
+		constexpr std::uint32_t kWalkGait = 1u << 15;          // Movement action is a walk or sneak walk
+		constexpr std::uint32_t kGraceEnabled = 1u << 16;      // walkToRunGracePeriod > 0 with speed-based blending
+		constexpr std::uint32_t kGraceEnded = 1u << 17;        // Grace period ended this frame without the run blocking it
+		constexpr std::uint32_t kWalkBlend = 1u << 18;         // walkRunBlend below half
+		constexpr std::uint32_t kDirectionChanged = 1u << 19;  // Movement action differs from the last frame's moving one
+		constexpr std::uint32_t kOpposite = 1u << 20;          // ... and points the opposite way
+		constexpr std::uint32_t kHasLastMovement = 1u << 21;   // Some frame since the last reset was moving
+	}
+
+	struct TransitionRow
+	{
+		// Effects on the detector's own state
+		static constexpr std::uint8_t kEndAirTime = 1 << 0;       // Reset air time and the jump flag
+		static constexpr std::uint8_t kLandingCooldown = 1 << 1;
+		static constexpr std::uint8_t kRearmSprintStop = 1 << 2;  // Clear the EndAnimatedCameraDelta flag
+		static constexpr std::uint8_t kSettles = 1 << 3;          // Counts as an action for settling even without an impulse
+		static constexpr std::uint8_t kScaleByAirTime = 1 << 4;   // Scale the impulse by the landing multiplier
+
+		Transition transition;
+		TransitionGroup group;
+		std::uint32_t mask;      // Condition bits the row tests
+		std::uint32_t match;     // Their required values
+		ImpulseCommand command;  // source kNone: no impulse; kMovement/kMovementStop rows take the frame's action
+		float debounce;          // Movement debounce to set (< 0 leaves it)
+		std::uint8_t effects;
+
+		constexpr bool Matches(std::uint32_t a_key) const { return (a_key & mask) == match; }
+	};
+
+	// Every transition, grouped in evaluation order
+	std::span<const TransitionRow> TransitionTable();
+
+	const char* TransitionName(Transition a_transition);
+
+	// One frame of detection
+	struct ActionFrame
+	{
+		static constexpr int kMaxCommands = static_cast<int>(TransitionGroup::kTotal);  // At most one row per group fires
+
+		std::array<ImpulseCommand, kMaxCommands> commands{};
+		int commandCount{ 0 };
+		std::uint32_t fired{ 0 };   // Bit per Transition
+		bool settled{ false };      // Some row counted as an action (reset the settle timer)
+
+		bool Fired(Transition a_transition) const { return (fired & (1u << static_cast<int>(a_transition))) != 0; }
+	};
+
+	class ActionStateMachine
+	{
+	public:
+		// Runs every group over a_state. Commands refer to the movement action and
+		// walkRunBlend this leaves behind, so apply them before the next Step.
+		ActionFrame Step(const PlayerStateSnapshot& a_state, const SettingsData& a_settings);
+
+		// EndAnimatedCameraDelta already reversed the sprint; the state fallback skips it
+		void SetSprintStopAnimated() { sprintStopAnimated = true; }
+
+		void Reset();
+
+		bool InAir() const { return wasInAir; }
+		bool Moving() const { return wasMoving; }
+		bool Sprinting() const { return wasSprinting; }
+		bool SprintStopAnimated() const { return sprintStopAnimated; }
+		ActionType MovementAction() const { return movementAction; }          // kTotal while standing
+		ActionType LastMovementAction() const { return lastMovementAction; }  // Last moving frame's
+		float WalkRunBlend() const { return walkRunBlend; }                   // 0 = walk, 1 = run
+		float AirTime() const { return airTime; }
+		float LastAirTime() const { return lastAirTime; }                     // Air time of the last landing
+
+	private:
+		// Fires the first row of a_group matching a_key; a_movement is this frame's movement action
+		void Fire(TransitionGroup a_group, std::uint32_t a_key, ActionType a_movement, const SettingsData& a_settings, ActionFrame& a_frame);
+
+		std::uint32_t DebounceBit() const { return movementDebounce <= 0.0f ? Condition::kDebounceReady : 0; }
+
+		// Land impulse multiplier for the air time so far
+		float LandingScale(const SettingsData& a_settings) const;
+
+		// Previous frame
+		bool wasSneaking{ false };
+		bool wasInAir{ false };
+		bool wasSprinting{ false };
+		bool wasMoving{ false };
+		bool wasWalking{ true };
+		ActionType movementAction{ ActionType::kTotal };
+		ActionType lastMovementAction{ ActionType::kTotal };
+
+		// Cooldowns
+		float landingCooldown{ 0.0f };
+		float movementDebounce{ 0.0f };
+
+		// Jump/land
+		float airTime{ 0.0f };
+		float lastAirTime{ 0.0f };
+		bool didJump{ false };
+		bool sprintStopAnimated{ false };
+
+		// Walk/run blending and the walk-to-run grace period
+		float walkRunBlend{ 0.0f };
+		float movementStartTime{ 0.0f };
+		bool walkImpulseBlocked{ false };
+	};
+}
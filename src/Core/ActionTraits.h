@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Core/ActionSettings.h"
+#include "Core/SpringBank.h"
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+// What every ActionType is, as one constexpr row per action: the spring layer it
+// drives, its gait, stance and direction, its reverse, and where it sits in the
+// movement blend space. Routing and classification (which layer, is it a walk,
+// are two actions opposite, which action does this input map to) are indexed
+// loads and bit tests on this table instead of switches and comparison chains.
+namespace SettleCore
+{
+	enum class ActionGait : std::uint8_t
+	{
+		kNone,  // Not a movement action
+		kWalk,
+		kRun,
+		kSprint
+	};
+
+	// Direction bits, in BlendCoords::direction order (bit index = blend space cardinal)
+	namespace MoveDirection
+	{
+		constexpr std::uint8_t kForward = 1 << 0;
+		constexpr std::uint8_t kRight = 1 << 1;
+		constexpr std::uint8_t kBackward = 1 << 2;
+		constexpr std::uint8_t kLeft = 1 << 3;
+	}
+
+	struct ActionTraits
+	{
+		SpringLayer layer{ kMovementLayer };
+		ActionGait gait{ ActionGait::kNone };
+		std::uint8_t direction{ 0 };                 // MoveDirection bit (0 = not directional)
+		bool sneak{ false };
+		ActionType opposite{ ActionType::kTotal };   // Same gait and stance, reversed (kTotal = none)
+		std::int8_t blendCardinal{ -1 };             // Blend space cardinal for walk/run actions (-1 = not in the blend space)
+		std::uint32_t opposites{ 0 };                // Bit per ActionType this one reverses (derived)
+	};
+
+	namespace Detail
+	{
+		using enum ActionType;
+
+		constexpr ActionTraits Move(ActionGait a_gait, std::uint8_t a_direction, bool a_sneak, ActionType a_opposite)
+		{
+			const bool blended = a_gait == ActionGait::kWalk || a_gait == ActionGait::kRun;
+			const std::int8_t cardinal = static_cast<std::int8_t>(
+				a_direction == MoveDirection::kForward ? 0 : a_direction == MoveDirection::kRight ? 1 : a_direction == MoveDirection::kBackward ? 2 : 3);
+			return { kMovementLayer, a_gait, a_direction, a_sneak, a_opposite, blended ? cardinal : std::int8_t{ -1 } };
+		}
+
+		constexpr ActionTraits Other(SpringLayer a_layer)
+		{
+			return { a_layer };
+		}
+
+		constexpr auto WALK = ActionGait::kWalk;
+		constexpr auto RUN = ActionGait::kRun;
+		constexpr auto FORWARD = MoveDirection::kForward;
+		constexpr auto RIGHT = MoveDirection::kRight;
+		constexpr auto BACKWARD = MoveDirection::kBackward;
+		constexpr auto LEFT = MoveDirection::kLeft;
+
+		// In ActionType order; the last row is kTotal ("no action")
+		constexpr ActionTraits ROWS[] = {
+			Move(WALK, FORWARD, false, WalkBackward),
+			Move(WALK, BACKWARD, false, WalkForward),
+			Move(WALK, LEFT, false, WalkRight),
+			Move(WALK, RIGHT, false, WalkLeft),
+			Move(RUN, FORWARD, false, RunBackward),
+			Move(RUN, BACKWARD, false, RunForward),
+			Move(RUN, LEFT, false, RunRight),
+			Move(RUN, RIGHT, false, RunLeft),
+			Move(ActionGait::kSprint, FORWARD, false, kTotal),  // No reverse: sprinting only goes forward
+			Move(WALK, FORWARD, true, SneakWalkBackward),
+			Move(WALK, BACKWARD, true, SneakWalkForward),
+			Move(WALK, LEFT, true, SneakWalkRight),
+			Move(WALK, RIGHT, true, SneakWalkLeft),
+			Move(RUN, FORWARD, true, SneakRunBackward),
+			Move(RUN, BACKWARD, true, SneakRunForward),
+			Move(RUN, LEFT, true, SneakRunRight),
+			Move(RUN, RIGHT, true, SneakRunLeft),
+			Other(kJumpLayer),     // Jump
+			Other(kJumpLayer),     // Land
+			Other(kSneakLayer),    // Sneak
+			Other(kSneakLayer),    // UnSneak
+			Other(kHitLayer),      // TakingHit
+			Other(kHitLayer),      // Hitting
+			Other(kArcheryLayer),  // ArrowRelease
+			Other(kMovementLayer)  // kTotal
+		};
+		static_assert(std::size(ROWS) == static_cast<std::size_t>(kTotal) + 1, "ROWS needs a row per ActionType plus kTotal");
+		static_assert(static_cast<int>(kTotal) <= 32, "ActionTraits::opposites has a bit per ActionType");
+
+		// Every action reverses the actions in its opposite's direction, in any gait that has a reverse
+		constexpr auto TRAITS = [] {
+			std::array<ActionTraits, std::size(ROWS)> traits{};
+			for (std::size_t action = 0; action < std::size(ROWS); ++action) {
+				traits[action] = ROWS[action];
+				if (ROWS[action].opposite == kTotal) {
+					continue;
+				}
+				const std::uint8_t reversed = ROWS[static_cast<int>(ROWS[action].opposite)].direction;
+				for (std::size_t other = 0; other < static_cast<std::size_t>(kTotal); ++other) {
+					if (ROWS[other].opposite != kTotal && ROWS[other].direction == reversed) {
+						traits[action].opposites |= 1u << other;
+					}
+				}
+			}
+			return traits;
+		}();
+
+		constexpr bool OppositesAreMutual()
+		{
+			for (std::size_t action = 0; action < static_cast<std::size_t>(kTotal); ++action) {
+				const auto opposite = ROWS[action].opposite;
+				if (opposite != kTotal && (ROWS[static_cast<int>(opposite)].opposite != static_cast<ActionType>(action) ||
+											  ROWS[static_cast<int>(opposite)].gait != ROWS[action].gait ||
+											  ROWS[static_cast<int>(opposite)].sneak != ROWS[action].sneak)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		static_assert(OppositesAreMutual(), "an action's opposite must reverse it in the same gait and stance");
+	}
+
+	// Out-of-range values (TriggerAction takes any caller's ActionType) get the kTotal row: the movement layer, no class
+	constexpr const ActionTraits& GetActionTraits(ActionType a_action)
+	{
+		const auto index = static_cast<unsigned>(a_action);
+		return Detail::TRAITS[index < static_cast<unsigned>(ActionType::kTotal) ? index : static_cast<unsigned>(ActionType::kTotal)];
+	}
+
+	// Forward vs backward or left vs right, in any gait that can reverse (walk, run, sneak walk/run)
+	constexpr bool AreOppositeDirections(ActionType a_action1, ActionType a_action2)
+	{
+		const auto bit = static_cast<unsigned>(a_action2);
+		return bit < static_cast<unsigned>(ActionType::kTotal) && ((GetActionTraits(a_action1).opposites >> bit) & 1);
+	}
+
+	constexpr bool IsWalkAction(ActionType a_action)
+	{
+		return GetActionTraits(a_action).gait == ActionGait::kWalk;
+	}
+
+	// Walk/run action of a blend space cardinal, gait and stance (the inverse of blendCardinal)
+	inline constexpr auto kBlendSpaceActions = [] {
+		std::array<std::array<std::array<ActionType, 4>, 2>, 2> actions{};  // [sneak][run][cardinal]
+		for (int action = 0; action < static_cast<int>(ActionType::kTotal); ++action) {
+			const auto& traits = Detail::ROWS[action];
+			if (traits.blendCardinal >= 0) {
+				actions[traits.sneak][traits.gait == ActionGait::kRun][traits.blendCardinal] = static_cast<ActionType>(action);
+			}
+		}
+		return actions;
+	}();
+}
@@ -0,0 +1,68 @@
+#include "Core/AnimEvents.h"
+
+namespace SettleCore
+{
+	namespace
+	{
+		// Multipliers tried before falling back to linear probing; with the table at most
+		// a quarter full, some multiplier separates every tag almost surely
+		constexpr std::uint32_t MULTIPLIER_ATTEMPTS = 256;
+
+		constexpr std::uint64_t Multiplier(std::uint32_t a_attempt)
+		{
+			return (0x9E3779B97F4A7C15ull + a_attempt * 0xD6E8FEB86659FD93ull) | 1;
+		}
+	}
+
+	bool AnimEventTable::Add(const void* a_tag, AnimEventRoute a_route)
+	{
+		if (!a_tag || count == kMaxEntries || Find(a_tag)) {
+			return false;
+		}
+		entries[count++] = { a_tag, a_route };
+		Rehash();
+		return true;
+	}
+
+	void AnimEventTable::Clear()
+	{
+		entries.fill({});
+		slots.fill(0);
+		multiplier = Multiplier(0);
+		count = 0;
+		maxProbe = 0;
+	}
+
+	void AnimEventTable::Rehash()
+	{
+		for (std::uint32_t attempt = 0; attempt < MULTIPLIER_ATTEMPTS; ++attempt) {
+			slots.fill(0);
+			bool collision = false;
+			for (int entry = 0; entry < count && !collision; ++entry) {
+				auto& slot = slots[Slot(entries[entry].tag, Multiplier(attempt))];
+				collision = slot != 0;
+				slot = static_cast<std::uint8_t>(entry + 1);
+			}
+			if (!collision) {
+				multiplier = Multiplier(attempt);
+				maxProbe = 0;
+				return;
+			}
+		}
+
+		// Linear probing; lookups read up to maxProbe slots past the home slot
+		slots.fill(0);
+		multiplier = Multiplier(0);
+		maxProbe = 0;
+		for (int entry = 0; entry < count; ++entry) {
+			std::uint32_t slot = Slot(entries[entry].tag, multiplier);
+			int probe = 0;
+			while (slots[slot] != 0) {
+				slot = (slot + 1) & (kSlotCount - 1);
+				++probe;
+			}
+			slots[slot] = static_cast<std::uint8_t>(entry + 1);
+			maxProbe = probe > maxProbe ? probe : maxProbe;
+		}
+	}
+}
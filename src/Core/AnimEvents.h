@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core/ActionSettings.h"
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+namespace SettleCore
+{
+	// What a player animation event does once its tag is recognized
+	enum class AnimEventHandler : std::uint8_t
+	{
+		kNone = 0,
+		kArrowRelease,
+		kBoltRelease,
+		kEndAnimatedCameraDelta,
+		kAction  // Fire AnimEventRoute::action, as TriggerAction does ([AnimationEvents] bindings)
+	};
+
+	struct AnimEventRoute
+	{
+		AnimEventHandler handler{ AnimEventHandler::kNone };
+		ActionType action{ ActionType::kTotal };
+	};
+
+	// Tags the plugin always handles; [AnimationEvents] can only add to them
+	struct BuiltInAnimEvent
+	{
+		const char* tag;
+		AnimEventHandler handler;
+	};
+
+	inline constexpr BuiltInAnimEvent kBuiltInAnimEvents[] = {
+		{ "arrowRelease", AnimEventHandler::kArrowRelease },
+		{ "BoltRelease", AnimEventHandler::kBoltRelease },
+		{ "EndAnimatedCameraDelta", AnimEventHandler::kEndAnimatedCameraDelta }
+	};
+	inline constexpr int kBuiltInAnimEventCount = static_cast<int>(std::size(kBuiltInAnimEvents));
+
+	// Animation event tags keyed by identity rather than text. The engine interns
+	// every tag (BSFixedString), so an event's tag is the same pointer as the one
+	// the plugin interned when it built the table, and a lookup never touches the
+	// characters. Tags sit in an open-addressing slot table whose hash multiplier
+	// is re-searched on every Add until each tag has a slot of its own, so any
+	// lookup, including the common miss, is one slot read and a pointer compare.
+	class AnimEventTable
+	{
+	public:
+		static constexpr int kSlotBits = 7;
+		static constexpr int kSlotCount = 1 << kSlotBits;
+		static constexpr int kMaxEntries = 32;
+
+		// Adds a_tag (an interned string's address); false if it's already present or the table is full
+		bool Add(const void* a_tag, AnimEventRoute a_route);
+
+		// Route of a_tag, or null for a tag that was never added
+		const AnimEventRoute* Find(const void* a_tag) const
+		{
+			std::uint32_t slot = Slot(a_tag, multiplier);
+			for (int probe = 0;; ++probe) {
+				const int entry = slots[slot] - 1;
+				if (entry < 0) {
+					return nullptr;
+				}
+				if (entries[entry].tag == a_tag) {
+					return &entries[entry].route;
+				}
+				if (probe == maxProbe) {
+					return nullptr;
+				}
+				slot = (slot + 1) & (kSlotCount - 1);
+			}
+		}
+
+		int Count() const { return count; }
+
+		// Extra slots a lookup may have to read (0 unless no multiplier separated every tag)
+		int MaxProbe() const { return maxProbe; }
+
+		void Clear();
+
+	private:
+		struct Entry
+		{
+			const void* tag{ nullptr };
+			AnimEventRoute route;
+		};
+
+		static std::uint32_t Slot(const void* a_tag, std::uint64_t a_multiplier)
+		{
+			auto key = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(a_tag));
+			key ^= key >> 29;  // Fold the high bits in; pool entries share most of them
+			return static_cast<std::uint32_t>((key * a_multiplier) >> (64 - kSlotBits));
+		}
+
+		// Places every entry, searching for a multiplier that gives each its own slot
+		void Rehash();
+
+		std::array<Entry, kMaxEntries> entries{};
+		std::array<std::uint8_t, kSlotCount> slots{};  // Entry index + 1, 0 = empty
+		std::uint64_t multiplier{ 0x9E3779B97F4A7C15ull };
+		int count{ 0 };
+		int maxProbe{ 0 };
+	};
+}
@@ -0,0 +1,112 @@
+#include "Core/BlendSpace.h"
+#include "Core/ActionTraits.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SettleCore
+{
+	namespace
+	{
+		static_assert(MovementBlendSpace::kDirectionSamples % 4 == 0, "Every cardinal direction must be a grid point");
+
+		ActionSettings WalkRun(const SettingsData& a_settings, int a_state, bool a_sneak, int a_cardinal, float a_speed)
+		{
+			const auto walk = static_cast<int>(kBlendSpaceActions[a_sneak][0][a_cardinal]);
+			const auto run = static_cast<int>(kBlendSpaceActions[a_sneak][1][a_cardinal]);
+			return ActionSettings::Blend(a_settings.actionSettings[a_state][walk], a_settings.actionSettings[a_state][run], a_speed);
+		}
+
+		// Lower grid index and weight of the upper one for a coordinate already scaled to grid units
+		void Split(float a_scaled, int a_last, int& a_index, float& a_weight)
+		{
+			a_index = std::clamp(static_cast<int>(a_scaled), 0, a_last - 1);
+			a_weight = std::clamp(a_scaled - static_cast<float>(a_index), 0.0f, 1.0f);
+		}
+	}
+
+	void MovementBlendSpace::Build(const SettingsData& a_settings)
+	{
+		constexpr int DIRECTIONS_PER_CARDINAL = kDirectionSamples / 4;
+
+		for (int state = 0; state < 2; ++state) {
+			const bool drawn = state == SettingsData::kDrawn;
+			const bool stateEnabled = drawn ? a_settings.weaponDrawnEnabled : a_settings.weaponSheathedEnabled;
+			const float globalMult = stateEnabled ? a_settings.globalIntensity * (drawn ? a_settings.weaponDrawnMult : a_settings.weaponSheathedMult) : 0.0f;
+
+			for (int sneak = 0; sneak < 2; ++sneak) {
+				for (int direction = 0; direction < kDirectionSamples; ++direction) {
+					const int cardinal = direction / DIRECTIONS_PER_CARDINAL;
+					const float turn = static_cast<float>(direction % DIRECTIONS_PER_CARDINAL) / DIRECTIONS_PER_CARDINAL;
+
+					for (int speed = 0; speed < kSpeedSamples; ++speed) {
+						const float walkRun = static_cast<float>(speed) / (kSpeedSamples - 1);
+						ActionSettings settings = WalkRun(a_settings, state, sneak != 0, cardinal, walkRun);
+						if (turn > 0.0f) {
+							settings = ActionSettings::Blend(settings, WalkRun(a_settings, state, sneak != 0, (cardinal + 1) % 4, walkRun), turn);
+						}
+						cells[state][sneak][direction][speed] = ResolveImpulse(settings, globalMult);
+					}
+				}
+			}
+		}
+	}
+
+	ResolvedImpulse MovementBlendSpace::Sample(const BlendCoords& a_coords) const
+	{
+		int speed, weapon, sneak;
+		float speedT, weaponT, sneakT;
+		Split(a_coords.speed * (kSpeedSamples - 1), kSpeedSamples - 1, speed, speedT);
+		Split(a_coords.weapon, 1, weapon, weaponT);
+		Split(a_coords.sneak, 1, sneak, sneakT);
+
+		// Direction wraps: the sample after the last is the first again
+		const float turns = a_coords.direction - std::floor(a_coords.direction);
+		int direction;
+		float directionT;
+		Split(turns * kDirectionSamples, kDirectionSamples, direction, directionT);
+		const int nextDirection = (direction + 1) % kDirectionSamples;
+
+		// Up to 16 corners; those with no weight are skipped (outside a weapon or sneak transition only
+		// speed and direction fall between grid points). Disabled corners add no impulse, and blend time
+		// is averaged over the enabled ones only.
+		ResolvedImpulse result;
+		float enabledWeight = 0.0f;
+		for (int corner = 0; corner < 16; ++corner) {
+			const float wSpeed = (corner & 1) ? speedT : 1.0f - speedT;
+			const float wDirection = (corner & 2) ? directionT : 1.0f - directionT;
+			const float wWeapon = (corner & 4) ? weaponT : 1.0f - weaponT;
+			const float wSneak = (corner & 8) ? sneakT : 1.0f - sneakT;
+			const float weight = wSpeed * wDirection * wWeapon * wSneak;
+			if (weight <= 0.0f) {
+				continue;
+			}
+
+			const auto& cell = cells[weapon + ((corner >> 2) & 1)][sneak + ((corner >> 3) & 1)][(corner & 2) ? nextDirection : direction][speed + (corner & 1)];
+			if (!cell.enabled) {
+				continue;
+			}
+			result.position.x += cell.position.x * weight;
+			result.position.y += cell.position.y * weight;
+			result.position.z += cell.position.z * weight;
+			result.rotation.x += cell.rotation.x * weight;
+			result.rotation.y += cell.rotation.y * weight;
+			result.rotation.z += cell.rotation.z * weight;
+			result.multiplier += cell.multiplier * weight;
+			result.blendTime += cell.blendTime * weight;
+			enabledWeight += weight;
+		}
+
+		if (enabledWeight > 0.0f) {
+			result.blendTime /= enabledWeight;
+			result.enabled = true;
+		}
+		return result;
+	}
+
+	float MovementBlendSpace::Direction(float a_x, float a_y)
+	{
+		const float turns = std::atan2(a_x, a_y) / (2.0f * PI);
+		return turns < 0.0f ? turns + 1.0f : turns;
+	}
+}
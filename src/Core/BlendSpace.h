@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Core/SettingsData.h"
+#include "Core/SettleCore.h"
+
+namespace SettleCore
+{
+	// Where the player is in the movement blend space
+	struct BlendCoords
+	{
+		float speed{ 0.0f };      // 0 = walk, 1 = run
+		float direction{ 0.0f };  // Input angle in turns: 0 forward, 0.25 right, 0.5 backward, 0.75 left
+		float weapon{ 0.0f };     // 0 = sheathed, 1 = drawn
+		float sneak{ 0.0f };      // 0 = standing, 1 = sneaking
+	};
+
+	// Walk/run movement impulses resolved ahead of time over a grid of speed,
+	// input direction, weapon state and sneak state. Grid points between two
+	// cardinal directions or between walk and run are built the way the
+	// per-frame path did it (ActionSettings::Blend, then ResolveImpulse), with
+	// globalIntensity and the weapon state multiplier folded in; a state whose
+	// settings are disabled resolves to nothing. Sample interpolates the grid,
+	// so diagonals and weapon/sneak transitions blend continuously at the cost
+	// of a few lerps, and it returns the grid point unchanged when the
+	// coordinates sit exactly on one. The owner rebuilds it when the settings
+	// it reads change.
+	class MovementBlendSpace
+	{
+	public:
+		static constexpr int kSpeedSamples = 9;       // Walk to run in steps of 1/8
+		static constexpr int kDirectionSamples = 16;  // Every 22.5 degrees, wrapping around
+
+		void Build(const SettingsData& a_settings);
+
+		ResolvedImpulse Sample(const BlendCoords& a_coords) const;
+
+		// BlendCoords::direction of a move input vector (x = right, y = forward)
+		static float Direction(float a_x, float a_y);
+
+	private:
+		ResolvedImpulse cells[2][2][kDirectionSamples][kSpeedSamples];  // [weapon state][sneak][direction][speed]
+	};
+}
@@ -0,0 +1,37 @@
+#include "Core/ClosedFormCache.h"
+
+#include <bit>
+#include <cmath>
+
+namespace SettleCore
+{
+	const SpringCoefficients& ClosedFormCache::Get(int a_slot, const ActionSettings& a_settings, std::uint32_t a_version, float a_delta, float a_dampingMult, bool a_exactDelta)
+	{
+		auto deltaBucket = a_exactDelta ?
+			std::bit_cast<std::int32_t>(a_delta) :
+			static_cast<std::int32_t>(std::lround(a_delta / DELTA_BUCKET));
+		auto dampingBucket = static_cast<std::int32_t>(std::lround(a_dampingMult / DAMPING_MULT_BUCKET));
+
+		auto& entry = entries[a_slot];
+		if (!entry.valid || entry.exactDelta != a_exactDelta || entry.version != a_version || entry.deltaBucket != deltaBucket || entry.dampingBucket != dampingBucket) {
+			float bucketDelta = a_exactDelta ? a_delta : static_cast<float>(deltaBucket) * DELTA_BUCKET;
+			float bucketDampingMult = static_cast<float>(dampingBucket) * DAMPING_MULT_BUCKET;
+
+			entry.coefficients = ComputeClosedForm(a_settings.Stiffness(), a_settings.Damping() * bucketDampingMult, bucketDelta);
+			entry.exactDelta = a_exactDelta;
+			entry.version = a_version;
+			entry.deltaBucket = deltaBucket;
+			entry.dampingBucket = dampingBucket;
+			entry.valid = true;
+			++rebuildCount;
+		}
+		return entry.coefficients;
+	}
+
+	void ClosedFormCache::Clear()
+	{
+		for (auto& entry : entries) {
+			entry.valid = false;
+		}
+	}
+}
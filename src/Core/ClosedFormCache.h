@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Core/SettleCore.h"
+
+#include <array>
+#include <cstdint>
+
+namespace SettleCore
+{
+	// Per-action cache of closed-form spring coefficients.
+	// An entry is rebuilt only when the settings version changes, the frame
+	// delta moves to another 10us bucket or the settling damping multiplier
+	// moves to another 1/32 bucket. The coefficients are evaluated at the
+	// bucket value, so every frame in a bucket integrates identically and the
+	// result never depends on which frame rebuilt the entry (replays match).
+	// With a_exactDelta (fixed timestep) the delta itself is the key instead.
+	class ClosedFormCache
+	{
+	public:
+		static constexpr float DELTA_BUCKET = 0.00001f;      // 10 microseconds
+		static constexpr float DAMPING_MULT_BUCKET = 1.0f / 32.0f;
+
+		// One slot per action and weapon state; ActionType::kTotal is the "no action" template
+		static constexpr int kSlots = (static_cast<int>(ActionType::kTotal) + 1) * 2;
+
+		static int Slot(ActionType a_type, bool a_weaponDrawn)
+		{
+			return static_cast<int>(a_type) * 2 + (a_weaponDrawn ? 1 : 0);
+		}
+
+		const SpringCoefficients& Get(int a_slot, const ActionSettings& a_settings, std::uint32_t a_version, float a_delta, float a_dampingMult, bool a_exactDelta = false);
+
+		void Clear();
+
+		// Rebuild count since construction (for diagnostics / settle_bench)
+		std::uint32_t GetRebuildCount() const { return rebuildCount; }
+
+	private:
+		struct Entry
+		{
+			bool valid{ false };
+			bool exactDelta{ false };
+			std::uint32_t version{ 0 };
+			std::int32_t deltaBucket{ 0 };       // Bucket index, or the delta's bits when exactDelta
+			std::int32_t dampingBucket{ 0 };
+			SpringCoefficients coefficients;
+		};
+
+		std::array<Entry, kSlots> entries{};
+		std::uint32_t rebuildCount{ 0 };
+	};
+}
@@ -0,0 +1,238 @@
+#include "Core/FileWatcher.h"
+
+#include <cstdint>
+
+#if defined(_WIN32)
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <Windows.h>
+#elif defined(__linux__)
+#	include <cerrno>
+#	include <poll.h>
+#	include <sys/eventfd.h>
+#	include <sys/inotify.h>
+#	include <unistd.h>
+#endif
+
+namespace SettleCore
+{
+#if defined(_WIN32)
+	struct FileWatcher::Platform
+	{
+		HANDLE directory{ INVALID_HANDLE_VALUE };
+		HANDLE stopEvent{ nullptr };
+		OVERLAPPED overlapped{};
+		bool readIssued{ false };
+		alignas(DWORD) std::uint8_t buffer[4096];
+
+		bool Open(const std::filesystem::path& a_directory)
+		{
+			directory = CreateFileW(a_directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+				nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+			stopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+			overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+			return directory != INVALID_HANDLE_VALUE && stopEvent && overlapped.hEvent;
+		}
+
+		void Signal() { SetEvent(stopEvent); }
+
+		~Platform()
+		{
+			// The kernel writes into buffer until the read is cancelled
+			if (readIssued) {
+				DWORD bytes = 0;
+				CancelIoEx(directory, &overlapped);
+				GetOverlappedResult(directory, &overlapped, &bytes, TRUE);
+			}
+			if (directory != INVALID_HANDLE_VALUE) {
+				CloseHandle(directory);
+			}
+			if (stopEvent) {
+				CloseHandle(stopEvent);
+			}
+			if (overlapped.hEvent) {
+				CloseHandle(overlapped.hEvent);
+			}
+		}
+	};
+
+	FileWatcher::WaitResult FileWatcher::Wait(int a_timeoutMs)
+	{
+		auto& p = *platform;
+		if (!p.readIssued) {
+			constexpr DWORD FILTER = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE;
+			ResetEvent(p.overlapped.hEvent);
+			if (!ReadDirectoryChangesW(p.directory, p.buffer, sizeof(p.buffer), FALSE, FILTER, nullptr, &p.overlapped, nullptr)) {
+				return WaitResult::kStopped;  // Directory is gone
+			}
+			p.readIssued = true;
+		}
+
+		HANDLE handles[2] = { p.stopEvent, p.overlapped.hEvent };
+		DWORD wait = WaitForMultipleObjects(2, handles, FALSE, a_timeoutMs < 0 ? INFINITE : static_cast<DWORD>(a_timeoutMs));
+		if (wait == WAIT_TIMEOUT) {
+			return WaitResult::kTimeout;
+		}
+		if (wait != WAIT_OBJECT_0 + 1) {
+			return WaitResult::kStopped;
+		}
+
+		p.readIssued = false;
+		DWORD bytes = 0;
+		if (!GetOverlappedResult(p.directory, &p.overlapped, &bytes, FALSE)) {
+			return WaitResult::kStopped;
+		}
+		if (bytes == 0) {
+			return WaitResult::kChanged;  // Buffer overflowed; the file may be among the lost entries
+		}
+
+		const auto& name = fileName.native();
+		const std::uint8_t* entry = p.buffer;
+		for (;;) {
+			const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(entry);
+			const int length = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+			if (info->Action != FILE_ACTION_REMOVED && info->Action != FILE_ACTION_RENAMED_OLD_NAME &&
+				CompareStringOrdinal(info->FileName, length, name.c_str(), static_cast<int>(name.size()), TRUE) == CSTR_EQUAL) {
+				return WaitResult::kChanged;
+			}
+			if (info->NextEntryOffset == 0) {
+				return WaitResult::kIgnored;
+			}
+			entry += info->NextEntryOffset;
+		}
+	}
+#elif defined(__linux__)
+	struct FileWatcher::Platform
+	{
+		int notify{ -1 };
+		int stop{ -1 };
+
+		bool Open(const std::filesystem::path& a_directory)
+		{
+			notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			stop = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+			if (notify < 0 || stop < 0) {
+				return false;
+			}
+			return inotify_add_watch(notify, a_directory.c_str(), IN_CLOSE_WRITE | IN_MODIFY | IN_CREATE | IN_MOVED_TO) >= 0;
+		}
+
+		void Signal()
+		{
+			std::uint64_t one = 1;
+			[[maybe_unused]] auto written = write(stop, &one, sizeof(one));
+		}
+
+		~Platform()
+		{
+			if (notify >= 0) {
+				close(notify);
+			}
+			if (stop >= 0) {
+				close(stop);
+			}
+		}
+	};
+
+	FileWatcher::WaitResult FileWatcher::Wait(int a_timeoutMs)
+	{
+		auto& p = *platform;
+		pollfd fds[2] = { { p.stop, POLLIN, 0 }, { p.notify, POLLIN, 0 } };
+		int ready = poll(fds, 2, a_timeoutMs);
+		if (ready == 0) {
+			return WaitResult::kTimeout;
+		}
+		if (ready < 0) {
+			return errno == EINTR ? WaitResult::kIgnored : WaitResult::kStopped;
+		}
+		if (fds[0].revents != 0) {
+			return WaitResult::kStopped;
+		}
+
+		alignas(inotify_event) char buffer[4096];
+		WaitResult result = WaitResult::kIgnored;
+		ssize_t length;
+		while ((length = read(p.notify, buffer, sizeof(buffer))) > 0) {
+			for (ssize_t offset = 0; offset < length;) {
+				const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+				if ((event->mask & IN_Q_OVERFLOW) || (event->len > 0 && fileName == event->name)) {
+					result = WaitResult::kChanged;
+				}
+				offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+			}
+		}
+		return result;
+	}
+#else
+	struct FileWatcher::Platform
+	{
+		bool Open(const std::filesystem::path&) { return false; }
+		void Signal() {}
+	};
+
+	FileWatcher::WaitResult FileWatcher::Wait(int)
+	{
+		return WaitResult::kStopped;
+	}
+#endif
+
+	FileWatcher::FileWatcher() = default;
+
+	FileWatcher::~FileWatcher()
+	{
+		Stop();
+	}
+
+	bool FileWatcher::Start(const std::filesystem::path& a_file, Callback a_onChange)
+	{
+		Stop();
+
+		auto watched = std::make_unique<Platform>();
+		if (!watched->Open(a_file.has_parent_path() ? a_file.parent_path() : std::filesystem::path("."))) {
+			return false;
+		}
+
+		fileName = a_file.filename();
+		onChange = std::move(a_onChange);
+		platform = std::move(watched);
+		thread = std::thread(&FileWatcher::Run, this);
+		return true;
+	}
+
+	void FileWatcher::Stop()
+	{
+		if (!thread.joinable()) {
+			return;
+		}
+		platform->Signal();
+		thread.join();
+		platform.reset();
+	}
+
+	void FileWatcher::Run()
+	{
+		// Once a change is seen, wait for kQuietMs without another one before reporting it
+		bool pending = false;
+		for (;;) {
+			switch (Wait(pending ? kQuietMs : -1)) {
+			case WaitResult::kChanged:
+				pending = true;
+				break;
+			case WaitResult::kTimeout:
+				if (pending) {
+					pending = false;
+					onChange();
+				}
+				break;
+			case WaitResult::kIgnored:
+				break;
+			case WaitResult::kStopped:
+				return;
+			}
+		}
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <thread>
+
+// Change notification for a single file, off the game thread.
+//
+// A background thread blocks on the file's directory (ReadDirectoryChangesW on
+// Windows, inotify elsewhere) and calls the callback on that thread once writes
+// to the file have gone quiet for kQuietMs, so an editor saving in several
+// steps is reported once.
+namespace SettleCore
+{
+	class FileWatcher
+	{
+	public:
+		using Callback = std::function<void()>;
+
+		static constexpr int kQuietMs = 100;
+
+		FileWatcher();
+		FileWatcher(const FileWatcher&) = delete;
+		FileWatcher& operator=(const FileWatcher&) = delete;
+		~FileWatcher();
+
+		// Returns false if the file's directory cannot be watched
+		bool Start(const std::filesystem::path& a_file, Callback a_onChange);
+
+		// Blocks until the watcher thread has exited; no callback runs after this returns
+		void Stop();
+
+		bool IsRunning() const { return thread.joinable(); }
+
+	private:
+		enum class WaitResult
+		{
+			kChanged,  // The watched file was written, created or renamed into place
+			kIgnored,  // Some other file in the directory changed
+			kTimeout,
+			kStopped
+		};
+
+		struct Platform;
+
+		void Run();
+		WaitResult Wait(int a_timeoutMs);  // a_timeoutMs < 0 waits forever
+
+		std::filesystem::path fileName;
+		Callback onChange;
+		std::unique_ptr<Platform> platform;
+		std::thread thread;
+	};
+}
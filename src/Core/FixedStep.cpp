@@ -0,0 +1,36 @@
+#include "Core/FixedStep.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SettleCore
+{
+	int FixedStepClock::Advance(float a_delta, int a_rate, int a_maxSteps)
+	{
+		float step = 1.0f / static_cast<float>(std::max(a_rate, 1));
+		if (step != stepDelta) {
+			// Rate changed: keep the same fraction of a step so interpolation doesn't pop
+			accumulator = stepDelta > 0.0f ? accumulator / stepDelta * step : 0.0f;
+			stepDelta = step;
+		}
+
+		accumulator += std::max(a_delta, 0.0f);
+		int numSteps = static_cast<int>(std::floor(accumulator / stepDelta));
+		accumulator -= static_cast<float>(numSteps) * stepDelta;
+
+		// Float error can leave the remainder a hair outside [0, step)
+		if (accumulator >= stepDelta) {
+			accumulator -= stepDelta;
+			++numSteps;
+		} else if (accumulator < 0.0f) {
+			accumulator = 0.0f;
+		}
+
+		int maxSteps = std::max(a_maxSteps, 1);
+		if (numSteps > maxSteps) {
+			droppedSteps += numSteps - maxSteps;
+			numSteps = maxSteps;
+		}
+		return numSteps;
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+namespace SettleCore
+{
+	// Fixed-timestep accumulator. Frame deltas are banked and consumed in whole
+	// steps of GetStepDelta(); the leftover fraction of a step is exposed as
+	// GetAlpha() so the renderer can interpolate between the last two states.
+	// Given the same impulse timeline, the simulated states are identical at
+	// any frame rate.
+	class FixedStepClock
+	{
+	public:
+		// Bank a_delta and return how many steps of 1 / a_rate to run this frame.
+		// At most a_maxSteps are returned; time beyond that is dropped (hitch guard).
+		int Advance(float a_delta, int a_rate, int a_maxSteps);
+
+		float GetStepDelta() const { return stepDelta; }
+
+		// Fraction of a step between the last simulated state and render time (0..1)
+		float GetAlpha() const { return stepDelta > 0.0f ? accumulator / stepDelta : 1.0f; }
+
+		// Steps dropped by the a_maxSteps cap since construction (diagnostics)
+		int GetDroppedSteps() const { return droppedSteps; }
+
+		void Reset() { accumulator = 0.0f; }
+
+	private:
+		float accumulator{ 0.0f };
+		float stepDelta{ 0.0f };
+		int droppedSteps{ 0 };
+	};
+}
@@ -0,0 +1,21 @@
+#include "Core/GraphVariables.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace SettleCore
+{
+	bool GraphVariableHandles::SameName(std::string_view a_lhs, std::string_view a_rhs)
+	{
+		return std::ranges::equal(a_lhs, a_rhs, [](char a_l, char a_r) {
+			return std::tolower(static_cast<unsigned char>(a_l)) == std::tolower(static_cast<unsigned char>(a_r));
+		});
+	}
+
+	void GraphVariableHandles::Clear()
+	{
+		graph = nullptr;
+		count = 0;
+		indices.fill(kUnresolved);
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Core/PlayerState.h"
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+namespace SettleCore
+{
+	// Behavior graph variables copied into the PlayerStateSnapshot. A new
+	// graph-driven trigger is a snapshot field plus a row here; the plugin
+	// resolves every row once per graph and reads them by index.
+	struct GraphVariable
+	{
+		const char* name;
+		bool PlayerStateSnapshot::*field;
+	};
+
+	inline constexpr GraphVariable kGraphVariables[] = {
+		{ "bAnimationDriven", &PlayerStateSnapshot::animationDriven },
+		{ "IsJumping", &PlayerStateSnapshot::jumping }
+	};
+	inline constexpr int kGraphVariableCount = static_cast<int>(std::size(kGraphVariables));
+
+	// Index of every kGraphVariables row in one behavior graph's variable list,
+	// resolved when that graph is first seen instead of by name on every read
+	class GraphVariableHandles
+	{
+	public:
+		static constexpr std::int32_t kUnresolved = -1;
+
+		// Graph names compare case-insensitively, as BSFixedString lookups do
+		static bool SameName(std::string_view a_lhs, std::string_view a_rhs);
+
+		// a_nameAt(i) returns the name of variable i of a_graph, for i < a_count
+		template <class NameAt>
+		void Resolve(const void* a_graph, std::int32_t a_count, NameAt a_nameAt)
+		{
+			indices.fill(kUnresolved);
+			for (std::int32_t index = 0; index < a_count; ++index) {
+				const std::string_view name = a_nameAt(index);
+				for (int variable = 0; variable < kGraphVariableCount; ++variable) {
+					if (indices[variable] == kUnresolved && SameName(name, kGraphVariables[variable].name)) {
+						indices[variable] = index;
+					}
+				}
+			}
+			graph = a_graph;
+			count = a_count;
+		}
+
+		bool IsResolvedFor(const void* a_graph, std::int32_t a_count) const { return graph == a_graph && count == a_count; }
+
+		std::int32_t Get(int a_variable) const { return indices[a_variable]; }
+
+		// Drop one handle so reads of it go back to the name lookup
+		void Invalidate(int a_variable) { indices[a_variable] = kUnresolved; }
+
+		void Clear();
+
+	private:
+		const void* graph{ nullptr };
+		std::int32_t count{ 0 };
+		std::array<std::int32_t, kGraphVariableCount> indices{};
+	};
+}
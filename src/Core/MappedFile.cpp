@@ -0,0 +1,106 @@
+#include "Core/MappedFile.h"
+
+#if defined(_WIN32)
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <Windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace SettleCore
+{
+#if defined(_WIN32)
+	bool MappedFile::Open(const std::filesystem::path& a_path)
+	{
+		Close();
+
+		// Share delete so a save can still rename over the file while it is mapped
+		HANDLE handle = CreateFileW(a_path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+			nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (handle == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+		file = handle;
+
+		LARGE_INTEGER length{};
+		if (!GetFileSizeEx(handle, &length)) {
+			Close();
+			return false;
+		}
+		if (length.QuadPart == 0) {
+			return true;
+		}
+
+		mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping) {
+			Close();
+			return false;
+		}
+		data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!data) {
+			Close();
+			return false;
+		}
+		size = static_cast<std::size_t>(length.QuadPart);
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (data) {
+			UnmapViewOfFile(data);
+		}
+		if (mapping) {
+			CloseHandle(mapping);
+		}
+		if (file) {
+			CloseHandle(file);
+		}
+		data = nullptr;
+		size = 0;
+		mapping = nullptr;
+		file = nullptr;
+	}
+#else
+	bool MappedFile::Open(const std::filesystem::path& a_path)
+	{
+		Close();
+
+		int fd = open(a_path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) {
+			return false;
+		}
+
+		// The mapping keeps the file alive, so the descriptor can go right away
+		struct stat info{};
+		bool ok = fstat(fd, &info) == 0;
+		if (ok && info.st_size > 0) {
+			void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			ok = view != MAP_FAILED;
+			if (ok) {
+				data = static_cast<const char*>(view);
+				size = static_cast<std::size_t>(info.st_size);
+			}
+		}
+		close(fd);
+		return ok;
+	}
+
+	void MappedFile::Close()
+	{
+		if (data) {
+			munmap(const_cast<char*>(data), size);
+		}
+		data = nullptr;
+		size = 0;
+	}
+#endif
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace SettleCore
+{
+	// Read-only memory mapping of a whole file. The view stays valid until Close()
+	// or destruction; an empty file maps to an empty view.
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile() { Close(); }
+
+		bool Open(const std::filesystem::path& a_path);
+		void Close();
+
+		std::string_view View() const { return { data, size }; }
+
+	private:
+		const char* data{ nullptr };
+		std::size_t size{ 0 };
+#if defined(_WIN32)
+		void* file{ nullptr };     // HANDLE
+		void* mapping{ nullptr };  // HANDLE
+#endif
+	};
+}
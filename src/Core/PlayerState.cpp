@@ -0,0 +1,99 @@
+#include "Core/PlayerState.h"
+#include "Core/Replay.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace SettleCore
+{
+	namespace
+	{
+		// Movement action of every stick/stance combination, indexed by the stick bits (1 = forward,
+		// 2 = backward, 4 = left, 8 = right) plus 16 = walking, 32 = sneaking, 64 = sprinting.
+		// Forward/backward win over strafing, forward over backward and left over right; sprint only
+		// counts moving forward. One byte per entry keeps the whole table in two cache lines.
+		constexpr auto MOVEMENT_ACTIONS = [] {
+			std::array<std::uint8_t, 128> actions{};
+			for (int index = 0; index < 128; ++index) {
+				const int cardinal = (index & 1) ? 0 : (index & 2) ? 2 : (index & 4) ? 3 : (index & 8) ? 1 : -1;
+				ActionType action = ActionType::kTotal;
+				if (cardinal == 0 && (index & 64)) {
+					action = ActionType::SprintForward;
+				} else if (cardinal >= 0) {
+					// If walking flag is not set, player runs (sneak runs while sneaking)
+					action = kBlendSpaceActions[(index & 32) != 0][(index & 16) == 0][cardinal];
+				}
+				actions[index] = static_cast<std::uint8_t>(action);
+			}
+			return actions;
+		}();
+		static_assert(static_cast<int>(ActionType::kTotal) < 256, "MOVEMENT_ACTIONS stores an ActionType per byte");
+	}
+
+	ActionType DetectMovementAction(const PlayerStateSnapshot& a_state)
+	{
+		// Threshold for movement detection
+		constexpr float THRESHOLD = 0.3f;
+
+		const int index = (a_state.moveInputY > THRESHOLD) | (a_state.moveInputY < -THRESHOLD) << 1 |
+		                  (a_state.moveInputX < -THRESHOLD) << 2 | (a_state.moveInputX > THRESHOLD) << 3 |
+		                  a_state.walking << 4 | a_state.sneaking << 5 | a_state.sprinting << 6;
+		return static_cast<ActionType>(MOVEMENT_ACTIONS[index]);
+	}
+
+	Replay::InputFrame ToInputFrame(const PlayerStateSnapshot& a_state)
+	{
+		using namespace Replay;
+
+		InputFrame input;
+		input.delta = a_state.delta;
+		const std::pair<std::uint32_t, bool> flags[] = {
+			{ InputFlag::kWeaponDrawn, a_state.weaponDrawn },
+			{ InputFlag::kSprinting, a_state.sprinting },
+			{ InputFlag::kSneaking, a_state.sneaking },
+			{ InputFlag::kWalking, a_state.walking },
+			{ InputFlag::kInMidair, a_state.inMidair },
+			{ InputFlag::kSwimming, a_state.swimming },
+			{ InputFlag::kAnimationDriven, a_state.animationDriven },
+			{ InputFlag::kIsJumping, a_state.jumping },
+			{ InputFlag::kDialogueOpen, a_state.dialogueOpen },
+			{ InputFlag::kMapOpen, a_state.mapOpen },
+			{ InputFlag::kBowDrawn, a_state.bowDrawn }
+		};
+		for (const auto& [flag, set] : flags) {
+			if (set) {
+				input.flags |= flag;
+			}
+		}
+		input.moveInputX = a_state.moveInputX;
+		input.moveInputY = a_state.moveInputY;
+		input.positionZ = a_state.positionZ;
+		input.archerySkill = a_state.archerySkill;
+		return input;
+	}
+
+	PlayerStateSnapshot FromInputFrame(const Replay::InputFrame& a_input)
+	{
+		using namespace Replay;
+
+		PlayerStateSnapshot state;
+		state.delta = a_input.delta;
+		state.moveInputX = a_input.moveInputX;
+		state.moveInputY = a_input.moveInputY;
+		state.positionZ = a_input.positionZ;
+		state.archerySkill = a_input.archerySkill;
+		state.weaponDrawn = (a_input.flags & InputFlag::kWeaponDrawn) != 0;
+		state.sprinting = (a_input.flags & InputFlag::kSprinting) != 0;
+		state.sneaking = (a_input.flags & InputFlag::kSneaking) != 0;
+		state.walking = (a_input.flags & InputFlag::kWalking) != 0;
+		state.inMidair = (a_input.flags & InputFlag::kInMidair) != 0;
+		state.swimming = (a_input.flags & InputFlag::kSwimming) != 0;
+		state.animationDriven = (a_input.flags & InputFlag::kAnimationDriven) != 0;
+		state.jumping = (a_input.flags & InputFlag::kIsJumping) != 0;
+		state.dialogueOpen = (a_input.flags & InputFlag::kDialogueOpen) != 0;
+		state.mapOpen = (a_input.flags & InputFlag::kMapOpen) != 0;
+		state.bowDrawn = (a_input.flags & InputFlag::kBowDrawn) != 0;
+		return state;
+	}
+}
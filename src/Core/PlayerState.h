@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Core/ActionTraits.h"
+
+namespace SettleCore
+{
+	namespace Replay
+	{
+		struct InputFrame;
+	}
+
+	// Engine state one Update() reads, gathered once at its top and passed to
+	// every stage, so they all see the same frame and never query the engine
+	// again. A few fields are only read when something can use them; the rest
+	// of the frame treats them as false/zero otherwise.
+	struct PlayerStateSnapshot
+	{
+		float delta{ 0.0f };
+		float moveInputX{ 0.0f };    // PlayerControls move input (x = right, y = forward)
+		float moveInputY{ 0.0f };
+		float positionZ{ 0.0f };
+		float archerySkill{ 0.0f };  // Only read while a bow/crossbow is drawn
+
+		bool weaponDrawn{ false };
+		bool sprinting{ false };
+		bool sneaking{ false };
+		bool walking{ false };          // Walk/run toggle set to walk
+		bool inMidair{ false };
+		bool swimming{ false };
+		bool animationDriven{ false };  // bAnimationDriven graph variable, only read on the takeoff frame
+		bool jumping{ false };          // IsJumping graph variable, only read on the takeoff frame
+		bool dialogueOpen{ false };
+		bool mapOpen{ false };
+		bool bowDrawn{ false };         // Bow/crossbow in a draw attack state, only read with the weapon drawn
+	};
+
+	// Movement action for the frame's input and stance (kTotal = not moving).
+	// Forward/backward win over strafing; sprint only counts moving forward.
+	ActionType DetectMovementAction(const PlayerStateSnapshot& a_state);
+
+	// The snapshot as the replay recorder stores it, and back (for offline analysis)
+	Replay::InputFrame ToInputFrame(const PlayerStateSnapshot& a_state);
+	PlayerStateSnapshot FromInputFrame(const Replay::InputFrame& a_input);
+}
@@ -0,0 +1,355 @@
+#include "Core/Replay.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace SettleCore::Replay
+{
+	namespace
+	{
+		// Bitwise comparisons, so -0.0 vs 0.0 counts as an edit
+		template <class T>
+		bool SameBits(const T& a_lhs, const T& a_rhs)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			return std::memcmp(&a_lhs, &a_rhs, sizeof(T)) == 0;
+		}
+	}
+
+	std::size_t PayloadSize(RecordType a_type)
+	{
+		switch (a_type) {
+		case RecordType::kKeyframe:
+			return sizeof(Keyframe);
+		case RecordType::kInput:
+			return sizeof(InputFrame);
+		case RecordType::kEvent:
+			return sizeof(Event);
+		case RecordType::kLayerParams:
+			return sizeof(LayerParamsRecord);
+		case RecordType::kLayerEdit:
+			return sizeof(LayerEditRecord);
+		case RecordType::kCore:
+			return sizeof(CoreFrame);
+		case RecordType::kDetectorSettings:
+			return sizeof(DetectorSettings);
+		default:
+			return 0;
+		}
+	}
+
+	LayerParams GetLayerParams(const ActionSettings& a_settings)
+	{
+		return { a_settings.Stiffness(), a_settings.Damping(), a_settings.PositionStrength(), a_settings.RotationStrength(), a_settings.integrator, a_settings.maxStableStep };
+	}
+
+	void ApplyLayerParams(ActionSettings& a_settings, const LayerParams& a_params)
+	{
+		a_settings.Stiffness() = a_params.stiffness;
+		a_settings.Damping() = a_params.damping;
+		a_settings.PositionStrength() = a_params.positionStrength;
+		a_settings.RotationStrength() = a_params.rotationStrength;
+		a_settings.integrator = a_params.integrator;
+		a_settings.maxStableStep = a_params.maxStableStep;
+	}
+
+	DetectorSettings GetDetectorSettings(const SettingsData& a_settings)
+	{
+		DetectorSettings detector;
+		detector.jumpMinAirTime = a_settings.jumpMinAirTime;
+		detector.jumpMaxAirTimeScale = a_settings.jumpMaxAirTimeScale;
+		detector.landBaseScale = a_settings.landBaseScale;
+		detector.landAirTimeScale = a_settings.landAirTimeScale;
+		detector.walkToRunGracePeriod = a_settings.walkToRunGracePeriod;
+		detector.scaleJumpByAirTime = a_settings.scaleJumpByAirTime;
+		detector.speedBasedBlending = a_settings.speedBasedBlending;
+		detector.weaponDrawnEnabled = a_settings.weaponDrawnEnabled;
+		detector.weaponSheathedEnabled = a_settings.weaponSheathedEnabled;
+
+		// Same multipliers as CameraSettleManager::ResolveImpulse
+		for (const bool drawn : { false, true }) {
+			const float globalMult = a_settings.globalIntensity * (drawn ? a_settings.weaponDrawnMult : a_settings.weaponSheathedMult);
+			for (int action = 0; action < static_cast<int>(ActionType::kTotal); ++action) {
+				if (ResolveImpulse(a_settings.GetActionSettingsForState(static_cast<ActionType>(action), drawn), globalMult).enabled) {
+					detector.enabledActions[drawn ? SettingsData::kDrawn : SettingsData::kSheathed] |= 1u << action;
+				}
+			}
+		}
+		return detector;
+	}
+
+	void ApplyDetectorSettings(SettingsData& a_settings, const DetectorSettings& a_detector)
+	{
+		a_settings.jumpMinAirTime = a_detector.jumpMinAirTime;
+		a_settings.jumpMaxAirTimeScale = a_detector.jumpMaxAirTimeScale;
+		a_settings.landBaseScale = a_detector.landBaseScale;
+		a_settings.landAirTimeScale = a_detector.landAirTimeScale;
+		a_settings.walkToRunGracePeriod = a_detector.walkToRunGracePeriod;
+		a_settings.scaleJumpByAirTime = a_detector.scaleJumpByAirTime;
+		a_settings.speedBasedBlending = a_detector.speedBasedBlending;
+		a_settings.weaponDrawnEnabled = a_detector.weaponDrawnEnabled;
+		a_settings.weaponSheathedEnabled = a_detector.weaponSheathedEnabled;
+	}
+
+	bool CommandEdits(const ImpulseCommand& a_command, bool a_weaponDrawn, const DetectorSettings& a_detector)
+	{
+		// Walk/run impulses come from the blend space; the command's own action stands in for it
+		const auto action = static_cast<unsigned>(a_command.source == ImpulseSource::kSprintReverse ? ActionType::SprintForward : a_command.action);
+		return a_command.source != ImpulseSource::kNone && a_command.scale > 0.0f && action < static_cast<unsigned>(ActionType::kTotal) &&
+		       (a_detector.enabledActions[a_weaponDrawn ? SettingsData::kDrawn : SettingsData::kSheathed] >> action & 1u) != 0;
+	}
+
+	void ApplyKeyframe(const Keyframe& a_keyframe, SpringRig& a_rig, IdleNoiseState& a_noise)
+	{
+		for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+			a_rig.springs[layer] = a_keyframe.springs[layer];
+			a_rig.blends[layer] = a_keyframe.blends[layer];
+		}
+		std::copy(std::begin(a_keyframe.total), std::end(a_keyframe.total), std::begin(a_rig.bank.total));
+		std::copy(std::begin(a_keyframe.previousTotal), std::end(a_keyframe.previousTotal), std::begin(a_rig.bank.previousTotal));
+		a_rig.clock = a_keyframe.clock;
+		a_rig.alpha = a_keyframe.alpha;
+		a_noise = a_keyframe.noise;
+	}
+
+	void Recorder::SetEnabled(bool a_enabled)
+	{
+		std::scoped_lock guard(lock);
+		if (a_enabled == enabled) {
+			return;
+		}
+		enabled = a_enabled;
+		if (a_enabled) {
+			// Reserve every chunk up front so recording never allocates mid-session
+			constexpr std::size_t FRAME_BYTES = 2 + sizeof(InputFrame) + sizeof(CoreFrame) + 4 * (1 + sizeof(LayerEditRecord));
+			for (auto& chunk : chunks) {
+				chunk.reserve(1 + sizeof(Keyframe) + kFramesPerChunk * FRAME_BYTES);
+			}
+		} else {
+			ClearLocked();
+		}
+	}
+
+	void Recorder::Clear()
+	{
+		std::scoped_lock guard(lock);
+		ClearLocked();
+	}
+
+	void Recorder::ClearLocked()
+	{
+		for (auto& chunk : chunks) {
+			chunk.clear();
+		}
+		currentChunk = -1;
+		chunkFrames = 0;
+		usedChunks = 0;
+		keyframePending = true;
+		time = 0.0f;
+	}
+
+	template <class T>
+	void Recorder::Write(RecordType a_type, const T& a_payload)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		if (currentChunk < 0) {
+			return;
+		}
+		auto& chunk = chunks[currentChunk];
+		const auto* bytes = reinterpret_cast<const std::uint8_t*>(&a_payload);
+		chunk.push_back(static_cast<std::uint8_t>(a_type));
+		chunk.insert(chunk.end(), bytes, bytes + sizeof(T));
+	}
+
+	void Recorder::StartChunk()
+	{
+		currentChunk = (currentChunk + 1) % kChunkCount;
+		usedChunks = std::min(usedChunks + 1, kChunkCount);
+		chunks[currentChunk].clear();
+		chunkFrames = 0;
+		keyframePending = true;
+	}
+
+	void Recorder::RecordEvent(Event a_event)
+	{
+		if (!enabled) {
+			return;
+		}
+		std::scoped_lock guard(lock);
+		a_event.time = time;
+		Write(RecordType::kEvent, a_event);
+	}
+
+	void Recorder::BeginFrame(InputFrame a_input, const SpringRig& a_rig, const IdleNoiseState& a_noise, const ActionStateMachine& a_detector,
+		const DetectorSettings& a_detectorSettings)
+	{
+		if (!enabled) {
+			return;
+		}
+		std::scoped_lock guard(lock);
+
+		if (currentChunk < 0 || chunkFrames >= kFramesPerChunk) {
+			StartChunk();
+		}
+
+		if (keyframePending) {
+			Keyframe keyframe;
+			for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+				keyframe.springs[layer] = a_rig.springs[layer];
+				keyframe.blends[layer] = a_rig.blends[layer];
+				keyframe.params[layer] = shadowParams[layer];
+				shadowSprings[layer] = a_rig.springs[layer];
+				shadowBlends[layer] = a_rig.blends[layer];
+			}
+			std::copy(std::begin(a_rig.bank.total), std::end(a_rig.bank.total), std::begin(keyframe.total));
+			std::copy(std::begin(a_rig.bank.previousTotal), std::end(a_rig.bank.previousTotal), std::begin(keyframe.previousTotal));
+			keyframe.clock = a_rig.clock;
+			keyframe.alpha = a_rig.alpha;
+			keyframe.noise = a_noise;
+			keyframe.detector = a_detector;
+			keyframe.detectorSettings = a_detectorSettings;
+			shadowDetectorSettings = a_detectorSettings;
+			Write(RecordType::kKeyframe, keyframe);
+			keyframePending = false;
+		}
+
+		// Ahead of the Input record, so replay steps the detector with them
+		if (!(a_detectorSettings == shadowDetectorSettings)) {
+			shadowDetectorSettings = a_detectorSettings;
+			Write(RecordType::kDetectorSettings, a_detectorSettings);
+		}
+
+		time += a_input.delta;
+		a_input.time = time;
+		Write(RecordType::kInput, a_input);
+		++chunkFrames;
+	}
+
+	void Recorder::RecordStep(const RigFrame& a_frame, const SpringRig& a_rig)
+	{
+		if (!enabled) {
+			return;
+		}
+		std::scoped_lock guard(lock);
+
+		for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+			LayerParams params = GetLayerParams(*a_frame.layerSettings[layer]);
+			if (!(params == shadowParams[layer])) {
+				shadowParams[layer] = params;
+				Write(RecordType::kLayerParams, LayerParamsRecord{ static_cast<std::uint8_t>(layer), params });
+			}
+
+			// Impulses, velocity damping and blend flushes all show up as a state change
+			if (!SameBits(a_rig.springs[layer], shadowSprings[layer]) || !SameBits(a_rig.blends[layer], shadowBlends[layer])) {
+				Write(RecordType::kLayerEdit, LayerEditRecord{ static_cast<std::uint8_t>(layer), a_rig.springs[layer], a_rig.blends[layer] });
+			}
+		}
+	}
+
+	void Recorder::EndFrame(const RigFrame& a_frame, const IdleNoiseFrame& a_noiseFrame, const SpringRig& a_rig, const IdleNoiseState& a_noise)
+	{
+		if (!enabled) {
+			return;
+		}
+		std::scoped_lock guard(lock);
+
+		CoreFrame core;
+		core.delta = a_frame.delta;
+		core.dampingMult = a_frame.dampingMult;
+		core.settingsVersion = a_frame.settingsVersion;
+		core.fixedStepRate = a_frame.fixedStepRate;
+		core.integrator = static_cast<std::uint8_t>(a_frame.integrator);
+		core.substeps = static_cast<std::uint8_t>(a_frame.substeps);
+		core.maxFixedSteps = static_cast<std::uint8_t>(a_frame.maxFixedSteps);
+		core.kernel = static_cast<std::uint8_t>(GetSpringKernel());
+		core.weaponDrawn = a_frame.weaponDrawn;
+		core.autoSubsteps = a_frame.autoSubsteps;
+		for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+			core.layerActions[layer] = static_cast<std::uint8_t>(a_frame.layerActions[layer]);
+		}
+		core.noise = a_noiseFrame;
+		CombineOffsets(a_rig, a_noise, core.position, core.rotation);
+		Write(RecordType::kCore, core);
+
+		for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+			shadowSprings[layer] = a_rig.springs[layer];
+			shadowBlends[layer] = a_rig.blends[layer];
+		}
+	}
+
+	bool Recorder::Dump(const std::filesystem::path& a_path) const
+	{
+		std::scoped_lock guard(lock);
+		std::ofstream file(a_path, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			return false;
+		}
+
+		FileHeader header;
+		for (int type = 0; type < static_cast<int>(RecordType::kTotal); ++type) {
+			header.recordSizes[type] = static_cast<std::uint32_t>(PayloadSize(static_cast<RecordType>(type)));
+		}
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		// Oldest chunk first; the current chunk is always the newest
+		for (int i = usedChunks - 1; i >= 0; --i) {
+			const auto& chunk = chunks[(currentChunk - i + kChunkCount) % kChunkCount];
+			file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+		}
+		return static_cast<bool>(file);
+	}
+
+	bool Reader::Open(const std::filesystem::path& a_path)
+	{
+		std::ifstream file(a_path, std::ios::binary);
+		if (!file) {
+			error = "cannot open file";
+			return false;
+		}
+		bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		position = 0;
+
+		FileHeader header;
+		if (bytes.size() < sizeof(header)) {
+			error = "file too short";
+			return false;
+		}
+		std::memcpy(&header, bytes.data(), sizeof(header));
+		if (header.magic != kMagic) {
+			error = "not a settle recording";
+			return false;
+		}
+		if (header.version != kVersion) {
+			error = "unsupported recording version";
+			return false;
+		}
+		for (int type = 0; type < static_cast<int>(RecordType::kTotal); ++type) {
+			if (header.recordSizes[type] != PayloadSize(static_cast<RecordType>(type))) {
+				error = "record layout mismatch (recorded by a different build)";
+				return false;
+			}
+		}
+
+		position = sizeof(header);
+		return true;
+	}
+
+	bool Reader::Next(RecordType& a_type, const std::uint8_t*& a_payload)
+	{
+		if (position >= bytes.size()) {
+			return false;
+		}
+		a_type = static_cast<RecordType>(bytes[position]);
+		std::size_t size = PayloadSize(a_type);
+		if (size == 0 || position + 1 + size > bytes.size()) {
+			error = size == 0 ? "unknown record type" : "truncated record";
+			return false;
+		}
+		a_payload = bytes.data() + position + 1;
+		position += 1 + size;
+		return true;
+	}
+}
@@ -0,0 +1,293 @@
+#pragma once
+
+#include "Core/ActionStateMachine.h"
+#include "Core/SettingsData.h"
+#include "Core/SpringRig.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Deterministic input recording for offline replay (settle_replay).
+//
+// A recording is a header followed by a stream of records, each a one-byte
+// RecordType and a fixed-size POD payload. Every Update() writes an Input
+// record (raw engine state) and a Core record (everything SpringRig::Step and
+// UpdateIdleNoise consumed, plus the resulting camera offset). Layer edits made
+// by action detection and the event sinks are stored as LayerEdit records, and
+// per-layer spring settings as LayerParams records when they change. The
+// settings action detection reads are stored as a DetectorSettings record when
+// they change. Keyframes hold the full core state and the action state machine,
+// so replay can start at any keyframe.
+namespace SettleCore::Replay
+{
+	constexpr std::uint32_t kMagic = 0x52435046;  // "FPCR"
+	constexpr std::uint32_t kVersion = 5;  // 5: detector settings and state
+
+	// Engine state bits read by Update()/DetectActions (InputFrame::flags)
+	namespace InputFlag
+	{
+		constexpr std::uint32_t kWeaponDrawn = 1u << 0;
+		constexpr std::uint32_t kSprinting = 1u << 1;
+		constexpr std::uint32_t kSneaking = 1u << 2;
+		constexpr std::uint32_t kWalking = 1u << 3;
+		constexpr std::uint32_t kInMidair = 1u << 4;
+		constexpr std::uint32_t kSwimming = 1u << 5;
+		constexpr std::uint32_t kAnimationDriven = 1u << 6;  // bAnimationDriven graph variable
+		constexpr std::uint32_t kIsJumping = 1u << 7;        // IsJumping graph variable
+		constexpr std::uint32_t kDialogueOpen = 1u << 8;
+		constexpr std::uint32_t kMapOpen = 1u << 9;
+		constexpr std::uint32_t kBowDrawn = 1u << 10;        // Bow/crossbow in a draw attack state
+	}
+
+	enum class RecordType : std::uint8_t
+	{
+		kKeyframe = 0,
+		kInput,
+		kEvent,
+		kLayerParams,
+		kLayerEdit,
+		kCore,
+		kDetectorSettings,
+		kTotal
+	};
+
+	enum class EventType : std::uint8_t
+	{
+		kHitTaken = 0,        // TESHitEvent on the player (detail = blocked)
+		kHitting,             // TESHitEvent caused by the player
+		kPrecisionHit,        // Precision hit callback (detail = blocked)
+		kAnimation,           // Player animation event (detail = AnimTag)
+		kTriggerAction,       // TriggerAction API call (detail = ActionType)
+		kSprintStopAnimated,  // EndAnimatedCameraDelta reversed the sprint (ActionStateMachine::SetSprintStopAnimated)
+		kTotal
+	};
+
+	enum class AnimTag : std::uint8_t
+	{
+		kOther = 0,
+		kArrowRelease,
+		kBoltRelease,
+		kEndAnimatedCameraDelta
+	};
+
+	// Raw engine inputs for one Update(). Not needed to replay the core; kept so
+	// action detection can be analysed offline.
+	struct InputFrame
+	{
+		float time{ 0.0f };  // Seconds since recording started (filled in by the recorder)
+		float delta{ 0.0f };
+		std::uint32_t flags{ 0 };
+		float moveInputX{ 0.0f };
+		float moveInputY{ 0.0f };
+		float positionZ{ 0.0f };
+		float archerySkill{ 0.0f };
+	};
+
+	struct Event
+	{
+		float time{ 0.0f };  // Filled in by the recorder
+		EventType type{ EventType::kHitTaken };
+		std::uint8_t detail{ 0 };
+		float scale{ 1.0f };
+	};
+
+	// Spring settings a layer was integrated with (the parts of ActionSettings Step reads)
+	struct LayerParams
+	{
+		float stiffness{ 0.0f };
+		float damping{ 0.0f };
+		float positionStrength{ 0.0f };
+		float rotationStrength{ 0.0f };
+		std::int32_t integrator{ -1 };
+		float maxStableStep{ 0.0f };
+
+		bool operator==(const LayerParams&) const = default;
+	};
+
+	struct LayerParamsRecord
+	{
+		std::uint8_t layer{ 0 };
+		LayerParams params;
+	};
+
+	// What ActionStateMachine::Step reads from SettingsData, whether DetectActions runs it
+	// for each weapon state, and which actions' impulses are enabled (a command for a
+	// disabled action edits nothing)
+	struct DetectorSettings
+	{
+		float jumpMinAirTime{ 0.0f };
+		float jumpMaxAirTimeScale{ 0.0f };
+		float landBaseScale{ 0.0f };
+		float landAirTimeScale{ 0.0f };
+		float walkToRunGracePeriod{ 0.0f };
+		bool scaleJumpByAirTime{ false };
+		bool speedBasedBlending{ false };
+		bool weaponDrawnEnabled{ false };
+		bool weaponSheathedEnabled{ false };
+		std::uint32_t enabledActions[2]{};  // Bit per ActionType, [SettingsData::kSheathed / kDrawn]
+
+		bool operator==(const DetectorSettings&) const = default;
+	};
+
+	struct LayerEditRecord
+	{
+		std::uint8_t layer{ 0 };
+		SpringState spring;
+		PendingBlend blend;
+	};
+
+	// Everything Update() fed the portable core for one frame, and what came out
+	struct CoreFrame
+	{
+		float delta{ 0.0f };
+		float dampingMult{ 1.0f };
+		std::uint32_t settingsVersion{ 0 };
+		std::int32_t fixedStepRate{ 0 };
+		std::uint8_t integrator{ 0 };
+		std::uint8_t substeps{ 0 };
+		std::uint8_t maxFixedSteps{ 0 };
+		std::uint8_t kernel{ 0 };  // SpringKernel used, so the replay runs the same code
+		bool weaponDrawn{ false };
+		bool autoSubsteps{ false };
+		std::uint8_t layerActions[kSpringLayerCount]{};
+		IdleNoiseFrame noise;
+
+		// Resulting camera offset (springs + idle noise)
+		Vec3 position;
+		Vec3 rotation;
+	};
+
+	struct Keyframe
+	{
+		SpringState springs[kSpringLayerCount];
+		PendingBlend blends[kSpringLayerCount];
+		float total[SpringBank::kLaneStride]{};
+		float previousTotal[SpringBank::kLaneStride]{};
+		FixedStepClock clock;
+		float alpha{ 1.0f };
+		IdleNoiseState noise;
+		LayerParams params[kSpringLayerCount];
+		ActionStateMachine detector;  // Before this frame's Step
+		DetectorSettings detectorSettings;
+	};
+
+	struct FileHeader
+	{
+		std::uint32_t magic{ kMagic };
+		std::uint32_t version{ kVersion };
+		std::uint32_t recordSizes[static_cast<int>(RecordType::kTotal)]{};  // Layout check on load
+	};
+
+	static_assert(std::is_trivially_copyable_v<Keyframe> && std::is_trivially_copyable_v<CoreFrame>);
+
+	// Payload size of each record type
+	std::size_t PayloadSize(RecordType a_type);
+
+	LayerParams GetLayerParams(const ActionSettings& a_settings);
+
+	// Fills the LayerParams-backed fields of a_settings
+	void ApplyLayerParams(ActionSettings& a_settings, const LayerParams& a_params);
+
+	DetectorSettings GetDetectorSettings(const SettingsData& a_settings);
+
+	// Fills the DetectorSettings-backed fields of a_settings (not the per-action tables)
+	void ApplyDetectorSettings(SettingsData& a_settings, const DetectorSettings& a_detector);
+
+	// Whether a command's impulse is enabled under a_detector, so it must show up as a layer edit
+	bool CommandEdits(const ImpulseCommand& a_command, bool a_weaponDrawn, const DetectorSettings& a_detector);
+
+	// Restore a_rig / a_noise from a keyframe (closed-form cache entries are left as they are)
+	void ApplyKeyframe(const Keyframe& a_keyframe, SpringRig& a_rig, IdleNoiseState& a_noise);
+
+	// Fixed-size ring of recent frames. Memory is split into chunks of
+	// kFramesPerChunk frames, each starting with a keyframe; when the ring is full
+	// the oldest chunk is reused, so a dump always starts at a keyframe.
+	// Writes are serialized, since events can arrive from other threads.
+	class Recorder
+	{
+	public:
+		static constexpr int kChunkCount = 32;
+		static constexpr int kFramesPerChunk = 120;  // ~1 minute of history at 60 fps
+
+		void SetEnabled(bool a_enabled);
+		bool IsEnabled() const { return enabled; }
+
+		// Force a keyframe at the next BeginFrame (after CameraSettleManager::Reset)
+		void RequestKeyframe() { keyframePending = true; }
+
+		// Hit/animation/API events, stamped with the current recording time
+		void RecordEvent(Event a_event);
+
+		// Top of a recorded Update(), before action detection touches the springs or steps a_detector
+		void BeginFrame(InputFrame a_input, const SpringRig& a_rig, const IdleNoiseState& a_noise, const ActionStateMachine& a_detector,
+			const DetectorSettings& a_detectorSettings);
+
+		// Right before SpringRig::Step: records layer settings and spring/blend edits made since the last frame
+		void RecordStep(const RigFrame& a_frame, const SpringRig& a_rig);
+
+		// After the springs and idle noise have been updated
+		void EndFrame(const RigFrame& a_frame, const IdleNoiseFrame& a_noiseFrame, const SpringRig& a_rig, const IdleNoiseState& a_noise);
+
+		// Write the ring, oldest chunk first. Returns false if the file could not be written.
+		bool Dump(const std::filesystem::path& a_path) const;
+
+		void Clear();
+
+	private:
+		template <class T>
+		void Write(RecordType a_type, const T& a_payload);
+
+		void StartChunk();
+		void ClearLocked();
+
+		mutable std::mutex lock;
+		std::vector<std::uint8_t> chunks[kChunkCount];
+		int currentChunk{ -1 };
+		int chunkFrames{ 0 };
+		int usedChunks{ 0 };
+		std::atomic<bool> enabled{ false };
+		std::atomic<bool> keyframePending{ true };
+		float time{ 0.0f };
+
+		// What the replay will have after the last frame, to detect edits
+		SpringState shadowSprings[kSpringLayerCount];
+		PendingBlend shadowBlends[kSpringLayerCount];
+		LayerParams shadowParams[kSpringLayerCount];
+		DetectorSettings shadowDetectorSettings;
+	};
+
+	// Sequential reader over a loaded recording
+	class Reader
+	{
+	public:
+		// Loads a_path and validates the header. Returns false (with a message in GetError) on failure.
+		bool Open(const std::filesystem::path& a_path);
+
+		// Next record; returns false at the end or on a truncated record
+		bool Next(RecordType& a_type, const std::uint8_t*& a_payload);
+
+		template <class T>
+		static T Read(const std::uint8_t* a_payload);
+
+		const char* GetError() const { return error; }
+
+	private:
+		std::vector<std::uint8_t> bytes;
+		std::size_t position{ 0 };
+		const char* error{ "" };
+	};
+
+	template <class T>
+	T Reader::Read(const std::uint8_t* a_payload)
+	{
+		T value;
+		std::memcpy(&value, a_payload, sizeof(T));
+		return value;
+	}
+}
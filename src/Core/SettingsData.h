@@ -0,0 +1,156 @@
+#pragma once
+
+#include "Core/ActionSettings.h"
+
+#include <cstdint>
+
+// Extra animation event tag from [AnimationEvents] that triggers an action (see SettleCore::AnimEventTable)
+struct AnimEventBinding
+{
+	static constexpr int kMaxTag = 48;  // Including the terminator
+
+	char tag[kMaxTag]{};  // Empty = unused slot
+	ActionType action{ ActionType::kTotal };
+};
+
+// Every value stored in FPCameraSettle.ini, as plain data so a parsed INI can be
+// cached as one binary blob (see Settings::LoadCache)
+struct SettingsData
+{
+	// === MASTER TOGGLE ===
+	bool enabled{ true };
+
+	// === WEAPON DRAWN SETTINGS ===
+	bool weaponDrawnEnabled{ true };     // Enable effects when weapon is drawn
+	bool weaponSheathedEnabled{ true };  // Enable effects when weapon is sheathed
+	float weaponDrawnMult{ 1.0f };       // Multiplier when weapon is drawn
+	float weaponSheathedMult{ 0.7f };    // Multiplier when weapon is sheathed
+
+	// === GENERAL SETTINGS ===
+	float globalIntensity{ 1.0f };    // Global intensity multiplier
+	float smoothingFactor{ 0.3f };    // Smoothing for input (0-1)
+
+	// === SETTLING BEHAVIOR ===
+	float settleDelay{ 0.1f };        // Delay before settling starts
+	float settleSpeed{ 3.0f };        // How fast settling occurs
+	float settleDampingMult{ 2.0f };  // Max damping multiplier when settled
+
+	// === PERFORMANCE ===
+	int springSubsteps{ 4 };      // Number of sub-steps for spring physics (1-8, higher = more stable but slower)
+	bool autoSubsteps{ true };    // Pick sub-steps per action from its stiffness/damping (springSubsteps becomes the cap)
+	int springIntegrator{ 0 };    // SpringIntegrator: 0 = Euler (uses sub-steps), 1 = Closed-form (exact), 2 = Implicit Euler, 3 = Verlet (uses sub-steps)
+	bool fixedTimestep{ false };  // Simulate springs at a fixed rate and interpolate for rendering
+	int fixedStepRate{ 240 };     // Fixed simulation rate in Hz (60-480)
+	int maxFixedSteps{ 8 };       // Max fixed steps per frame (1-16); extra time is dropped during hitches
+
+	// === BEHAVIOR ===
+	bool resetOnPause{ false };   // Reset springs when game is paused (menus, console, etc.)
+
+	// === WALK/RUN BLENDING ===
+	bool  speedBasedBlending{ true };    // Blend walk/run based on actual movement speed instead of binary toggle
+	float walkToRunGracePeriod{ 0.15f }; // Skip walk impulse if player reaches run speed within this time (seconds)
+
+	// === JUMP/LAND SCALING ===
+	bool  scaleJumpByAirTime{ true };     // Scale jump/land impulse based on air time
+	float jumpMinAirTime{ 0.15f };        // Minimum air time to trigger any landing impulse
+	float jumpMaxAirTimeScale{ 2.0f };    // Maximum air time for scaling purposes
+	float landBaseScale{ 0.3f };          // Base landing impulse scale (always applied)
+	float landAirTimeScale{ 0.7f };       // Additional scale from air time (0 to this value)
+
+	// === IDLE CAMERA NOISE ===
+	// Weapon Drawn
+	bool  idleNoiseEnabledDrawn{ false };
+	float idleNoisePosAmpXDrawn{ 0.0f };      // Position amplitude X (left/right)
+	float idleNoisePosAmpYDrawn{ 0.0f };      // Position amplitude Y (forward/back)
+	float idleNoisePosAmpZDrawn{ 0.02f };     // Position amplitude Z (up/down breathing)
+	float idleNoiseRotAmpXDrawn{ 0.1f };      // Rotation amplitude pitch (degrees)
+	float idleNoiseRotAmpYDrawn{ 0.0f };      // Rotation amplitude roll (degrees)
+	float idleNoiseRotAmpZDrawn{ 0.05f };     // Rotation amplitude yaw (degrees)
+	float idleNoiseFrequencyDrawn{ 0.3f };    // Noise frequency (cycles per second)
+
+	// Weapon Sheathed
+	bool  idleNoiseEnabledSheathed{ true };
+	float idleNoisePosAmpXSheathed{ 0.0f };
+	float idleNoisePosAmpYSheathed{ 0.0f };
+	float idleNoisePosAmpZSheathed{ 0.03f };
+	float idleNoiseRotAmpXSheathed{ 0.15f };
+	float idleNoiseRotAmpYSheathed{ 0.0f };
+	float idleNoiseRotAmpZSheathed{ 0.08f };
+	float idleNoiseFrequencySheathed{ 0.25f };
+
+	// Shared idle noise setting
+	float idleNoiseBlendTime{ 0.25f };        // Blend in/out time in seconds
+	bool  dialogueDisableIdleNoise{ false };  // Disable idle noise when in dialogue
+
+	// Archery idle noise scaling
+	bool  idleNoiseScaleDuringArchery{ true };    // Scale idle noise down while drawing bow/crossbow
+	float idleNoiseArcheryScaleAmount{ 0.10f };  // Scale amount while drawing (0-1)
+	bool  idleNoiseArcheryScaleBySkill{ false };  // Scale amount based on Archery skill
+
+	// === SPRINT EFFECTS ===
+	bool  sprintFovEnabled{ true };
+	float sprintFovDelta{ 10.0f };            // FOV increase when sprinting (degrees)
+	float sprintFovBlendSpeed{ 3.0f };        // How fast to blend FOV (higher = faster)
+
+	bool  sprintBlurEnabled{ false };
+	float sprintBlurStrength{ 0.3f };         // Radial blur strength (0-1)
+	float sprintBlurBlendSpeed{ 3.0f };       // How fast to blend blur (higher = faster)
+	float sprintBlurRampUp{ 0.1f };           // IMOD ramp up time (seconds) - how fast blur fades in
+	float sprintBlurRampDown{ 0.2f };         // IMOD ramp down time (seconds) - how fast blur fades out
+	float sprintBlurRadius{ 0.5f };           // Blur start radius (0 = from center, 1 = edges only)
+
+	// === FOV PUNCH ===
+	bool  fovPunchHitEnabled{ true };         // Enable FOV punch when taking a hit
+	bool  fovPunchArrowEnabled{ true };       // Enable FOV punch on arrow/bolt release
+	float fovPunchHitStrength{ 5.0f };        // Percent of FOV (5.0 = +/-5%)
+	float fovPunchArrowStrength{ 3.0f };      // Percent of FOV (3.0 = +/-3%)
+	float fovPunchDuration{ 0.25f };          // Total punch duration in seconds
+
+	// === DEBUG ===
+	bool debugLogging{ false };
+	bool debugOnScreen{ false };
+	bool replayRecording{ false };  // Keep a ring of recent frames for settle_replay
+
+	// === HOT RELOAD ===
+	bool  enableHotReload{ true };
+
+	// === PROFILES ===
+	int profileCycleKey{ 0 };  // DirectX scan code that selects the next profile (0 = no hotkey)
+
+	// === ANIMATION EVENTS ===
+	static constexpr int kMaxAnimEventBindings = 16;
+	AnimEventBinding animEventBindings[kMaxAnimEventBindings];  // Used slots first, in INI order
+
+	// === PER-ACTION SETTINGS ===
+	// One contiguous [weapon state][action] table; GetActionSettingsForState indexes it directly.
+	// Settings' named references alias its entries for the INI and menu code.
+	enum WeaponState : int
+	{
+		kSheathed = 0,
+		kDrawn = 1
+	};
+	alignas(64) ActionSettings actionSettings[2][static_cast<int>(ActionType::kTotal)];
+
+	// Get appropriate settings based on weapon drawn state (kTotal falls back to WalkForward)
+	ActionSettings& GetActionSettingsForState(ActionType a_type, bool a_weaponDrawn)
+	{
+		const auto index = static_cast<unsigned>(a_type);
+		return actionSettings[a_weaponDrawn ? kDrawn : kSheathed][index < static_cast<unsigned>(ActionType::kTotal) ? index : 0];
+	}
+	const ActionSettings& GetActionSettingsForState(ActionType a_type, bool a_weaponDrawn) const
+	{
+		return const_cast<SettingsData*>(this)->GetActionSettingsForState(a_type, a_weaponDrawn);
+	}
+};
+
+// Immutable copy of SettingsData published for the game thread (see Settings::GetSnapshot)
+struct SettingsSnapshot : SettingsData
+{
+	std::uint32_t version{ 0 };  // Settings::GetVersion() at publish time
+
+	// INI sections (SettingsIni::SectionMask bits) that differ from the snapshot with
+	// version previousVersion. A reader still holding that snapshot only needs to refresh
+	// what depends on these; any other reader diffs the two snapshots itself.
+	std::uint32_t previousVersion{ 0 };
+	std::uint64_t changedSections{ ~std::uint64_t{ 0 } };
+};
@@ -0,0 +1,790 @@
+#include "Core/SettingsIni.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace
+{
+	using namespace SettleCore::SettingsIni;
+
+	constexpr float INTEGRATOR_MAX = static_cast<float>(SpringIntegrator::kTotal) - 1.0f;
+
+	// === INI LAYOUT ===
+	constexpr Key GENERAL_KEYS[] = {
+		{ "bEnabled", Type::kBool, offsetof(SettingsData, enabled), "; Master toggle for all camera settle effects" },
+		{ "fGlobalIntensity", Type::kFloat, offsetof(SettingsData, globalIntensity), "; Global intensity multiplier (1.0 = normal)" },
+		{ "fSmoothingFactor", Type::kFloat, offsetof(SettingsData, smoothingFactor), "; Input smoothing (0 = none, 1 = maximum)" },
+		{ "bResetOnPause", Type::kBool, offsetof(SettingsData, resetOnPause), "; Disable camera effects when game is paused (menus, console, etc.)" },
+		{ "iSpringSubsteps", Type::kInt, offsetof(SettingsData, springSubsteps), "; Number of physics sub-steps per frame (1-8, higher = more stable but slower)", 1.0f, 8.0f },
+		{ "bAutoSubsteps", Type::kBool, offsetof(SettingsData, autoSubsteps), "; Pick sub-steps per action from its stiffness/damping; iSpringSubsteps becomes the per-action cap" },
+		{ "iSpringIntegrator", Type::kInt, offsetof(SettingsData, springIntegrator), "; Spring integrator: 0 = Euler (sub-stepped), 1 = Closed-form (exact at any frame rate, ignores sub-steps), 2 = Implicit Euler, 3 = Velocity Verlet (sub-stepped like Euler)", 0.0f, INTEGRATOR_MAX },
+		{ "bFixedTimestep", Type::kBool, offsetof(SettingsData, fixedTimestep), "; Simulate springs at a fixed rate and interpolate between steps (same result at any frame rate)" },
+		{ "iFixedStepRate", Type::kInt, offsetof(SettingsData, fixedStepRate), "; Fixed simulation rate in Hz (60-480)", 60.0f, 480.0f },
+		{ "iMaxFixedSteps", Type::kInt, offsetof(SettingsData, maxFixedSteps), "; Max fixed steps per frame (1-16), caps the cost of a long frame", 1.0f, 16.0f },
+	};
+
+	constexpr Key MOVEMENT_KEYS[] = {
+		{ "bSpeedBasedBlending", Type::kBool, offsetof(SettingsData, speedBasedBlending), "; Blend walk/run impulse based on actual speed instead of binary toggle" },
+		{ "fWalkToRunGracePeriod", Type::kFloat, offsetof(SettingsData, walkToRunGracePeriod), "; Skip walk impulse if player reaches run speed within this time (seconds)" },
+	};
+
+	constexpr Key JUMP_KEYS[] = {
+		{ "bScaleByAirTime", Type::kBool, offsetof(SettingsData, scaleJumpByAirTime), "; Scale landing impulse based on air time (also prevents jump impulse when walking off ledges)" },
+		{ "fMinAirTime", Type::kFloat, offsetof(SettingsData, jumpMinAirTime), "; Minimum air time to trigger landing impulse (ignores short drops)" },
+		{ "fMaxAirTimeScale", Type::kFloat, offsetof(SettingsData, jumpMaxAirTimeScale), "; Air time above this is capped for scaling purposes" },
+		{ "fLandBaseScale", Type::kFloat, offsetof(SettingsData, landBaseScale), "; Base landing impulse scale (always applied above min air time)" },
+		{ "fLandAirTimeScale", Type::kFloat, offsetof(SettingsData, landAirTimeScale), "; Additional scale from air time (0 to this based on air time)" },
+	};
+
+	constexpr Key WEAPON_STATE_KEYS[] = {
+		{ "bWeaponDrawnEnabled", Type::kBool, offsetof(SettingsData, weaponDrawnEnabled), "; Enable effects when weapon is drawn" },
+		{ "bWeaponSheathedEnabled", Type::kBool, offsetof(SettingsData, weaponSheathedEnabled), "; Enable effects when weapon is sheathed" },
+		{ "fWeaponDrawnMult", Type::kFloat, offsetof(SettingsData, weaponDrawnMult), "; Effect multiplier when weapon is drawn" },
+		{ "fWeaponSheathedMult", Type::kFloat, offsetof(SettingsData, weaponSheathedMult), "; Effect multiplier when weapon is sheathed" },
+	};
+
+	constexpr Key SETTLING_KEYS[] = {
+		{ "fSettleDelay", Type::kFloat, offsetof(SettingsData, settleDelay), "; Delay before settling starts (seconds)" },
+		{ "fSettleSpeed", Type::kFloat, offsetof(SettingsData, settleSpeed), "; How fast settling occurs" },
+		{ "fSettleDampingMult", Type::kFloat, offsetof(SettingsData, settleDampingMult), "; Max damping multiplier when settled" },
+	};
+
+	constexpr Key IDLE_NOISE_DRAWN_KEYS[] = {
+		{ "bEnabled", Type::kBool, offsetof(SettingsData, idleNoiseEnabledDrawn), "; Enable subtle camera motion when standing idle (weapon drawn)" },
+		{ "fPosAmpX", Type::kFloat, offsetof(SettingsData, idleNoisePosAmpXDrawn), "; Position amplitude X (left/right)" },
+		{ "fPosAmpY", Type::kFloat, offsetof(SettingsData, idleNoisePosAmpYDrawn), "; Position amplitude Y (forward/back)" },
+		{ "fPosAmpZ", Type::kFloat, offsetof(SettingsData, idleNoisePosAmpZDrawn), "; Position amplitude Z (up/down breathing)" },
+		{ "fRotAmpX", Type::kFloat, offsetof(SettingsData, idleNoiseRotAmpXDrawn), "; Rotation amplitude pitch (degrees)" },
+		{ "fRotAmpY", Type::kFloat, offsetof(SettingsData, idleNoiseRotAmpYDrawn), "; Rotation amplitude roll (degrees)" },
+		{ "fRotAmpZ", Type::kFloat, offsetof(SettingsData, idleNoiseRotAmpZDrawn), "; Rotation amplitude yaw (degrees)" },
+		{ "fFrequency", Type::kFloat, offsetof(SettingsData, idleNoiseFrequencyDrawn), "; Noise frequency (cycles per second)" },
+	};
+
+	constexpr Key IDLE_NOISE_SHEATHED_KEYS[] = {
+		{ "bEnabled", Type::kBool, offsetof(SettingsData, idleNoiseEnabledSheathed), "; Enable subtle camera motion when standing idle (weapon sheathed)" },
+		{ "fPosAmpX", Type::kFloat, offsetof(SettingsData, idleNoisePosAmpXSheathed), "; Position amplitude X (left/right)" },
+		{ "fPosAmpY", Type::kFloat, offsetof(SettingsData, idleNoisePosAmpYSheathed), "; Position amplitude Y (forward/back)" },
+		{ "fPosAmpZ", Type::kFloat, offsetof(SettingsData, idleNoisePosAmpZSheathed), "; Position amplitude Z (up/down breathing)" },
+		{ "fRotAmpX", Type::kFloat, offsetof(SettingsData, idleNoiseRotAmpXSheathed), "; Rotation amplitude pitch (degrees)" },
+		{ "fRotAmpY", Type::kFloat, offsetof(SettingsData, idleNoiseRotAmpYSheathed), "; Rotation amplitude roll (degrees)" },
+		{ "fRotAmpZ", Type::kFloat, offsetof(SettingsData, idleNoiseRotAmpZSheathed), "; Rotation amplitude yaw (degrees)" },
+		{ "fFrequency", Type::kFloat, offsetof(SettingsData, idleNoiseFrequencySheathed), "; Noise frequency (cycles per second)" },
+	};
+
+	constexpr Key IDLE_NOISE_KEYS[] = {
+		{ "fBlendTime", Type::kFloat, offsetof(SettingsData, idleNoiseBlendTime), "; Blend in/out time in seconds" },
+		{ "bDialogueDisableIdleNoise", Type::kBool, offsetof(SettingsData, dialogueDisableIdleNoise), "; Disable idle camera noise in dialogue and map menus (blends out smoothly)" },
+		{ "bScaleDuringArchery", Type::kBool, offsetof(SettingsData, idleNoiseScaleDuringArchery), "; Scale idle noise down while drawing bow/crossbow" },
+		{ "fArcheryScaleAmount", Type::kFloat, offsetof(SettingsData, idleNoiseArcheryScaleAmount), "; Scale amount while drawing (0-1, e.g., 0.1 = 10%)", 0.0f, 1.0f },
+		{ "bArcheryScaleBySkill", Type::kBool, offsetof(SettingsData, idleNoiseArcheryScaleBySkill), "; Scale amount based on Archery skill (100 = 0)" },
+	};
+
+	constexpr Key SPRINT_EFFECTS_KEYS[] = {
+		{ "bFovEnabled", Type::kBool, offsetof(SettingsData, sprintFovEnabled), "; Enable FOV increase when sprinting" },
+		{ "fFovDelta", Type::kFloat, offsetof(SettingsData, sprintFovDelta), "; FOV increase when sprinting (degrees)" },
+		{ "fFovBlendSpeed", Type::kFloat, offsetof(SettingsData, sprintFovBlendSpeed), "; How fast to blend FOV (higher = faster)" },
+		{ "bBlurEnabled", Type::kBool, offsetof(SettingsData, sprintBlurEnabled), "; Enable radial blur when sprinting" },
+		{ "fBlurStrength", Type::kFloat, offsetof(SettingsData, sprintBlurStrength), "; Radial blur strength (0-1)" },
+		{ "fBlurBlendSpeed", Type::kFloat, offsetof(SettingsData, sprintBlurBlendSpeed), "; How fast to blend blur (higher = faster)" },
+		{ "fBlurRampUp", Type::kFloat, offsetof(SettingsData, sprintBlurRampUp), "; IMOD ramp up time in seconds (how fast blur appears)" },
+		{ "fBlurRampDown", Type::kFloat, offsetof(SettingsData, sprintBlurRampDown), "; IMOD ramp down time in seconds (how fast blur fades)" },
+		{ "fBlurRadius", Type::kFloat, offsetof(SettingsData, sprintBlurRadius), "; Blur start radius (0 = blur from center, 1 = edges only)" },
+	};
+
+	constexpr Key FOV_PUNCH_KEYS[] = {
+		{ "bHitEnabled", Type::kBool, offsetof(SettingsData, fovPunchHitEnabled), "; Enable FOV punch when taking a hit" },
+		{ "bArrowEnabled", Type::kBool, offsetof(SettingsData, fovPunchArrowEnabled), "; Enable FOV punch on arrow/bolt release" },
+		{ "fHitStrength", Type::kFloat, offsetof(SettingsData, fovPunchHitStrength), "; Hit punch strength as percent of current FOV (e.g., 5.0 = +/-5%)", 0.0f, 20.0f },
+		{ "fArrowStrength", Type::kFloat, offsetof(SettingsData, fovPunchArrowStrength), "; Arrow punch strength as percent of current FOV (e.g., 3.0 = +/-3%)", 0.0f, 20.0f },
+		{ "fDuration", Type::kFloat, offsetof(SettingsData, fovPunchDuration), "; Total punch duration in seconds", 0.05f, 1.0f },
+	};
+
+	constexpr Key DEBUG_KEYS[] = {
+		{ "bDebugLogging", Type::kBool, offsetof(SettingsData, debugLogging), "; Enable detailed debug logging" },
+		{ "bDebugOnScreen", Type::kBool, offsetof(SettingsData, debugOnScreen), "; Show debug info on screen" },
+		{ "bReplayRecording", Type::kBool, offsetof(SettingsData, replayRecording), "; Record recent frames for offline replay (settle_replay)" },
+		{ "bEnableHotReload", Type::kBool, offsetof(SettingsData, enableHotReload), "; Auto-reload INI when changed" },
+	};
+
+	constexpr Key PROFILES_KEYS[] = {
+		{ "iCycleKey", Type::kInt, offsetof(SettingsData, profileCycleKey), "; DirectX scan code of a key that switches to the next profile (0 = off, e.g. 199 = Home)", 0.0f, 255.0f },
+	};
+
+	constexpr Group GLOBAL_GROUPS[] = {
+		{ "General", GENERAL_KEYS },
+		{ "Movement", MOVEMENT_KEYS },
+		{ "Jump", JUMP_KEYS },
+		{ "WeaponState", WEAPON_STATE_KEYS },
+		{ "Settling", SETTLING_KEYS },
+		{ "IdleNoise_Drawn", IDLE_NOISE_DRAWN_KEYS },
+		{ "IdleNoise_Sheathed", IDLE_NOISE_SHEATHED_KEYS },
+		{ "IdleNoise", IDLE_NOISE_KEYS },
+		{ "SprintEffects", SPRINT_EFFECTS_KEYS },
+		{ "FOVPunch", FOV_PUNCH_KEYS },
+		{ "Debug", DEBUG_KEYS },
+		{ "Profiles", PROFILES_KEYS },
+		{ "AnimationEvents", {} },
+	};
+	static_assert(std::size(GLOBAL_GROUPS) == kGlobalSectionCount, "GlobalSection must match GLOBAL_GROUPS");
+	static_assert(std::string_view(GLOBAL_GROUPS[kIdleNoise].section) == "IdleNoise" && std::string_view(GLOBAL_GROUPS[kProfiles].section) == "Profiles" &&
+		std::string_view(GLOBAL_GROUPS[kAnimationEvents].section) == "AnimationEvents",
+		"GlobalSection must follow GLOBAL_GROUPS' order");
+
+	constexpr Key ACTION_KEYS[] = {
+		{ "bEnabled", Type::kBool, offsetof(ActionSettings, enabled), "; Enable settle effect for this action" },
+		{ "fMultiplier", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kMultiplier), "; Per-action intensity multiplier (0.0 - 10.0)", 0.0f, 10.0f },
+		{ "fBlendTime", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kBlendTime), "; Time to blend impulse into spring (0 = instant, up to 1.0 sec)", 0.0f, 1.0f },
+		{ "fStiffness", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kStiffness), "; Spring stiffness (higher = faster return)" },
+		{ "fDamping", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kDamping), "; Damping coefficient (higher = less oscillation)" },
+		{ "fPositionStrength", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kPositionStrength), "; Position offset strength" },
+		{ "fRotationStrength", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kRotationStrength), "; Rotation offset strength (degrees)" },
+		{ "fImpulseX", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kImpulseX), "; Initial X impulse (left/right)" },
+		{ "fImpulseY", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kImpulseY), "; Initial Y impulse (forward/back)" },
+		{ "fImpulseZ", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kImpulseZ), "; Initial Z impulse (up/down)" },
+		{ "fRotImpulseX", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kRotImpulseX), "; Pitch impulse (+look up, -look down)" },
+		{ "fRotImpulseY", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kRotImpulseY), "; Roll impulse (+tilt right, -tilt left)" },
+		{ "fRotImpulseZ", Type::kFloat, ActionSettings::FloatOffset(ActionSettings::kRotImpulseZ), "; Yaw impulse (+look left, -look right)" },
+		{ "iIntegrator", Type::kInt, offsetof(ActionSettings, integrator), "; Spring integrator for this action (-1 = iSpringIntegrator, 0-3 as iSpringIntegrator)", -1.0f, INTEGRATOR_MAX },
+	};
+
+	// Action names for display and INI sections
+	constexpr const char* ACTION_NAMES[] = {
+		"WalkForward",
+		"WalkBackward",
+		"WalkLeft",
+		"WalkRight",
+		"RunForward",
+		"RunBackward",
+		"RunLeft",
+		"RunRight",
+		"SprintForward",
+		"SneakWalkForward",
+		"SneakWalkBackward",
+		"SneakWalkLeft",
+		"SneakWalkRight",
+		"SneakRunForward",
+		"SneakRunBackward",
+		"SneakRunLeft",
+		"SneakRunRight",
+		"Jump",
+		"Land",
+		"Sneak",
+		"UnSneak",
+		"TakingHit",
+		"Hitting",
+		"ArrowRelease"
+	};
+	static_assert(std::size(ACTION_NAMES) == kActionCount, "ACTION_NAMES must cover every ActionType");
+
+	constexpr const char* STATE_SUFFIXES[] = { "_Sheathed", "_Drawn" };  // Indexed by SettingsData::WeaponState
+
+	// === PERFECT HASHES ===
+	// Names are matched case-insensitively, as CSimpleIni does. Each name is reduced
+	// to a fingerprint (its length and its first and last eight characters, case
+	// folded, as two words), which hashes into a power-of-two slot table holding
+	// entry index + 1. The seed is searched at compile time until no two schema
+	// names share a slot, so a lookup is one hash, one slot read and a compare of
+	// the fingerprint against the candidate's.
+	constexpr char Lower(char a_c)
+	{
+		return a_c >= 'A' && a_c <= 'Z' ? static_cast<char>(a_c - 'A' + 'a') : a_c;
+	}
+
+	constexpr bool EqualsNoCase(std::string_view a_lhs, std::string_view a_rhs)
+	{
+		if (a_lhs.size() != a_rhs.size()) {
+			return false;
+		}
+		for (std::size_t i = 0; i < a_lhs.size(); ++i) {
+			if (Lower(a_lhs[i]) != Lower(a_rhs[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Up to eight bytes of a_text from a_offset, little-endian, zero padded
+	constexpr std::uint64_t LoadWord(std::string_view a_text, std::size_t a_offset)
+	{
+		if (!std::is_constant_evaluated() && std::endian::native == std::endian::little && a_text.size() - a_offset >= 8) {
+			std::uint64_t word;
+			std::memcpy(&word, a_text.data() + a_offset, sizeof(word));
+			return word;
+		}
+		std::uint64_t word = 0;
+		for (std::size_t i = 0; i < 8 && a_offset + i < a_text.size(); ++i) {
+			word |= std::uint64_t{ static_cast<std::uint8_t>(a_text[a_offset + i]) } << (8 * i);
+		}
+		return word;
+	}
+
+	// Lower-cases the ASCII letters among eight packed bytes
+	constexpr std::uint64_t LowerWord(std::uint64_t a_word)
+	{
+		constexpr std::uint64_t ONES = 0x0101010101010101ull;
+		const std::uint64_t low = a_word & (0x7F * ONES);
+		const std::uint64_t atLeastA = low + (0x80 - 'A') * ONES;  // High bit set where byte >= 'A'
+		const std::uint64_t pastZ = low + (0x7F - 'Z') * ONES;     // High bit set where byte > 'Z'
+		const std::uint64_t upper = atLeastA & ~pastZ & ~a_word & (0x80 * ONES);
+		return a_word | (upper >> 2);
+	}
+
+	// Names of up to 16 characters are equal (ignoring case) exactly when their fingerprints are
+	struct Fingerprint
+	{
+		std::uint64_t head{ 0 };
+		std::uint64_t tail{ 0 };  // Overlaps head for names shorter than 16
+		std::size_t size{ 0 };
+
+		constexpr bool operator==(const Fingerprint&) const = default;
+	};
+
+	constexpr Fingerprint MakeFingerprint(std::string_view a_name)
+	{
+		const std::size_t tail = a_name.size() > 8 ? a_name.size() - 8 : 0;
+		return { LowerWord(LoadWord(a_name, 0)), LowerWord(LoadWord(a_name, tail)), a_name.size() };
+	}
+
+	constexpr bool SameName(std::string_view a_name, const Fingerprint& a_print, const char* a_schemaName, const Fingerprint& a_schemaPrint)
+	{
+		if (!(a_print == a_schemaPrint)) {
+			return false;
+		}
+		// Longer names also need the characters between head and tail compared
+		return a_name.size() <= 16 || EqualsNoCase(a_name.substr(8, a_name.size() - 16), std::string_view(a_schemaName + 8, a_name.size() - 16));
+	}
+
+	constexpr std::uint64_t Seed(std::uint32_t a_seed)
+	{
+		return (a_seed + 1) * 0xD6E8FEB86659FD93ull;
+	}
+
+	constexpr std::uint64_t Hash(const Fingerprint& a_print, std::uint64_t a_seed)
+	{
+		std::uint64_t hash = (a_print.head ^ a_seed) * 0x9E3779B97F4A7C15ull;
+		hash ^= (a_print.tail + a_print.size) * 0xC2B2AE3D27D4EB4Full;
+		return hash;
+	}
+
+	// Keys are salted with their section's group so that e.g. [General] bEnabled and
+	// [IdleNoise_Drawn] bEnabled are distinct entries of one table
+	constexpr std::uint64_t HashKey(int a_group, const Fingerprint& a_print, std::uint32_t a_seed)
+	{
+		return Hash(a_print, Seed(a_seed) + static_cast<std::uint64_t>(a_group));
+	}
+
+	template <int Bits>
+	constexpr std::uint32_t Slot(std::uint64_t a_hash)
+	{
+		return static_cast<std::uint32_t>((a_hash ^ (a_hash >> 32)) * 0x9E3779B97F4A7C15ull >> (64 - Bits));
+	}
+
+	template <int Bits>
+	struct PerfectHash
+	{
+		std::uint32_t seed{ 0 };
+		std::array<std::uint8_t, (1u << Bits)> slots{};  // Entry index + 1, 0 = empty
+	};
+
+	template <int Bits, class Entries, class HashEntry>
+	constexpr PerfectHash<Bits> BuildPerfectHash(const Entries& a_entries, HashEntry a_hash)
+	{
+		static_assert(std::tuple_size_v<Entries> < 255, "slot tables store entry index + 1 in a byte");
+		for (std::uint32_t seed = 0; seed < 4096; ++seed) {
+			PerfectHash<Bits> table{ seed };
+			bool collision = false;
+			for (std::size_t i = 0; i < a_entries.size() && !collision; ++i) {
+				auto& slot = table.slots[Slot<Bits>(a_hash(a_entries[i], seed))];
+				collision = slot != 0;
+				slot = static_cast<std::uint8_t>(i + 1);
+			}
+			if (!collision) {
+				return table;
+			}
+		}
+		throw std::logic_error("no perfect hash seed; grow the slot table");  // Only reachable at compile time
+	}
+
+	// Every section name, in dirty-bit order (see ActionSectionIndex)
+	struct SectionName
+	{
+		std::array<char, 32> text{};
+		std::size_t size{ 0 };
+		Fingerprint print;
+
+		constexpr std::string_view View() const { return { text.data(), size }; }
+
+		constexpr void Append(std::string_view a_part)
+		{
+			for (char c : a_part) {
+				text[size++] = c;
+			}
+			print = MakeFingerprint(View());
+		}
+	};
+
+	constexpr auto SECTION_NAMES = [] {
+		std::array<SectionName, kSectionCount> names{};
+		for (int group = 0; group < kGlobalSectionCount; ++group) {
+			names[group].Append(GLOBAL_GROUPS[group].section);
+		}
+		for (int state = 0; state < 2; ++state) {
+			for (int action = 0; action < kActionCount; ++action) {
+				auto& name = names[ActionSectionIndex(state, action)];
+				name.Append(ACTION_NAMES[action]);
+				name.Append(STATE_SUFFIXES[state]);
+			}
+		}
+		return names;
+	}();
+
+	// Every key with its fingerprint, and for global keys the group it belongs to
+	struct KeyEntry
+	{
+		int group;
+		const Key* key;
+		Fingerprint print;
+	};
+
+	constexpr auto GLOBAL_KEYS = [] {
+		constexpr std::size_t count = [] {
+			std::size_t total = 0;
+			for (const auto& group : GLOBAL_GROUPS) {
+				total += group.keys.size();
+			}
+			return total;
+		}();
+		std::array<KeyEntry, count> keys{};
+		std::size_t next = 0;
+		for (int group = 0; group < kGlobalSectionCount; ++group) {
+			for (const auto& key : GLOBAL_GROUPS[group].keys) {
+				keys[next++] = { group, &key, MakeFingerprint(key.name) };
+			}
+		}
+		return keys;
+	}();
+
+	constexpr auto ACTION_KEY_LIST = [] {
+		std::array<KeyEntry, std::size(ACTION_KEYS)> keys{};
+		for (std::size_t i = 0; i < keys.size(); ++i) {
+			keys[i] = { -1, &ACTION_KEYS[i], MakeFingerprint(ACTION_KEYS[i].name) };
+		}
+		return keys;
+	}();
+
+	constexpr int SECTION_HASH_BITS = 10;
+	constexpr int GLOBAL_KEY_HASH_BITS = 10;
+	constexpr int ACTION_KEY_HASH_BITS = 6;
+
+	constexpr auto SECTION_HASH = BuildPerfectHash<SECTION_HASH_BITS>(SECTION_NAMES, [](const SectionName& a_name, std::uint32_t a_seed) {
+		return Hash(a_name.print, Seed(a_seed));
+	});
+
+	constexpr auto GLOBAL_KEY_HASH = BuildPerfectHash<GLOBAL_KEY_HASH_BITS>(GLOBAL_KEYS, [](const KeyEntry& a_key, std::uint32_t a_seed) {
+		return HashKey(a_key.group, a_key.print, a_seed);
+	});
+
+	constexpr auto ACTION_KEY_HASH = BuildPerfectHash<ACTION_KEY_HASH_BITS>(ACTION_KEY_LIST, [](const KeyEntry& a_key, std::uint32_t a_seed) {
+		return Hash(a_key.print, Seed(a_seed));
+	});
+
+	// Section index (see ActionSectionIndex), or -1 if a_name isn't part of the schema
+	int FindSection(std::string_view a_name)
+	{
+		const auto print = MakeFingerprint(a_name);
+		const int entry = SECTION_HASH.slots[Slot<SECTION_HASH_BITS>(Hash(print, Seed(SECTION_HASH.seed)))] - 1;
+		if (entry < 0 || !SameName(a_name, print, SECTION_NAMES[entry].text.data(), SECTION_NAMES[entry].print)) {
+			return -1;
+		}
+		return entry;
+	}
+
+	const Key* FindGlobalKey(int a_group, std::string_view a_name)
+	{
+		const auto print = MakeFingerprint(a_name);
+		const int entry = GLOBAL_KEY_HASH.slots[Slot<GLOBAL_KEY_HASH_BITS>(HashKey(a_group, print, GLOBAL_KEY_HASH.seed))] - 1;
+		if (entry < 0) {
+			return nullptr;
+		}
+		const auto& candidate = GLOBAL_KEYS[entry];
+		if (candidate.group != a_group || !SameName(a_name, print, candidate.key->name, candidate.print)) {
+			return nullptr;
+		}
+		return candidate.key;
+	}
+
+	const Key* FindActionKey(std::string_view a_name)
+	{
+		const auto print = MakeFingerprint(a_name);
+		const int entry = ACTION_KEY_HASH.slots[Slot<ACTION_KEY_HASH_BITS>(Hash(print, Seed(ACTION_KEY_HASH.seed)))] - 1;
+		if (entry < 0 || !SameName(a_name, print, ACTION_KEY_LIST[entry].key->name, ACTION_KEY_LIST[entry].print)) {
+			return nullptr;
+		}
+		return ACTION_KEY_LIST[entry].key;
+	}
+
+	// === VALUES ===
+	constexpr bool IsBlank(char a_c)
+	{
+		return a_c == ' ' || a_c == '\t' || a_c == '\r';
+	}
+
+	std::string_view Trim(std::string_view a_text)
+	{
+		std::size_t first = 0;
+		std::size_t last = a_text.size();
+		while (first < last && IsBlank(a_text[first])) {
+			++first;
+		}
+		while (last > first && IsBlank(a_text[last - 1])) {
+			--last;
+		}
+		return a_text.substr(first, last - first);
+	}
+
+	// Same spellings CSimpleIni::GetBoolValue accepts
+	bool ParseBool(std::string_view a_value, bool& a_result)
+	{
+		switch (Lower(a_value[0])) {
+		case 't':
+		case 'y':
+		case '1':
+			a_result = true;
+			return true;
+		case 'f':
+		case 'n':
+		case '0':
+			a_result = false;
+			return true;
+		case 'o':
+			if (a_value.size() > 1 && (Lower(a_value[1]) == 'n' || Lower(a_value[1]) == 'f')) {
+				a_result = Lower(a_value[1]) == 'n';
+				return true;
+			}
+			return false;
+		default:
+			return false;
+		}
+	}
+
+	// Decimal or 0x hex; the whole value must parse, as with CSimpleIni::GetLongValue
+	bool ParseInt(std::string_view a_value, int& a_result)
+	{
+		int base = 10;
+		if (a_value.size() > 2 && a_value[0] == '0' && Lower(a_value[1]) == 'x') {
+			a_value.remove_prefix(2);
+			base = 16;
+		} else if (a_value[0] == '+') {
+			a_value.remove_prefix(1);
+		}
+		const char* end = a_value.data() + a_value.size();
+		const auto [last, error] = std::from_chars(a_value.data(), end, a_result, base);
+		return error == std::errc{} && last == end;
+	}
+
+	// Plain decimals ("-0.15", "100") with up to 15 significant digits are exact as an
+	// integer over a power of ten, so one correctly rounded division gives the same double
+	// strtod would; anything else (exponents, long mantissas, inf/nan) goes to from_chars
+	bool ParseFloat(std::string_view a_value, float& a_result)
+	{
+		constexpr double POWERS_OF_TEN[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+
+		// One leading '+' is allowed (from_chars takes none); "+", "+-5" and "++5" are not numbers
+		if (a_value.starts_with('+')) {
+			a_value.remove_prefix(1);
+			if (a_value.starts_with('+') || a_value.starts_with('-')) {
+				return false;
+			}
+		}
+		if (a_value.empty()) {
+			return false;
+		}
+
+		std::size_t i = a_value.starts_with('-') ? 1 : 0;
+		std::uint64_t mantissa = 0;
+		int digits = 0;
+		int fraction = -1;  // Digits after the '.', -1 before one is seen
+		for (; i < a_value.size(); ++i) {
+			const char c = a_value[i];
+			if (c >= '0' && c <= '9') {
+				mantissa = mantissa * 10 + static_cast<std::uint64_t>(c - '0');
+				digits += mantissa != 0;
+				fraction += fraction >= 0;
+			} else if (c == '.' && fraction < 0) {
+				fraction = 0;
+			} else {
+				break;
+			}
+		}
+		const bool hasDigits = i > (a_value[0] == '-' ? 1u : 0u) + (fraction >= 0 ? 1u : 0u);
+		if (i == a_value.size() && hasDigits && digits <= 15 && fraction <= 15) {
+			const double value = static_cast<double>(mantissa) / POWERS_OF_TEN[std::max(fraction, 0)];
+			a_result = static_cast<float>(a_value[0] == '-' ? -value : value);
+			return true;
+		}
+
+		double value = 0.0;
+		const char* end = a_value.data() + a_value.size();
+		const auto [last, error] = std::from_chars(a_value.data(), end, value);
+		if (error != std::errc{} || last != end) {
+			return false;
+		}
+		a_result = static_cast<float>(value);
+		return true;
+	}
+
+	void Apply(const Key& a_key, std::string_view a_value, std::uint8_t* a_base)
+	{
+		if (a_value.empty()) {
+			return;
+		}
+		const bool clamped = a_key.minValue < a_key.maxValue;
+		switch (a_key.type) {
+		case Type::kBool:
+			{
+				bool value;
+				if (ParseBool(a_value, value)) {
+					*reinterpret_cast<bool*>(a_base + a_key.offset) = value;
+				}
+				break;
+			}
+		case Type::kInt:
+			{
+				int value;
+				if (ParseInt(a_value, value)) {
+					if (clamped) {
+						value = std::clamp(value, static_cast<int>(a_key.minValue), static_cast<int>(a_key.maxValue));
+					}
+					*reinterpret_cast<int*>(a_base + a_key.offset) = value;
+				}
+				break;
+			}
+		case Type::kFloat:
+			{
+				float value;
+				if (ParseFloat(a_value, value)) {
+					if (clamped) {
+						value = std::clamp(value, a_key.minValue, a_key.maxValue);
+					}
+					*reinterpret_cast<float*>(a_base + a_key.offset) = value;
+				}
+				break;
+			}
+		}
+	}
+
+	// === ANIMATION EVENTS ===
+	// Action whose section name (without the state suffix) is a_name, or kTotal
+	ActionType FindAction(std::string_view a_name)
+	{
+		for (int action = 0; action < kActionCount; ++action) {
+			if (EqualsNoCase(a_name, ACTION_NAMES[action])) {
+				return static_cast<ActionType>(action);
+			}
+		}
+		return ActionType::kTotal;
+	}
+
+	// Binds a_tag to the action named a_value, replacing an earlier binding of the same tag
+	void ApplyBinding(std::string_view a_tag, std::string_view a_value, SettingsData& a_data)
+	{
+		const ActionType action = FindAction(a_value);
+		if (a_tag.empty() || a_tag.size() >= AnimEventBinding::kMaxTag || action == ActionType::kTotal) {
+			return;
+		}
+		for (auto& binding : a_data.animEventBindings) {
+			if (binding.tag[0] == '\0' || EqualsNoCase(binding.tag, a_tag)) {
+				binding = AnimEventBinding{};  // Zero the whole tag so bindings compare bytewise
+				std::memcpy(binding.tag, a_tag.data(), a_tag.size());
+				binding.action = action;
+				return;
+			}
+		}
+	}
+
+	// === DIFF ===
+	std::size_t KeySize(Type a_type)
+	{
+		switch (a_type) {
+		case Type::kBool:
+			return sizeof(bool);
+		case Type::kInt:
+			return sizeof(int);
+		default:
+			return sizeof(float);
+		}
+	}
+
+	bool SameKeys(std::span<const Key> a_keys, const void* a_lhs, const void* a_rhs)
+	{
+		const auto* lhs = static_cast<const std::uint8_t*>(a_lhs);
+		const auto* rhs = static_cast<const std::uint8_t*>(a_rhs);
+		for (const auto& key : a_keys) {
+			if (std::memcmp(lhs + key.offset, rhs + key.offset, KeySize(key.type)) != 0) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// === SECTIONS ===
+	// Calls a_line with every line that is neither blank nor a comment, trimmed
+	template <class LineFn>
+	void ForEachLine(std::string_view a_text, LineFn a_line)
+	{
+		if (a_text.starts_with("\xEF\xBB\xBF")) {
+			a_text.remove_prefix(3);  // UTF-8 BOM
+		}
+		while (!a_text.empty()) {
+			const auto newline = a_text.find('\n');
+			const auto line = Trim(a_text.substr(0, newline));
+			a_text.remove_prefix(newline == std::string_view::npos ? a_text.size() : newline + 1);
+			if (!line.empty() && line[0] != ';' && line[0] != '#') {
+				a_line(line);
+			}
+		}
+	}
+
+	// Name inside a "[...]" line ("" if it isn't closed)
+	std::string_view SectionHeader(std::string_view a_line)
+	{
+		const auto close = a_line.find(']');
+		return close == std::string_view::npos ? std::string_view{} : Trim(a_line.substr(1, close - 1));
+	}
+
+	// Applies the keys of every section a_resolve maps to a schema section. a_resolve
+	// takes a section name and returns the SettingsData it writes to (null to skip
+	// the section) and sets a_section to the schema section index.
+	template <class ResolveFn>
+	void ParseSections(std::string_view a_text, ResolveFn a_resolve)
+	{
+		// Where the current section's keys land; null inside a section the schema doesn't know
+		std::uint8_t* base = nullptr;
+		int group = -1;  // Global group of the current section, -1 for an action section
+		ForEachLine(a_text, [&](std::string_view a_line) {
+			if (a_line[0] == '[') {
+				int section = -1;
+				SettingsData* data = a_resolve(SectionHeader(a_line), section);
+				if (!data || section < 0) {
+					base = nullptr;
+				} else if (section < kGlobalSectionCount) {
+					base = reinterpret_cast<std::uint8_t*>(data);
+					group = section;
+				} else {
+					const int state = (section - kGlobalSectionCount) / kActionCount;
+					const int action = (section - kGlobalSectionCount) % kActionCount;
+					base = reinterpret_cast<std::uint8_t*>(&data->actionSettings[state][action]);
+					group = -1;
+				}
+				return;
+			}
+
+			const auto equals = a_line.find('=');
+			if (!base || equals == std::string_view::npos) {
+				return;
+			}
+			const auto name = Trim(a_line.substr(0, equals));
+			if (group == kAnimationEvents) {
+				ApplyBinding(name, Trim(a_line.substr(equals + 1)), *reinterpret_cast<SettingsData*>(base));
+				return;
+			}
+			const Key* key = group >= 0 ? FindGlobalKey(group, name) : FindActionKey(name);
+			if (key) {
+				Apply(*key, Trim(a_line.substr(equals + 1)), base);
+			}
+		});
+	}
+}
+
+namespace SettleCore::SettingsIni
+{
+	std::span<const Group> GlobalGroups()
+	{
+		return GLOBAL_GROUPS;
+	}
+
+	std::span<const Key> ActionKeys()
+	{
+		return ACTION_KEYS;
+	}
+
+	const char* ActionName(ActionType a_type)
+	{
+		const auto index = static_cast<unsigned>(a_type);
+		return index < static_cast<unsigned>(kActionCount) ? ACTION_NAMES[index] : "Unknown";
+	}
+
+	const char* StateSuffix(int a_state)
+	{
+		return STATE_SUFFIXES[a_state == SettingsData::kDrawn ? SettingsData::kDrawn : SettingsData::kSheathed];
+	}
+
+	SectionMask DiffSections(const SettingsData& a_lhs, const SettingsData& a_rhs)
+	{
+		SectionMask changed = 0;
+		for (int group = 0; group < kGlobalSectionCount; ++group) {
+			if (!SameKeys(GLOBAL_GROUPS[group].keys, &a_lhs, &a_rhs)) {
+				changed |= SectionBit(group);
+			}
+		}
+		if (std::memcmp(a_lhs.animEventBindings, a_rhs.animEventBindings, sizeof(a_lhs.animEventBindings)) != 0) {
+			changed |= SectionBit(kAnimationEvents);
+		}
+		for (int state = 0; state < 2; ++state) {
+			for (int action = 0; action < kActionCount; ++action) {
+				if (!SameKeys(ACTION_KEYS, &a_lhs.actionSettings[state][action], &a_rhs.actionSettings[state][action])) {
+					changed |= ActionSectionBit(state, action);
+				}
+			}
+		}
+		return changed;
+	}
+
+	void Parse(std::string_view a_text, SettingsData& a_data)
+	{
+		ParseSections(a_text, [&](std::string_view a_name, int& a_section) {
+			a_section = FindSection(a_name);
+			return &a_data;
+		});
+	}
+
+	std::vector<Profile> ParseProfiles(std::string_view a_text, const SettingsData& a_base)
+	{
+		std::vector<Profile> profiles;
+		ParseSections(a_text, [&](std::string_view a_name, int& a_section) -> SettingsData* {
+			if (a_name.size() <= kProfilePrefix.size() || !EqualsNoCase(a_name.substr(0, kProfilePrefix.size()), kProfilePrefix)) {
+				return nullptr;
+			}
+			const auto rest = a_name.substr(kProfilePrefix.size());
+			const auto dot = rest.find('.');
+			if (dot == 0 || dot == std::string_view::npos) {
+				return nullptr;
+			}
+			const auto profileName = rest.substr(0, dot);
+			auto profile = std::ranges::find_if(profiles, [&](const Profile& a_profile) { return EqualsNoCase(a_profile.name, profileName); });
+			if (profile == profiles.end()) {
+				profile = profiles.insert(profiles.end(), Profile{ std::string(profileName), a_base });
+			}
+			a_section = FindSection(rest.substr(dot + 1));
+			return &profile->data;
+		});
+		return profiles;
+	}
+
+	std::string ProfileSection(std::string_view a_profile, std::string_view a_section)
+	{
+		if (a_profile.empty()) {
+			return std::string(a_section);
+		}
+		std::string name;
+		name.reserve(kProfilePrefix.size() + a_profile.size() + 1 + a_section.size());
+		name.append(kProfilePrefix).append(a_profile).append(1, '.').append(a_section);
+		return name;
+	}
+}
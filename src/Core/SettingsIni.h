@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Core/SettingsData.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Schema of FPCameraSettle.ini and a loader specialized for it.
+//
+// Every key is listed once, as a type and a byte offset into SettingsData (or
+// into ActionSettings for the per-action sections). Parse() reads the INI text
+// in place: sections and keys stay string_views into the buffer and resolve to
+// fields through perfect hashes built at compile time from these tables, so a
+// load makes no allocations, string copies or map lookups. Settings::Save
+// writes the file from the same tables.
+namespace SettleCore::SettingsIni
+{
+	enum class Type : std::uint8_t
+	{
+		kBool,
+		kInt,
+		kFloat
+	};
+
+	struct Key
+	{
+		const char* name;
+		Type type;
+		std::size_t offset;
+		const char* comment;
+		float minValue{ 0.0f };  // Parsed values are clamped to [minValue, maxValue] when minValue < maxValue
+		float maxValue{ 0.0f };
+	};
+
+	struct Group
+	{
+		const char* section;
+		std::span<const Key> keys;
+	};
+
+	// INI sections in dirty-bit order: the global groups, then [weapon state][action]
+	enum GlobalSection : int
+	{
+		kGeneral,
+		kMovement,
+		kJump,
+		kWeaponState,
+		kSettling,
+		kIdleNoiseDrawn,
+		kIdleNoiseSheathed,
+		kIdleNoise,
+		kSprintEffects,
+		kFOVPunch,
+		kDebug,
+		kProfiles,
+		kAnimationEvents,  // No schema keys: every line is a "<tag> = <action>" binding
+
+		kGlobalSectionCount
+	};
+
+	constexpr int kActionCount = static_cast<int>(ActionType::kTotal);
+	constexpr int kSectionCount = kGlobalSectionCount + 2 * kActionCount;
+
+	constexpr int ActionSectionIndex(int a_state, int a_action)
+	{
+		return kGlobalSectionCount + a_state * kActionCount + a_action;
+	}
+
+	// One bit per section, for tracking which sections changed (saves, reloads, menu edits)
+	using SectionMask = std::uint64_t;
+	static_assert(kSectionCount <= 64, "section masks are 64-bit");
+
+	constexpr SectionMask kAllSections = kSectionCount == 64 ? ~SectionMask{ 0 } : (SectionMask{ 1 } << kSectionCount) - 1;
+
+	constexpr SectionMask SectionBit(int a_section)
+	{
+		return SectionMask{ 1 } << a_section;
+	}
+
+	constexpr SectionMask ActionSectionBit(int a_state, int a_action)
+	{
+		return SectionBit(ActionSectionIndex(a_state, a_action));
+	}
+
+	// Every action section of both weapon states
+	constexpr SectionMask kActionSections = kAllSections & ~(SectionBit(kGlobalSectionCount) - 1);
+
+	// Global sections ([General], [Jump], ...) and their keys
+	std::span<const Group> GlobalGroups();
+
+	// Keys of every per-action section ([WalkForward_Drawn], ...)
+	std::span<const Key> ActionKeys();
+
+	// Action name as used in section names and logs ("Unknown" if out of range)
+	const char* ActionName(ActionType a_type);
+
+	// Suffix that completes an action section name for a SettingsData::WeaponState
+	const char* StateSuffix(int a_state);
+
+	// Sections with at least one key that differs between a_lhs and a_rhs
+	SectionMask DiffSections(const SettingsData& a_lhs, const SettingsData& a_rhs);
+
+	// Applies every recognized key in a_text over a_data. Unknown sections and
+	// keys and unparseable values are skipped; a repeated key keeps the last value.
+	// [AnimationEvents] lines name an action section without its state suffix
+	// ("bashRelease = Hitting"); unknown actions, over-long tags and bindings past
+	// SettingsData::kMaxAnimEventBindings are skipped the same way.
+	void Parse(std::string_view a_text, SettingsData& a_data);
+
+	// Named profiles: [Profile.<name>.<section>] overrides <section> while <name> is
+	// active; keys a profile leaves out keep the plain section's value
+	constexpr std::string_view kProfilePrefix = "Profile.";
+
+	struct Profile
+	{
+		std::string name;  // As first spelled in the INI (matched case-insensitively)
+		SettingsData data;
+	};
+
+	// Every profile a_text defines, in order of first appearance, each applied over a
+	// copy of a_base (the result of Parse). One pass however many profiles there are.
+	std::vector<Profile> ParseProfiles(std::string_view a_text, const SettingsData& a_base);
+
+	// Name of a schema section within a profile (a_profile empty: the plain section)
+	std::string ProfileSection(std::string_view a_profile, std::string_view a_section);
+}
@@ -0,0 +1,461 @@
+#include "Core/SettleCore.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace SettleCore
+{
+	Vec3 ClampVector(const Vec3& a_vec, float a_max)
+	{
+		return {
+			std::clamp(a_vec.x, -a_max, a_max),
+			std::clamp(a_vec.y, -a_max, a_max),
+			std::clamp(a_vec.z, -a_max, a_max)
+		};
+	}
+
+	Vec3 LerpVector(const Vec3& a_from, const Vec3& a_to, float a_t)
+	{
+		return {
+			a_from.x + (a_to.x - a_from.x) * a_t,
+			a_from.y + (a_to.y - a_from.y) * a_t,
+			a_from.z + (a_to.z - a_from.z) * a_t
+		};
+	}
+
+	float SmoothStep(float a_t)
+	{
+		a_t = std::clamp(a_t, 0.0f, 1.0f);
+		return a_t * a_t * (3.0f - 2.0f * a_t);
+	}
+
+	float MoveTowards(float a_value, float a_target, float a_step)
+	{
+		if (a_value < a_target) {
+			return std::min(a_value + a_step, a_target);
+		} else if (a_value > a_target) {
+			return std::max(a_value - a_step, a_target);
+		}
+		return a_value;
+	}
+
+	void UpdateSpring(SpringState& a_state, const ActionSettings& a_settings, float a_delta, float a_dampingMult, int a_maxSubsteps)
+	{
+		if (a_delta <= 0.0f) {
+			return;
+		}
+
+		// Spring parameters
+		float k = a_settings.Stiffness();
+		float c = a_settings.Damping() * a_dampingMult;
+		float m = 1.0f;
+
+		// Sub-stepping for stability
+		int numSteps = GetSubstepCount(a_delta, a_maxSubsteps);
+		float stepDelta = a_delta / static_cast<float>(numSteps);
+
+		constexpr float MAX_POS_VELOCITY = 200.0f;
+		constexpr float MAX_ROT_VELOCITY = 20.0f;
+
+		for (int step = 0; step < numSteps; ++step) {
+			// Position spring: F = -k * position - c * velocity (target is 0,0,0)
+			Vec3 posForce = {
+				-k * a_state.positionOffset.x - c * a_state.positionVelocity.x,
+				-k * a_state.positionOffset.y - c * a_state.positionVelocity.y,
+				-k * a_state.positionOffset.z - c * a_state.positionVelocity.z
+			};
+
+			a_state.positionVelocity.x += (posForce.x / m) * stepDelta;
+			a_state.positionVelocity.y += (posForce.y / m) * stepDelta;
+			a_state.positionVelocity.z += (posForce.z / m) * stepDelta;
+
+			a_state.positionVelocity = ClampVector(a_state.positionVelocity, MAX_POS_VELOCITY);
+
+			a_state.positionOffset.x += a_state.positionVelocity.x * stepDelta;
+			a_state.positionOffset.y += a_state.positionVelocity.y * stepDelta;
+			a_state.positionOffset.z += a_state.positionVelocity.z * stepDelta;
+
+			a_state.positionOffset = ClampVector(a_state.positionOffset, a_settings.PositionStrength() * 3.0f);
+
+			// Rotation spring
+			Vec3 rotForce = {
+				-k * a_state.rotationOffset.x - c * a_state.rotationVelocity.x,
+				-k * a_state.rotationOffset.y - c * a_state.rotationVelocity.y,
+				-k * a_state.rotationOffset.z - c * a_state.rotationVelocity.z
+			};
+
+			a_state.rotationVelocity.x += (rotForce.x / m) * stepDelta;
+			a_state.rotationVelocity.y += (rotForce.y / m) * stepDelta;
+			a_state.rotationVelocity.z += (rotForce.z / m) * stepDelta;
+
+			a_state.rotationVelocity = ClampVector(a_state.rotationVelocity, MAX_ROT_VELOCITY);
+
+			a_state.rotationOffset.x += a_state.rotationVelocity.x * stepDelta;
+			a_state.rotationOffset.y += a_state.rotationVelocity.y * stepDelta;
+			a_state.rotationOffset.z += a_state.rotationVelocity.z * stepDelta;
+
+			float maxRotRad = a_settings.RotationStrength() * DEG_TO_RAD * 3.0f;
+			a_state.rotationOffset = ClampVector(a_state.rotationOffset, maxRotRad);
+		}
+	}
+
+	int GetSubstepCount(float a_delta, int a_maxSubsteps)
+	{
+		constexpr float MAX_SUBSTEP = 0.016f;
+		int numSteps = static_cast<int>(std::ceil(a_delta / MAX_SUBSTEP));
+		return std::clamp(numSteps, 1, std::max(a_maxSubsteps, 1));
+	}
+
+	float GetMaxStableStep(float a_stiffness, float a_damping)
+	{
+		// Eigenvalues of the symplectic Euler step leave the unit circle at
+		// h = 2 / sqrt(k) undamped; damping pulls the limit in to 4 / (c + sqrt(c^2 + 4k))
+		const float k = std::max(a_stiffness, 0.0f);
+		const float c = std::max(a_damping, 0.0f);
+		const float denominator = c + std::sqrt(c * c + 4.0f * k);
+		return denominator > 0.0f ? 4.0f / denominator : std::numeric_limits<float>::max();
+	}
+
+	int GetAutoSubstepCount(float a_delta, float a_maxStableStep, int a_maxSubsteps)
+	{
+		// Stay at a quarter of the bound: right at it the spring rings forever instead of settling
+		constexpr float STABILITY_MARGIN = 0.25f;
+		if (a_delta <= 0.0f || a_maxStableStep <= 0.0f) {
+			return 1;
+		}
+		const float numSteps = std::ceil(a_delta / (a_maxStableStep * STABILITY_MARGIN));
+		return static_cast<int>(std::clamp(numSteps, 1.0f, static_cast<float>(std::max(a_maxSubsteps, 1))));
+	}
+
+	SpringCoefficients ComputeStepTransition(SpringIntegrator a_integrator, float a_stiffness, float a_damping, float a_delta, int a_steps)
+	{
+		SpringCoefficients result;
+		if (a_delta <= 0.0f || a_steps < 1) {
+			return result;
+		}
+
+		const double k = std::max(0.0, static_cast<double>(a_stiffness));
+		const double c = std::max(0.0, static_cast<double>(a_damping));
+		const double h = static_cast<double>(a_delta) / a_steps;
+
+		// One step as x' = xx * x + xv * v, v' = vx * x + vv * v
+		double vx, vv, xx, xv;
+		switch (a_integrator) {
+		case SpringIntegrator::ImplicitEuler:
+			{
+				// v' = v + h * (-k * x' - c * v'), x' = x + h * v', solved for v'
+				const double d = 1.0 + h * c + h * h * k;
+				vx = -h * k / d;
+				vv = 1.0 / d;
+				xx = 1.0 + h * vx;
+				xv = h * vv;
+				break;
+			}
+		case SpringIntegrator::Verlet:
+			{
+				// x' = x + h * v + h^2/2 * a, v' = v + h/2 * (a + a'), with a' from x' and a predicted v
+				xx = 1.0 - 0.5 * h * h * k;
+				xv = h - 0.5 * h * h * c;
+				const double ax = -k * xx - c * (-h * k);
+				const double av = -k * xv - c * (1.0 - h * c);
+				vx = 0.5 * h * (-k + ax);
+				vv = 1.0 + 0.5 * h * (-c + av);
+				break;
+			}
+		default:
+			{
+				// Semi-implicit Euler, same as the Integrate kernels
+				vx = -h * k;
+				vv = 1.0 - h * c;
+				xx = 1.0 + h * vx;
+				xv = h * vv;
+				break;
+			}
+		}
+
+		// Compose the steps into one frame transition
+		double fxx = xx, fxv = xv, fvx = vx, fvv = vv;
+		for (int step = 1; step < a_steps; ++step) {
+			const double nxx = xx * fxx + xv * fvx;
+			const double nxv = xx * fxv + xv * fvv;
+			const double nvx = vx * fxx + vv * fvx;
+			const double nvv = vx * fxv + vv * fvv;
+			fxx = nxx;
+			fxv = nxv;
+			fvx = nvx;
+			fvv = nvv;
+		}
+
+		result.xx = static_cast<float>(fxx);
+		result.xv = static_cast<float>(fxv);
+		result.vx = static_cast<float>(fvx);
+		result.vv = static_cast<float>(fvv);
+		result.omega = static_cast<float>(std::sqrt(k));
+		result.zeta = k > 0.0 ? static_cast<float>(c / (2.0 * std::sqrt(k))) : 0.0f;
+		return result;
+	}
+
+	SpringIntegrator ResolveIntegrator(const ActionSettings& a_settings, SpringIntegrator a_global)
+	{
+		if (a_settings.integrator >= 0 && a_settings.integrator < static_cast<int>(SpringIntegrator::kTotal)) {
+			return static_cast<SpringIntegrator>(a_settings.integrator);
+		}
+		return a_global;
+	}
+
+	SpringCoefficients ComputeClosedForm(float a_stiffness, float a_damping, float a_delta)
+	{
+		SpringCoefficients result;
+		if (a_delta <= 0.0f) {
+			return result;
+		}
+
+		// Evaluate in double - the exp/sin terms lose precision quickly in float at high stiffness
+		const double k = std::max(0.0, static_cast<double>(a_stiffness));
+		const double c = std::max(0.0, static_cast<double>(a_damping));
+		const double t = a_delta;
+		const double alpha = 0.5 * c;
+		const double e = std::exp(-alpha * t);
+		const double disc = alpha * alpha - k;
+
+		double xx, xv, vx, vv;
+		if (disc < 0.0 && std::sqrt(-disc) * t > 1e-6) {
+			// Underdamped: oscillates at omega_d inside the decay envelope
+			const double wd = std::sqrt(-disc);
+			const double s = std::sin(wd * t);
+			const double co = std::cos(wd * t);
+			xx = e * (co + alpha * s / wd);
+			xv = e * s / wd;
+			vx = -e * k * s / wd;
+			vv = e * (co - alpha * s / wd);
+		} else if (disc > 0.0 && std::sqrt(disc) * t > 1e-6) {
+			// Overdamped: two real decay rates, written with sinh/cosh
+			const double b = std::sqrt(disc);
+			const double sh = std::sinh(b * t);
+			const double ch = std::cosh(b * t);
+			xx = e * (ch + alpha * sh / b);
+			xv = e * sh / b;
+			vx = -e * k * sh / b;
+			vv = e * (ch - alpha * sh / b);
+		} else {
+			// Critically damped (or close enough that both forms reduce to this)
+			xx = e * (1.0 + alpha * t);
+			xv = e * t;
+			vx = -e * k * t;
+			vv = e * (1.0 - alpha * t);
+		}
+
+		result.xx = static_cast<float>(xx);
+		result.xv = static_cast<float>(xv);
+		result.vx = static_cast<float>(vx);
+		result.vv = static_cast<float>(vv);
+		result.omega = static_cast<float>(std::sqrt(k));
+		result.zeta = k > 0.0 ? static_cast<float>(c / (2.0 * std::sqrt(k))) : 0.0f;
+		result.decay = static_cast<float>(e);
+		return result;
+	}
+
+	ResolvedImpulse ResolveImpulse(const ActionSettings& a_settings, float a_multiplier)
+	{
+		ResolvedImpulse result;
+		if (!a_settings.enabled || a_multiplier <= 0.0f || a_settings.Multiplier() <= 0.0f) {
+			return result;
+		}
+
+		// Include per-action multiplier (0-10x range)
+		float totalMult = a_multiplier * a_settings.Multiplier();
+		float posMult = a_settings.PositionStrength() * totalMult;
+		float rotMult = a_settings.RotationStrength() * DEG_TO_RAD * totalMult;
+
+		result.position = {
+			a_settings.ImpulseX() * posMult,
+			a_settings.ImpulseY() * posMult,
+			a_settings.ImpulseZ() * posMult
+		};
+		result.rotation = {
+			a_settings.RotImpulseX() * rotMult,
+			a_settings.RotImpulseY() * rotMult,
+			a_settings.RotImpulseZ() * rotMult
+		};
+		result.multiplier = totalMult;
+		result.blendTime = a_settings.BlendTime();
+		result.enabled = true;
+		return result;
+	}
+
+	ResolvedImpulse ScaleImpulse(const ResolvedImpulse& a_impulse, const Vec3& a_positionScale, const Vec3& a_rotationScale)
+	{
+		ResolvedImpulse result = a_impulse;
+		result.position = { a_impulse.position.x * a_positionScale.x, a_impulse.position.y * a_positionScale.y, a_impulse.position.z * a_positionScale.z };
+		result.rotation = { a_impulse.rotation.x * a_rotationScale.x, a_impulse.rotation.y * a_rotationScale.y, a_impulse.rotation.z * a_rotationScale.z };
+		return result;
+	}
+
+	ImpulseResult ApplyImpulse(SpringState& a_state, PendingBlend& a_blend, const ResolvedImpulse& a_impulse, float a_scale)
+	{
+		if (!a_impulse.enabled || a_scale <= 0.0f) {
+			return ImpulseResult::kBlocked;
+		}
+
+		const Vec3 posImpulse = { a_impulse.position.x * a_scale, a_impulse.position.y * a_scale, a_impulse.position.z * a_scale };
+		const Vec3 rotImpulse = { a_impulse.rotation.x * a_scale, a_impulse.rotation.y * a_scale, a_impulse.rotation.z * a_scale };
+
+		// If blend time is 0 or very small, apply instantly
+		if (a_impulse.blendTime < 0.001f) {
+			a_state.positionVelocity.x += posImpulse.x;
+			a_state.positionVelocity.y += posImpulse.y;
+			a_state.positionVelocity.z += posImpulse.z;
+			a_state.rotationVelocity.x += rotImpulse.x;
+			a_state.rotationVelocity.y += rotImpulse.y;
+			a_state.rotationVelocity.z += rotImpulse.z;
+			return ImpulseResult::kInstant;
+		}
+
+		// Start a blend alongside any running ones, in the first free slot
+		int slot = 0;
+		if (a_blend.activeMask != (1u << PendingBlend::kSlots) - 1) {
+			slot = std::countr_zero(~a_blend.activeMask);
+		} else {
+			// All slots busy - flush the one closest to done (smallest jump in velocity)
+			for (int i = 1; i < PendingBlend::kSlots; ++i) {
+				if (a_blend.slots[i].progress > a_blend.slots[slot].progress) {
+					slot = i;
+				}
+			}
+			const BlendSlot& oldest = a_blend.slots[slot];
+			float remaining = 1.0f - oldest.progress;
+			a_state.positionVelocity.x += oldest.posImpulse.x * remaining;
+			a_state.positionVelocity.y += oldest.posImpulse.y * remaining;
+			a_state.positionVelocity.z += oldest.posImpulse.z * remaining;
+			a_state.rotationVelocity.x += oldest.rotImpulse.x * remaining;
+			a_state.rotationVelocity.y += oldest.rotImpulse.y * remaining;
+			a_state.rotationVelocity.z += oldest.rotImpulse.z * remaining;
+		}
+
+		// Set up new blend
+		BlendSlot& blend = a_blend.slots[slot];
+		blend.progress = 0.0f;
+		blend.duration = a_impulse.blendTime;
+		blend.multiplier = a_impulse.multiplier * a_scale;
+		blend.posImpulse = posImpulse;
+		blend.rotImpulse = rotImpulse;
+		a_blend.activeMask |= 1u << slot;
+		a_blend.newestSlot = static_cast<std::uint32_t>(slot);
+		return ImpulseResult::kBlended;
+	}
+
+	ImpulseResult ApplyImpulse(SpringState& a_state, PendingBlend& a_blend, const ActionSettings& a_settings, float a_multiplier)
+	{
+		return ApplyImpulse(a_state, a_blend, ResolveImpulse(a_settings, a_multiplier));
+	}
+
+	void UpdateBlend(SpringState& a_state, PendingBlend& a_blend, float a_delta)
+	{
+		if (!a_blend.IsActive() || a_delta <= 0.0f) {
+			return;
+		}
+
+		// Sum this frame's share of every running blend, then add it to velocity once
+		Vec3 pos;
+		Vec3 rot;
+		for (int slot = 0; slot < PendingBlend::kSlots; ++slot) {
+			if (!a_blend.IsSlotActive(slot)) {
+				continue;
+			}
+
+			// Calculate how much progress this frame
+			BlendSlot& blend = a_blend.slots[slot];
+			float prevProgress = blend.progress;
+			blend.progress += a_delta / blend.duration;
+
+			// Blend complete - apply remaining impulse; otherwise this frame's portion
+			bool complete = blend.progress >= 1.0f;
+			float share = complete ? 1.0f - prevProgress : blend.progress - prevProgress;
+			pos.x += blend.posImpulse.x * share;
+			pos.y += blend.posImpulse.y * share;
+			pos.z += blend.posImpulse.z * share;
+			rot.x += blend.rotImpulse.x * share;
+			rot.y += blend.rotImpulse.y * share;
+			rot.z += blend.rotImpulse.z * share;
+
+			if (complete) {
+				blend = BlendSlot{};
+				a_blend.activeMask &= ~(1u << slot);
+			}
+		}
+
+		a_state.positionVelocity.x += pos.x;
+		a_state.positionVelocity.y += pos.y;
+		a_state.positionVelocity.z += pos.z;
+		a_state.rotationVelocity.x += rot.x;
+		a_state.rotationVelocity.y += rot.y;
+		a_state.rotationVelocity.z += rot.z;
+	}
+
+	float AdvanceNoisePhase(float a_phase, float a_delta, float a_frequency)
+	{
+		a_phase += a_delta * a_frequency * 2.0f * PI;
+
+		// Keep phase bounded to avoid float precision issues over long play sessions
+		if (a_phase > 1000.0f * PI) {
+			a_phase = std::fmod(a_phase, 2.0f * PI);
+		}
+		return a_phase;
+	}
+
+	void EvaluateIdleNoise(float a_phase, const Vec3& a_posAmp, const Vec3& a_rotAmpDeg, float a_amplitude, Vec3& a_outPos, Vec3& a_outRot)
+	{
+		// Calculate sine waves from continuous phase
+		float sin1 = std::sin(a_phase);
+		float sin2 = std::sin(a_phase * 1.37f + 1.2f);
+		float sin3 = std::sin(a_phase * 0.73f + 2.5f);
+
+		// Truly additive: sine_value * max_amplitude * current_amplitude_factor
+		a_outPos.x = sin1 * a_posAmp.x * a_amplitude;
+		a_outPos.y = sin2 * a_posAmp.y * a_amplitude;
+		a_outPos.z = sin3 * a_posAmp.z * a_amplitude;
+
+		a_outRot.x = sin3 * a_rotAmpDeg.x * DEG_TO_RAD * a_amplitude;
+		a_outRot.y = sin1 * a_rotAmpDeg.y * DEG_TO_RAD * a_amplitude;
+		a_outRot.z = sin2 * a_rotAmpDeg.z * DEG_TO_RAD * a_amplitude;
+	}
+
+	void UpdateIdleNoise(IdleNoiseState& a_state, const IdleNoiseFrame& a_frame)
+	{
+		// ALWAYS advance phase - the wave is always "there", just with zero amplitude when not idle
+		a_state.phase = AdvanceNoisePhase(a_state.phase, a_frame.delta, a_frame.frequency);
+
+		if (a_state.IsDormant(a_frame.enabled)) {
+			a_state.offset = { 0.0f, 0.0f, 0.0f };
+			a_state.rotation = { 0.0f, 0.0f, 0.0f };
+			return;
+		}
+
+		// Only the amplitude changes, never the wave itself
+		a_state.amplitude = MoveTowards(a_state.amplitude, a_frame.targetAmplitude, a_frame.rampSpeed * a_frame.delta);
+		a_state.archeryScale = MoveTowards(a_state.archeryScale, a_frame.targetArcheryScale, a_frame.rampSpeed * a_frame.delta);
+
+		float finalAmplitude = a_state.amplitude * a_state.archeryScale;
+		if (finalAmplitude > 0.0f) {
+			EvaluateIdleNoise(a_state.phase, a_frame.posAmp, a_frame.rotAmpDeg, finalAmplitude, a_state.offset, a_state.rotation);
+		} else {
+			a_state.offset = { 0.0f, 0.0f, 0.0f };
+			a_state.rotation = { 0.0f, 0.0f, 0.0f };
+		}
+	}
+
+	float FovPunchCurve(float a_t)
+	{
+		if (a_t >= 1.0f) {
+			return 0.0f;
+		}
+
+		constexpr float PHASE1 = 0.4f;  // In -> overshoot
+		if (a_t < PHASE1) {
+			float u = SmoothStep(a_t / PHASE1);
+			return -1.0f + (2.0f * u);  // -1 to +1
+		}
+		float u = SmoothStep((a_t - PHASE1) / (1.0f - PHASE1));
+		return 1.0f + (-1.0f * u);  // +1 to 0
+	}
+}
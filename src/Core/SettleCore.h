@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Core/ActionSettings.h"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+// Portable camera settle math - no CommonLibSSE or Windows dependencies.
+// The plugin and the Linux tools (settle_bench) share this code.
+namespace SettleCore
+{
+	constexpr float PI = 3.14159265358979323846f;
+	constexpr float DEG_TO_RAD = PI / 180.0f;
+	constexpr float RAD_TO_DEG = 180.0f / PI;
+
+	// Plain 3-component vector (layout-compatible with RE::NiPoint3)
+	struct Vec3
+	{
+		float x{ 0.0f };
+		float y{ 0.0f };
+		float z{ 0.0f };
+	};
+
+	// Spring state for tracking camera offset
+	struct SpringState
+	{
+		// Position offset
+		Vec3 positionOffset{ 0.0f, 0.0f, 0.0f };
+		Vec3 positionVelocity{ 0.0f, 0.0f, 0.0f };
+
+		// Rotation offset (euler angles in radians)
+		Vec3 rotationOffset{ 0.0f, 0.0f, 0.0f };
+		Vec3 rotationVelocity{ 0.0f, 0.0f, 0.0f };
+
+		void Reset()
+		{
+			positionOffset = { 0.0f, 0.0f, 0.0f };
+			positionVelocity = { 0.0f, 0.0f, 0.0f };
+			rotationOffset = { 0.0f, 0.0f, 0.0f };
+			rotationVelocity = { 0.0f, 0.0f, 0.0f };
+		}
+
+		bool IsActive() const
+		{
+			constexpr float THRESHOLD = 0.0001f;
+			return std::abs(positionOffset.x) > THRESHOLD ||
+			       std::abs(positionOffset.y) > THRESHOLD ||
+			       std::abs(positionOffset.z) > THRESHOLD ||
+			       std::abs(rotationOffset.x) > THRESHOLD ||
+			       std::abs(rotationOffset.y) > THRESHOLD ||
+			       std::abs(rotationOffset.z) > THRESHOLD ||
+			       std::abs(positionVelocity.x) > THRESHOLD ||
+			       std::abs(positionVelocity.y) > THRESHOLD ||
+			       std::abs(positionVelocity.z) > THRESHOLD;
+		}
+
+		// True when every component is exactly zero (dormant layers are snapped to this)
+		bool IsAtRest() const
+		{
+			return positionOffset.x == 0.0f && positionOffset.y == 0.0f && positionOffset.z == 0.0f &&
+			       positionVelocity.x == 0.0f && positionVelocity.y == 0.0f && positionVelocity.z == 0.0f &&
+			       rotationOffset.x == 0.0f && rotationOffset.y == 0.0f && rotationOffset.z == 0.0f &&
+			       rotationVelocity.x == 0.0f && rotationVelocity.y == 0.0f && rotationVelocity.z == 0.0f;
+		}
+	};
+
+	// One impulse being blended into a spring's velocity
+	struct BlendSlot
+	{
+		float progress{ 0.0f };      // 0 to 1
+		float duration{ 0.1f };      // Blend time in seconds
+		float multiplier{ 1.0f };    // Total multiplier for this impulse
+
+		// Target impulse values
+		Vec3 posImpulse{ 0.0f, 0.0f, 0.0f };
+		Vec3 rotImpulse{ 0.0f, 0.0f, 0.0f };
+	};
+
+	// Pending blends for one spring: a fixed set of slots blended concurrently, so
+	// overlapping impulses each keep their own envelope. Only when every slot is
+	// busy is the most advanced blend flushed into velocity to make room.
+	struct PendingBlend
+	{
+		static constexpr int kSlots = 4;
+
+		BlendSlot slots[kSlots];
+		std::uint32_t activeMask{ 0 };  // Bit per slot that is still blending
+		std::uint32_t newestSlot{ 0 };  // Slot the latest impulse went into
+
+		bool IsActive() const { return activeMask != 0; }
+		bool IsSlotActive(int a_slot) const { return (activeMask & (1u << a_slot)) != 0; }
+		int ActiveCount() const { return std::popcount(activeMask); }
+		const BlendSlot& Newest() const { return slots[newestSlot]; }
+
+		void Reset()
+		{
+			for (auto& slot : slots) {
+				slot = BlendSlot{};
+			}
+			activeMask = 0;
+			newestSlot = 0;
+		}
+	};
+
+	// Exact one-frame transition for a damped spring (unit mass, target 0):
+	//   x' = xx * x + xv * v
+	//   v' = vx * x + vv * v
+	struct SpringCoefficients
+	{
+		float xx{ 1.0f };
+		float xv{ 0.0f };
+		float vx{ 0.0f };
+		float vv{ 1.0f };
+
+		float omega{ 0.0f };  // Natural frequency sqrt(k)
+		float zeta{ 0.0f };   // Damping ratio c / (2 * omega)
+		float decay{ 1.0f };  // Envelope exp(-c/2 * dt)
+	};
+
+	// An action's impulse with its strengths, DEG_TO_RAD and every multiplier folded in,
+	// so firing it is a scale and a vector add (see ResolveImpulse)
+	struct ResolvedImpulse
+	{
+		Vec3 position;             // Position velocity impulse
+		Vec3 rotation;             // Rotation velocity impulse (radians)
+		float multiplier{ 0.0f };  // Caller multiplier x per-action multiplier
+		float blendTime{ 0.0f };
+		bool enabled{ false };     // False if the action is disabled or either multiplier is zero
+	};
+
+	// How ApplyImpulse handled an impulse (callers use this for debug output)
+	enum class ImpulseResult
+	{
+		kBlocked,   // Action disabled or zero multiplier
+		kInstant,   // Added straight to velocity
+		kBlended    // Started a PendingBlend
+	};
+
+	Vec3 ClampVector(const Vec3& a_vec, float a_max);
+	Vec3 LerpVector(const Vec3& a_from, const Vec3& a_to, float a_t);
+	float SmoothStep(float a_t);
+
+	// Move a value towards a target by at most a_step
+	float MoveTowards(float a_value, float a_target, float a_step);
+
+	// Integrate one spring layer (semi-implicit Euler with velocity/offset clamps).
+	// a_dampingMult scales damping (settling), a_maxSubsteps caps the 16ms sub-steps.
+	void UpdateSpring(SpringState& a_state, const ActionSettings& a_settings, float a_delta, float a_dampingMult, int a_maxSubsteps);
+
+	// Number of 16ms sub-steps for a_delta, capped at a_maxSubsteps (at least 1)
+	int GetSubstepCount(float a_delta, int a_maxSubsteps);
+
+	// Largest step semi-implicit Euler stays stable at for x'' + c x' + k x = 0: 4 / (c + sqrt(c^2 + 4k))
+	float GetMaxStableStep(float a_stiffness, float a_damping);
+
+	// Sub-steps a layer needs so each step stays well inside a_maxStableStep, capped at a_maxSubsteps (at least 1)
+	int GetAutoSubstepCount(float a_delta, float a_maxStableStep, int a_maxSubsteps);
+
+	// Closed-form solution of x'' + c x' + k x = 0 over a_delta (under, critically and over damped)
+	SpringCoefficients ComputeClosedForm(float a_stiffness, float a_damping, float a_delta);
+
+	// Transition matrix of a step-based integrator (Euler, ImplicitEuler, Verlet) over a_delta,
+	// split into a_steps equal steps. Offsets/velocities are clamped once per frame, not per step.
+	SpringCoefficients ComputeStepTransition(SpringIntegrator a_integrator, float a_stiffness, float a_damping, float a_delta, int a_steps);
+
+	// Integrator a layer runs with: the action's override, else the global one
+	SpringIntegrator ResolveIntegrator(const ActionSettings& a_settings, SpringIntegrator a_global);
+
+	// Fold a_settings' strengths and multiplier and a_multiplier into final impulse vectors
+	ResolvedImpulse ResolveImpulse(const ActionSettings& a_settings, float a_multiplier);
+
+	// a_impulse with each position/rotation component scaled (negative flips it), e.g. a stop counter-impulse
+	ResolvedImpulse ScaleImpulse(const ResolvedImpulse& a_impulse, const Vec3& a_positionScale, const Vec3& a_rotationScale);
+
+	// Apply a resolved impulse scaled by a_scale (starts a blend if blendTime > 0)
+	ImpulseResult ApplyImpulse(SpringState& a_state, PendingBlend& a_blend, const ResolvedImpulse& a_impulse, float a_scale = 1.0f);
+
+	// Apply impulse to spring (resolves a_settings first)
+	ImpulseResult ApplyImpulse(SpringState& a_state, PendingBlend& a_blend, const ActionSettings& a_settings, float a_multiplier);
+
+	// Advance every pending blend and add this frame's share of their impulses to velocity
+	void UpdateBlend(SpringState& a_state, PendingBlend& a_blend, float a_delta);
+
+	// === IDLE NOISE ===
+	// Continuous idle noise: the phase always advances, only the amplitude ramps
+	struct IdleNoiseState
+	{
+		float phase{ 0.0f };         // Continuous phase, never reset abruptly
+		float amplitude{ 0.0f };     // 0-1 ramp in/out of idle
+		float archeryScale{ 1.0f };  // Scale while drawing a bow/crossbow
+		Vec3 offset;                 // Position noise
+		Vec3 rotation;               // Rotation noise (radians)
+
+		// Noise is disabled for this weapon state and fully faded out
+		bool IsDormant(bool a_enabled) const { return !a_enabled && amplitude <= 0.0f; }
+	};
+
+	// Per-frame idle noise inputs; targets are only meaningful when the noise is not dormant
+	struct IdleNoiseFrame
+	{
+		float delta{ 0.0f };
+		float frequency{ 0.0f };
+		bool enabled{ false };
+		float targetAmplitude{ 0.0f };
+		float targetArcheryScale{ 1.0f };
+		float rampSpeed{ 0.0f };
+		Vec3 posAmp;
+		Vec3 rotAmpDeg;
+	};
+
+	// Advance the phase, ramp amplitude/archery scale towards their targets and evaluate the noise
+	void UpdateIdleNoise(IdleNoiseState& a_state, const IdleNoiseFrame& a_frame);
+
+	// Advance the continuous noise phase (kept bounded for long sessions)
+	float AdvanceNoisePhase(float a_phase, float a_delta, float a_frequency);
+
+	// Evaluate the three-sine idle noise for a phase.
+	// a_posAmp is in game units, a_rotAmpDeg in degrees; a_amplitude is the 0-1 ramp.
+	void EvaluateIdleNoise(float a_phase, const Vec3& a_posAmp, const Vec3& a_rotAmpDeg, float a_amplitude, Vec3& a_outPos, Vec3& a_outRot);
+
+	// === FOV PUNCH ===
+	// Punch curve for normalized time t (0-1): dips to -1, overshoots to +1, returns to 0
+	float FovPunchCurve(float a_t);
+}
@@ -0,0 +1,308 @@
+#include "Core/SpringBank.h"
+#include "Core/SpringKernels.h"
+
+#include <algorithm>
+#include <iterator>
+
+#if SETTLECORE_AVX_KERNEL && defined(_MSC_VER)
+#	include <intrin.h>
+#endif
+
+namespace SettleCore
+{
+	namespace
+	{
+		// Vertical sum of every layer's lanes into a_bank.total
+		void SumTotals(SpringBank& a_bank)
+		{
+			for (int lane = 0; lane < SpringBank::kLaneStride; ++lane) {
+				float sum = a_bank.offset[lane];
+				for (int layer = 1; layer < SpringBank::kLayers; ++layer) {
+					sum += a_bank.offset[layer * SpringBank::kLaneStride + lane];
+				}
+				a_bank.total[lane] = sum;
+			}
+		}
+
+		bool CpuHasAVX()
+		{
+#if SETTLECORE_AVX_KERNEL
+#	if defined(_MSC_VER)
+			// CPUID.1:ECX bit 28 = AVX, bit 27 = OSXSAVE; XCR0 bits 1-2 = OS saves XMM/YMM state
+			int info[4];
+			__cpuid(info, 1);
+			bool osxsave = (info[2] & (1 << 27)) != 0;
+			bool avx = (info[2] & (1 << 28)) != 0;
+			if (!osxsave || !avx) {
+				return false;
+			}
+			return (_xgetbv(0) & 0x6) == 0x6;
+#	else
+			return __builtin_cpu_supports("avx");
+#	endif
+#else
+			return false;
+#endif
+		}
+
+		SpringKernel DetectBestKernel()
+		{
+			if (CpuHasAVX()) {
+				return SpringKernel::kAVX;
+			}
+#if SETTLECORE_SSE_KERNEL
+			return SpringKernel::kSSE;
+#else
+			return SpringKernel::kScalar;
+#endif
+		}
+
+		SpringKernel& SelectedKernel()
+		{
+			static SpringKernel kernel = GetBestSpringKernel();
+			return kernel;
+		}
+	}
+
+	SpringKernel GetBestSpringKernel()
+	{
+		static const SpringKernel best = DetectBestKernel();
+		return best;
+	}
+
+	SpringKernel GetSpringKernel()
+	{
+		return SelectedKernel();
+	}
+
+	void SetSpringKernel(SpringKernel a_kernel)
+	{
+		SelectedKernel() = IsSpringKernelSupported(a_kernel) ? a_kernel : GetBestSpringKernel();
+	}
+
+	bool IsSpringKernelSupported(SpringKernel a_kernel)
+	{
+		switch (a_kernel) {
+		case SpringKernel::kScalar:
+			return true;
+		case SpringKernel::kSSE:
+			return SETTLECORE_SSE_KERNEL != 0;
+		case SpringKernel::kAVX:
+			return GetBestSpringKernel() == SpringKernel::kAVX;
+		default:
+			return false;
+		}
+	}
+
+	const char* GetSpringKernelName(SpringKernel a_kernel)
+	{
+		switch (a_kernel) {
+		case SpringKernel::kScalar:
+			return "Scalar";
+		case SpringKernel::kSSE:
+			return "SSE";
+		case SpringKernel::kAVX:
+			return "AVX";
+		default:
+			return "Unknown";
+		}
+	}
+
+	void SpringBank::Load(int a_layer, const SpringState& a_state, const ActionSettings& a_settings, float a_dampingMult)
+	{
+		const int base = a_layer * kLaneStride;
+		const float negK = -a_settings.Stiffness();
+		const float c = a_settings.Damping() * a_dampingMult;
+		const float maxPos = a_settings.PositionStrength() * 3.0f;
+		const float maxRot = a_settings.RotationStrength() * DEG_TO_RAD * 3.0f;
+
+		const Vec3* offsets[2] = { &a_state.positionOffset, &a_state.rotationOffset };
+		const Vec3* velocities[2] = { &a_state.positionVelocity, &a_state.rotationVelocity };
+
+		for (int half = 0; half < 2; ++half) {
+			const int lane = base + half * 4;
+			offset[lane + 0] = offsets[half]->x;
+			offset[lane + 1] = offsets[half]->y;
+			offset[lane + 2] = offsets[half]->z;
+			offset[lane + 3] = 0.0f;
+			velocity[lane + 0] = velocities[half]->x;
+			velocity[lane + 1] = velocities[half]->y;
+			velocity[lane + 2] = velocities[half]->z;
+			velocity[lane + 3] = 0.0f;
+
+			for (int axis = 0; axis < 3; ++axis) {
+				negStiffness[lane + axis] = negK;
+				damping[lane + axis] = c;
+				maxVelocity[lane + axis] = half == 0 ? 200.0f : 20.0f;
+				maxOffset[lane + axis] = half == 0 ? maxPos : maxRot;
+			}
+
+			// Pad lanes stay pinned at zero
+			negStiffness[lane + 3] = 0.0f;
+			damping[lane + 3] = 0.0f;
+			maxVelocity[lane + 3] = 0.0f;
+			maxOffset[lane + 3] = 0.0f;
+		}
+	}
+
+	void SpringBank::Store(int a_layer, SpringState& a_state) const
+	{
+		const int base = a_layer * kLaneStride;
+		a_state.positionOffset = { offset[base + 0], offset[base + 1], offset[base + 2] };
+		a_state.positionVelocity = { velocity[base + 0], velocity[base + 1], velocity[base + 2] };
+		a_state.rotationOffset = { offset[base + 4], offset[base + 5], offset[base + 6] };
+		a_state.rotationVelocity = { velocity[base + 4], velocity[base + 5], velocity[base + 6] };
+	}
+
+	void SpringBank::SetTransition(int a_layer, const SpringCoefficients& a_coefficients)
+	{
+		const int base = a_layer * kLaneStride;
+		for (int lane = 0; lane < kLaneStride; ++lane) {
+			// Pad lanes (3 and 7) map to zero
+			const bool pad = (lane & 3) == 3;
+			transXX[base + lane] = pad ? 0.0f : a_coefficients.xx;
+			transXV[base + lane] = pad ? 0.0f : a_coefficients.xv;
+			transVX[base + lane] = pad ? 0.0f : a_coefficients.vx;
+			transVV[base + lane] = pad ? 0.0f : a_coefficients.vv;
+		}
+	}
+
+	void SpringBank::Integrate(float a_delta, int a_maxSubsteps)
+	{
+		// Same sub-step split as UpdateSpring
+		int layerSubsteps[kLayers];
+		std::fill(std::begin(layerSubsteps), std::end(layerSubsteps), GetSubstepCount(a_delta, a_maxSubsteps));
+		Integrate(a_delta, layerSubsteps);
+	}
+
+	void SpringBank::Integrate(float a_delta, const int (&a_layerSubsteps)[kLayers])
+	{
+		// A non-positive delta only refreshes totals
+		int numSteps[kLayers]{};
+		float stepDelta[kLayers]{};
+		if (a_delta > 0.0f) {
+			for (int layer = 0; layer < kLayers; ++layer) {
+				numSteps[layer] = std::max(a_layerSubsteps[layer], 1);
+				stepDelta[layer] = a_delta / static_cast<float>(numSteps[layer]);
+			}
+		}
+
+		switch (GetSpringKernel()) {
+#if SETTLECORE_AVX_KERNEL
+		case SpringKernel::kAVX:
+			Kernels::IntegrateAVX(*this, stepDelta, numSteps);
+			break;
+#endif
+#if SETTLECORE_SSE_KERNEL
+		case SpringKernel::kSSE:
+			Kernels::IntegrateSSE(*this, stepDelta, numSteps);
+			break;
+#endif
+		default:
+			Kernels::IntegrateScalar(*this, stepDelta, numSteps);
+			break;
+		}
+	}
+
+	void SpringBank::IntegrateClosedForm()
+	{
+		switch (GetSpringKernel()) {
+#if SETTLECORE_AVX_KERNEL
+		case SpringKernel::kAVX:
+			Kernels::IntegrateExactAVX(*this);
+			break;
+#endif
+#if SETTLECORE_SSE_KERNEL
+		case SpringKernel::kSSE:
+			Kernels::IntegrateExactSSE(*this);
+			break;
+#endif
+		default:
+			Kernels::IntegrateExactScalar(*this);
+			break;
+		}
+	}
+
+	std::uint32_t SpringBank::SettleLayers(float a_energyThreshold)
+	{
+		std::uint32_t activeMask = 0;
+		bool snapped = false;
+
+		for (int layer = 0; layer < kLayers; ++layer) {
+			const int base = layer * kLaneStride;
+			float energy = 0.0f;
+			for (int lane = base; lane < base + kLaneStride; ++lane) {
+				energy += velocity[lane] * velocity[lane] - negStiffness[lane] * offset[lane] * offset[lane];
+			}
+			energy *= 0.5f;
+
+			if (energy >= a_energyThreshold) {
+				activeMask |= Activity::Layer(layer);
+				continue;
+			}
+
+			// Only count it as a snap if there was anything left to zero
+			for (int lane = base; lane < base + kLaneStride; ++lane) {
+				snapped |= offset[lane] != 0.0f || velocity[lane] != 0.0f;
+				offset[lane] = 0.0f;
+				velocity[lane] = 0.0f;
+			}
+		}
+
+		if (snapped) {
+			SumTotals(*this);
+		}
+		return activeMask;
+	}
+
+	void SpringBank::SavePrevious()
+	{
+		std::copy(std::begin(total), std::end(total), std::begin(previousTotal));
+	}
+
+	void SpringBank::Reset()
+	{
+		std::fill(std::begin(offset), std::end(offset), 0.0f);
+		std::fill(std::begin(velocity), std::end(velocity), 0.0f);
+		std::fill(std::begin(total), std::end(total), 0.0f);
+		std::fill(std::begin(previousTotal), std::end(previousTotal), 0.0f);
+	}
+
+	namespace Kernels
+	{
+		void IntegrateScalar(SpringBank& a_bank, const float* a_stepDelta, const int* a_numSteps)
+		{
+			for (int layer = 0; layer < SpringBank::kLayers; ++layer) {
+				const int base = layer * SpringBank::kLaneStride;
+				const float h = a_stepDelta[layer];
+				for (int step = 0; step < a_numSteps[layer]; ++step) {
+					for (int lane = base; lane < base + SpringBank::kLaneStride; ++lane) {
+						// F = -k * x - c * v (target is 0)
+						float force = a_bank.negStiffness[lane] * a_bank.offset[lane] - a_bank.damping[lane] * a_bank.velocity[lane];
+						float v = a_bank.velocity[lane] + force * h;
+						v = std::clamp(v, -a_bank.maxVelocity[lane], a_bank.maxVelocity[lane]);
+						float x = a_bank.offset[lane] + v * h;
+						a_bank.velocity[lane] = v;
+						a_bank.offset[lane] = std::clamp(x, -a_bank.maxOffset[lane], a_bank.maxOffset[lane]);
+					}
+				}
+			}
+
+			SumTotals(a_bank);
+		}
+
+		void IntegrateExactScalar(SpringBank& a_bank)
+		{
+			for (int lane = 0; lane < SpringBank::kLanes; ++lane) {
+				float x = a_bank.offset[lane];
+				float v = a_bank.velocity[lane];
+				float nx = a_bank.transXX[lane] * x + a_bank.transXV[lane] * v;
+				float nv = a_bank.transVX[lane] * x + a_bank.transVV[lane] * v;
+				a_bank.velocity[lane] = std::clamp(nv, -a_bank.maxVelocity[lane], a_bank.maxVelocity[lane]);
+				a_bank.offset[lane] = std::clamp(nx, -a_bank.maxOffset[lane], a_bank.maxOffset[lane]);
+			}
+
+			SumTotals(a_bank);
+		}
+	}
+}
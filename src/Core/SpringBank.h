@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Core/SettleCore.h"
+
+#include <cstdint>
+
+namespace SettleCore
+{
+	// Spring layers, in SpringBank order (combined additively)
+	enum SpringLayer : int
+	{
+		kMovementLayer = 0,  // Walk/run/sprint
+		kJumpLayer,          // Jump/land
+		kSneakLayer,         // Sneak/unsneak
+		kHitLayer,           // Taking hits and hitting
+		kArcheryLayer,       // Arrow release
+		kSpringLayerCount
+	};
+
+	// Per-frame activity bits; a clear bit means that part of Update() can be skipped
+	namespace Activity
+	{
+		constexpr std::uint32_t kSpringLayers = (1u << kSpringLayerCount) - 1;  // Bit per SpringLayer
+		constexpr std::uint32_t kIdleNoise = 1u << 5;
+		constexpr std::uint32_t kSprintEffects = 1u << 6;
+		constexpr std::uint32_t kFovPunch = 1u << 7;
+
+		constexpr std::uint32_t Layer(int a_layer) { return 1u << a_layer; }
+	}
+
+	// Which integration kernel SpringBank::Integrate runs
+	enum class SpringKernel : int
+	{
+		kScalar = 0,
+		kSSE,
+		kAVX
+	};
+
+	// Structure-of-arrays bank holding every spring layer so all channels are
+	// integrated in one pass. Each layer owns 8 lanes:
+	//   [0..2] position x/y/z, [3] pad, [4..6] rotation x/y/z, [7] pad
+	// so one AVX register (or two SSE registers) covers a layer, and the
+	// per-axis totals are a vertical sum across layers.
+	struct SpringBank
+	{
+		static constexpr int kLayers = kSpringLayerCount;
+		static constexpr int kLaneStride = 8;
+		static constexpr int kLanes = kLayers * kLaneStride;
+
+		alignas(32) float offset[kLanes]{};
+		alignas(32) float velocity[kLanes]{};
+		alignas(32) float negStiffness[kLanes]{};  // -k
+		alignas(32) float damping[kLanes]{};       // c (already scaled by settling)
+		alignas(32) float maxVelocity[kLanes]{};
+		alignas(32) float maxOffset[kLanes]{};
+
+		// Per-lane transition (see SpringCoefficients), used by IntegrateClosedForm
+		alignas(32) float transXX[kLanes]{};
+		alignas(32) float transXV[kLanes]{};
+		alignas(32) float transVX[kLanes]{};
+		alignas(32) float transVV[kLanes]{};
+
+		// Sum of all layer offsets, written by Integrate
+		alignas(32) float total[kLaneStride]{};
+
+		// total as of the previous fixed step (see SavePrevious), for render interpolation
+		alignas(32) float previousTotal[kLaneStride]{};
+
+		// Copy a layer in from its SpringState and per-action settings
+		void Load(int a_layer, const SpringState& a_state, const ActionSettings& a_settings, float a_dampingMult);
+
+		// Copy a layer's integrated state back out
+		void Store(int a_layer, SpringState& a_state) const;
+
+		// Set a layer's transition - closed form or a ComputeStepTransition matrix (call after Load)
+		void SetTransition(int a_layer, const SpringCoefficients& a_coefficients);
+
+		// Integrate every layer with the same sub-stepping as UpdateSpring, then sum totals
+		void Integrate(float a_delta, int a_maxSubsteps);
+
+		// Integrate each layer with its own sub-step count (see GetAutoSubstepCount), then sum totals
+		void Integrate(float a_delta, const int (&a_layerSubsteps)[kLayers]);
+
+		// Advance every layer by the transitions set this frame, then sum totals
+		void IntegrateClosedForm();
+
+		// Snap layers whose spring energy (0.5 * (v^2 + k * x^2) over all axes) is below
+		// a_energyThreshold to exactly zero. Returns the Activity bits of layers still moving.
+		std::uint32_t SettleLayers(float a_energyThreshold);
+
+		// Remember the current totals before advancing one fixed step
+		void SavePrevious();
+
+		void Reset();
+
+		Vec3 TotalPosition() const { return { total[0], total[1], total[2] }; }
+		Vec3 TotalRotation() const { return { total[4], total[5], total[6] }; }
+
+		// Totals blended between the previous and current step (a_alpha = 1 gives exactly total)
+		Vec3 InterpolatedPosition(float a_alpha) const { return Interpolate(0, a_alpha); }
+		Vec3 InterpolatedRotation(float a_alpha) const { return Interpolate(4, a_alpha); }
+
+	private:
+		Vec3 Interpolate(int a_lane, float a_alpha) const
+		{
+			const float inv = 1.0f - a_alpha;
+			return {
+				previousTotal[a_lane + 0] * inv + total[a_lane + 0] * a_alpha,
+				previousTotal[a_lane + 1] * inv + total[a_lane + 1] * a_alpha,
+				previousTotal[a_lane + 2] * inv + total[a_lane + 2] * a_alpha
+			};
+		}
+	};
+
+	// Best kernel the running CPU supports (detected once)
+	SpringKernel GetBestSpringKernel();
+
+	// Currently selected kernel (defaults to the best supported one)
+	SpringKernel GetSpringKernel();
+
+	// Force a kernel (used by settle_bench); unsupported kernels fall back to the best one
+	void SetSpringKernel(SpringKernel a_kernel);
+
+	bool IsSpringKernelSupported(SpringKernel a_kernel);
+
+	const char* GetSpringKernelName(SpringKernel a_kernel);
+}
@@ -0,0 +1,92 @@
+#include "Core/SpringKernels.h"
+
+// Compiled with /arch:AVX (MSVC) or -mavx (GCC/Clang); only called after a CPUID check
+#if SETTLECORE_AVX_KERNEL
+
+#	include <immintrin.h>
+
+namespace SettleCore::Kernels
+{
+	void IntegrateAVX(SpringBank& a_bank, const float* a_stepDelta, const int* a_numSteps)
+	{
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+		// One register per layer; keep the state in registers across sub-steps
+		__m256 x[SpringBank::kLayers];
+		__m256 v[SpringBank::kLayers];
+		for (int layer = 0; layer < SpringBank::kLayers; ++layer) {
+			x[layer] = _mm256_load_ps(a_bank.offset + layer * SpringBank::kLaneStride);
+			v[layer] = _mm256_load_ps(a_bank.velocity + layer * SpringBank::kLaneStride);
+		}
+
+		for (int layer = 0; layer < SpringBank::kLayers; ++layer) {
+			if (a_numSteps[layer] > 0) {
+				const __m256 h = _mm256_set1_ps(a_stepDelta[layer]);
+				const int base = layer * SpringBank::kLaneStride;
+				const __m256 negK = _mm256_load_ps(a_bank.negStiffness + base);
+				const __m256 c = _mm256_load_ps(a_bank.damping + base);
+				const __m256 maxV = _mm256_load_ps(a_bank.maxVelocity + base);
+				const __m256 maxX = _mm256_load_ps(a_bank.maxOffset + base);
+				const __m256 minV = _mm256_xor_ps(maxV, signMask);
+				const __m256 minX = _mm256_xor_ps(maxX, signMask);
+
+				__m256 lx = x[layer];
+				__m256 lv = v[layer];
+				for (int step = 0; step < a_numSteps[layer]; ++step) {
+					// F = -k * x - c * v (target is 0)
+					__m256 force = _mm256_sub_ps(_mm256_mul_ps(negK, lx), _mm256_mul_ps(c, lv));
+					lv = _mm256_add_ps(lv, _mm256_mul_ps(force, h));
+					lv = _mm256_min_ps(_mm256_max_ps(lv, minV), maxV);
+
+					lx = _mm256_add_ps(lx, _mm256_mul_ps(lv, h));
+					lx = _mm256_min_ps(_mm256_max_ps(lx, minX), maxX);
+				}
+				x[layer] = lx;
+				v[layer] = lv;
+
+				_mm256_store_ps(a_bank.offset + base, lx);
+				_mm256_store_ps(a_bank.velocity + base, lv);
+			}
+		}
+
+		// Totals: vertical sum across layers (same order as the scalar path)
+		__m256 sum = x[0];
+		for (int layer = 1; layer < SpringBank::kLayers; ++layer) {
+			sum = _mm256_add_ps(sum, x[layer]);
+		}
+		_mm256_store_ps(a_bank.total, sum);
+
+		// Avoid AVX-SSE transition penalties in the caller
+		_mm256_zeroupper();
+	}
+
+	void IntegrateExactAVX(SpringBank& a_bank)
+	{
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		__m256 sum = _mm256_setzero_ps();
+
+		for (int layer = 0; layer < SpringBank::kLayers; ++layer) {
+			const int base = layer * SpringBank::kLaneStride;
+			const __m256 x = _mm256_load_ps(a_bank.offset + base);
+			const __m256 v = _mm256_load_ps(a_bank.velocity + base);
+			const __m256 maxV = _mm256_load_ps(a_bank.maxVelocity + base);
+			const __m256 maxX = _mm256_load_ps(a_bank.maxOffset + base);
+
+			__m256 nx = _mm256_add_ps(_mm256_mul_ps(_mm256_load_ps(a_bank.transXX + base), x), _mm256_mul_ps(_mm256_load_ps(a_bank.transXV + base), v));
+			__m256 nv = _mm256_add_ps(_mm256_mul_ps(_mm256_load_ps(a_bank.transVX + base), x), _mm256_mul_ps(_mm256_load_ps(a_bank.transVV + base), v));
+			nv = _mm256_min_ps(_mm256_max_ps(nv, _mm256_xor_ps(maxV, signMask)), maxV);
+			nx = _mm256_min_ps(_mm256_max_ps(nx, _mm256_xor_ps(maxX, signMask)), maxX);
+
+			_mm256_store_ps(a_bank.velocity + base, nv);
+			_mm256_store_ps(a_bank.offset + base, nx);
+
+			// Totals: vertical sum across layers, fused into the same pass
+			sum = _mm256_add_ps(sum, nx);
+		}
+		_mm256_store_ps(a_bank.total, sum);
+
+		_mm256_zeroupper();
+	}
+}
+
+#endif
@@ -0,0 +1,83 @@
+#include "Core/SpringKernels.h"
+
+#if SETTLECORE_SSE_KERNEL
+
+#	include <xmmintrin.h>
+
+namespace SettleCore::Kernels
+{
+	namespace
+	{
+		// Vertical sum of the position and rotation halves across layers
+		void SumTotals(SpringBank& a_bank)
+		{
+			__m128 pos = _mm_load_ps(a_bank.offset);
+			__m128 rot = _mm_load_ps(a_bank.offset + 4);
+			for (int layer = 1; layer < SpringBank::kLayers; ++layer) {
+				const int base = layer * SpringBank::kLaneStride;
+				pos = _mm_add_ps(pos, _mm_load_ps(a_bank.offset + base));
+				rot = _mm_add_ps(rot, _mm_load_ps(a_bank.offset + base + 4));
+			}
+			_mm_store_ps(a_bank.total, pos);
+			_mm_store_ps(a_bank.total + 4, rot);
+		}
+	}
+
+	void IntegrateSSE(SpringBank& a_bank, const float* a_stepDelta, const int* a_numSteps)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		// Lanes are independent, so run every sub-step on one register pair before moving on
+		for (int lane = 0; lane < SpringBank::kLanes; lane += 4) {
+			const int layer = lane / SpringBank::kLaneStride;
+			const __m128 h = _mm_set1_ps(a_stepDelta[layer]);
+			__m128 x = _mm_load_ps(a_bank.offset + lane);
+			__m128 v = _mm_load_ps(a_bank.velocity + lane);
+			const __m128 negK = _mm_load_ps(a_bank.negStiffness + lane);
+			const __m128 c = _mm_load_ps(a_bank.damping + lane);
+			const __m128 maxV = _mm_load_ps(a_bank.maxVelocity + lane);
+			const __m128 maxX = _mm_load_ps(a_bank.maxOffset + lane);
+			const __m128 minV = _mm_xor_ps(maxV, signMask);
+			const __m128 minX = _mm_xor_ps(maxX, signMask);
+
+			for (int step = 0; step < a_numSteps[layer]; ++step) {
+				// F = -k * x - c * v (target is 0)
+				__m128 force = _mm_sub_ps(_mm_mul_ps(negK, x), _mm_mul_ps(c, v));
+				v = _mm_add_ps(v, _mm_mul_ps(force, h));
+				v = _mm_min_ps(_mm_max_ps(v, minV), maxV);
+
+				x = _mm_add_ps(x, _mm_mul_ps(v, h));
+				x = _mm_min_ps(_mm_max_ps(x, minX), maxX);
+			}
+
+			_mm_store_ps(a_bank.velocity + lane, v);
+			_mm_store_ps(a_bank.offset + lane, x);
+		}
+
+		SumTotals(a_bank);
+	}
+
+	void IntegrateExactSSE(SpringBank& a_bank)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		for (int lane = 0; lane < SpringBank::kLanes; lane += 4) {
+			const __m128 x = _mm_load_ps(a_bank.offset + lane);
+			const __m128 v = _mm_load_ps(a_bank.velocity + lane);
+			const __m128 maxV = _mm_load_ps(a_bank.maxVelocity + lane);
+			const __m128 maxX = _mm_load_ps(a_bank.maxOffset + lane);
+
+			__m128 nx = _mm_add_ps(_mm_mul_ps(_mm_load_ps(a_bank.transXX + lane), x), _mm_mul_ps(_mm_load_ps(a_bank.transXV + lane), v));
+			__m128 nv = _mm_add_ps(_mm_mul_ps(_mm_load_ps(a_bank.transVX + lane), x), _mm_mul_ps(_mm_load_ps(a_bank.transVV + lane), v));
+			nv = _mm_min_ps(_mm_max_ps(nv, _mm_xor_ps(maxV, signMask)), maxV);
+			nx = _mm_min_ps(_mm_max_ps(nx, _mm_xor_ps(maxX, signMask)), maxX);
+
+			_mm_store_ps(a_bank.velocity + lane, nv);
+			_mm_store_ps(a_bank.offset + lane, nx);
+		}
+
+		SumTotals(a_bank);
+	}
+}
+
+#endif
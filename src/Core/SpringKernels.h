@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Core/SpringBank.h"
+
+// Internal: per-ISA SpringBank kernels. Integrate* runs a_numSteps[layer]
+// semi-implicit Euler steps of a_stepDelta[layer] over each layer's lanes,
+// IntegrateExact* applies each layer's transition once; both then write
+// a_bank.total.
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#	define SETTLECORE_SSE_KERNEL 1
+#else
+#	define SETTLECORE_SSE_KERNEL 0
+#endif
+
+// Set by CMake when SpringBankAVX.cpp is built with AVX code generation
+#ifndef SETTLECORE_AVX_KERNEL
+#	define SETTLECORE_AVX_KERNEL 0
+#endif
+
+namespace SettleCore::Kernels
+{
+	void IntegrateScalar(SpringBank& a_bank, const float* a_stepDelta, const int* a_numSteps);
+	void IntegrateExactScalar(SpringBank& a_bank);
+
+#if SETTLECORE_SSE_KERNEL
+	void IntegrateSSE(SpringBank& a_bank, const float* a_stepDelta, const int* a_numSteps);
+	void IntegrateExactSSE(SpringBank& a_bank);
+#endif
+
+#if SETTLECORE_AVX_KERNEL
+	void IntegrateAVX(SpringBank& a_bank, const float* a_stepDelta, const int* a_numSteps);
+	void IntegrateExactAVX(SpringBank& a_bank);
+#endif
+}
@@ -0,0 +1,130 @@
+#include "Core/SpringRig.h"
+
+namespace SettleCore
+{
+	std::uint32_t SpringRig::Step(const RigFrame& a_frame)
+	{
+		// Layers with a pending blend or any non-zero state need work this frame.
+		// Settled layers are snapped to exactly zero, so a dormant layer costs nothing.
+		std::uint32_t springMask = 0;
+		for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+			if (blends[layer].IsActive() || !springs[layer].IsAtRest()) {
+				springMask |= Activity::Layer(layer);
+			}
+		}
+
+		// Fixed-timestep mode runs zero or more constant-size steps and the renderer
+		// interpolates between the last two; otherwise one step of the frame delta
+		int numSteps = 1;
+		float stepDelta = a_frame.delta;
+		const bool fixedStep = a_frame.fixedStepRate > 0;
+		if (fixedStep) {
+			numSteps = clock.Advance(a_frame.delta, a_frame.fixedStepRate, a_frame.maxFixedSteps);
+			stepDelta = clock.GetStepDelta();
+			alpha = clock.GetAlpha();
+		} else {
+			clock.Reset();
+			alpha = 1.0f;
+		}
+
+		// Each layer can override the global integrator. When every layer is on Euler the
+		// sub-stepped kernels run as before; otherwise every layer goes through its own
+		// transition matrix (closed form, or a step integrator's matrix) in one pass.
+		SpringIntegrator layerIntegrators[kSpringLayerCount];
+		bool allEuler = true;
+		for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+			layerIntegrators[layer] = ResolveIntegrator(*a_frame.layerSettings[layer], a_frame.integrator);
+			allEuler &= layerIntegrators[layer] == SpringIntegrator::Euler;
+		}
+
+		// Euler and Verlet sub-steps per layer: a fixed 16ms split, or only as many as the
+		// layer's stiffness/damping needs (soft walk springs run one step, stiff hits run more)
+		int layerSubsteps[kSpringLayerCount];
+		for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+			if (a_frame.autoSubsteps) {
+				const ActionSettings& layerSettings = *a_frame.layerSettings[layer];
+				float maxStableStep = layerSettings.maxStableStep > 0.0f ?
+				                          layerSettings.maxStableStep :
+				                          GetMaxStableStep(layerSettings.Stiffness(), layerSettings.Damping() * a_frame.dampingMult);
+				layerSubsteps[layer] = GetAutoSubstepCount(stepDelta, maxStableStep, a_frame.substeps);
+			} else {
+				layerSubsteps[layer] = GetSubstepCount(stepDelta, a_frame.substeps);
+			}
+		}
+
+		for (int step = 0; step < numSteps; ++step) {
+			bank.SavePrevious();
+			if (springMask == 0) {
+				break;
+			}
+
+			// Update pending blends (applies impulses smoothly over time)
+			for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+				UpdateBlend(springs[layer], blends[layer], stepDelta);
+			}
+
+			// All layers go through the SoA bank in one pass
+			for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+				const ActionSettings& layerSettings = *a_frame.layerSettings[layer];
+				bank.Load(layer, springs[layer], layerSettings, a_frame.dampingMult);
+				if (allEuler) {
+					continue;
+				}
+				switch (layerIntegrators[layer]) {
+				case SpringIntegrator::ClosedForm:
+					{
+						int slot = ClosedFormCache::Slot(a_frame.layerActions[layer], a_frame.weaponDrawn);
+						bank.SetTransition(layer, closedFormCache.Get(slot, layerSettings, a_frame.settingsVersion, stepDelta, a_frame.dampingMult, fixedStep));
+						break;
+					}
+				case SpringIntegrator::ImplicitEuler:
+					bank.SetTransition(layer, ComputeStepTransition(SpringIntegrator::ImplicitEuler, layerSettings.Stiffness(),
+						layerSettings.Damping() * a_frame.dampingMult, stepDelta, 1));
+					break;
+				default:
+					// Euler and Verlet share Euler's stability limit, so both take the layer's sub-steps
+					bank.SetTransition(layer, ComputeStepTransition(layerIntegrators[layer], layerSettings.Stiffness(),
+						layerSettings.Damping() * a_frame.dampingMult, stepDelta, layerSubsteps[layer]));
+					break;
+				}
+			}
+
+			if (allEuler) {
+				bank.Integrate(stepDelta, layerSubsteps);
+			} else {
+				bank.IntegrateClosedForm();
+			}
+
+			// Snap layers that have run out of energy so they go dormant next step
+			springMask = bank.SettleLayers(REST_ENERGY);
+
+			for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+				bank.Store(layer, springs[layer]);
+				if (blends[layer].IsActive()) {
+					springMask |= Activity::Layer(layer);
+				}
+			}
+		}
+
+		return springMask;
+	}
+
+	void SpringRig::Reset()
+	{
+		for (int layer = 0; layer < kSpringLayerCount; ++layer) {
+			springs[layer].Reset();
+			blends[layer].Reset();
+		}
+		bank.Reset();
+		clock.Reset();
+		alpha = 1.0f;
+	}
+
+	void CombineOffsets(const SpringRig& a_rig, const IdleNoiseState& a_noise, Vec3& a_outPos, Vec3& a_outRot)
+	{
+		const Vec3 springPos = a_rig.Position();
+		const Vec3 springRot = a_rig.Rotation();
+		a_outPos = { springPos.x + a_noise.offset.x, springPos.y + a_noise.offset.y, springPos.z + a_noise.offset.z };
+		a_outRot = { springRot.x + a_noise.rotation.x, springRot.y + a_noise.rotation.y, springRot.z + a_noise.rotation.z };
+	}
+}
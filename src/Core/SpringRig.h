@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Core/ClosedFormCache.h"
+#include "Core/FixedStep.h"
+#include "Core/SettleCore.h"
+#include "Core/SpringBank.h"
+
+#include <cstdint>
+
+namespace SettleCore
+{
+	// Per-frame inputs to SpringRig::Step, gathered by CameraSettleManager::Update
+	// (or rebuilt from a recording by settle_replay)
+	struct RigFrame
+	{
+		float delta{ 0.0f };
+		float dampingMult{ 1.0f };          // Settling multiplier applied to every layer's damping
+		std::uint32_t settingsVersion{ 0 };
+		SpringIntegrator integrator{ SpringIntegrator::Euler };
+		int substeps{ 4 };                  // Euler/Verlet sub-steps, or the per-layer cap with autoSubsteps
+		bool autoSubsteps{ false };         // Pick each layer's Euler/Verlet sub-steps from its stability bound
+		int fixedStepRate{ 0 };             // > 0 runs the layers on a FixedStepClock at this rate (Hz)
+		int maxFixedSteps{ 8 };
+		bool weaponDrawn{ false };
+
+		// Action whose settings drive each layer (kTotal = no action) and the settings themselves
+		ActionType layerActions[kSpringLayerCount]{};
+		const ActionSettings* layerSettings[kSpringLayerCount]{};
+	};
+
+	// The additive spring layers, their pending blends and the SoA bank they are
+	// integrated through. Step() runs blends, integration and settling for a frame.
+	struct SpringRig
+	{
+		// Spring layers below this energy are snapped to zero and go dormant (~1e-5 units / radians)
+		static constexpr float REST_ENERGY = 1e-8f;
+
+		SpringState springs[kSpringLayerCount];
+		PendingBlend blends[kSpringLayerCount];
+
+		SpringBank bank;                  // Also holds the summed offsets
+		ClosedFormCache closedFormCache;  // SpringIntegrator::ClosedForm coefficients per action
+		FixedStepClock clock;
+		float alpha{ 1.0f };              // Render interpolation between the last two steps (1 = latest)
+
+		// Advance every layer by a_frame.delta. Layers with no pending blend and no state
+		// are skipped. Returns the Activity bits of layers still moving.
+		std::uint32_t Step(const RigFrame& a_frame);
+
+		// Summed layer offsets at render time (interpolated in fixed-timestep mode)
+		Vec3 Position() const { return bank.InterpolatedPosition(alpha); }
+		Vec3 Rotation() const { return bank.InterpolatedRotation(alpha); }
+
+		// Resets springs, blends, bank and clock; cached coefficients are kept
+		void Reset();
+	};
+
+	// Final camera offset: spring layers plus idle noise
+	void CombineOffsets(const SpringRig& a_rig, const IdleNoiseState& a_noise, Vec3& a_outPos, Vec3& a_outRot);
+}
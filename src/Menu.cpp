@@ -53,11 +53,6 @@ namespace Menu
 		DrawHeader();
 		ImGui::Separator();
 		
-		// Disable all settings when not in Edit Mode
-		if (!State::editMode) {
-			ImGui::BeginDisabled();
-		}
-		
 		DrawGeneralSettings();
 		DrawWeaponStateSettings();
 		DrawMovementSettings();
@@ -71,16 +66,6 @@ namespace Menu
 		ImGui::Separator();
 		DrawActionSettings();
 		
-		if (!State::editMode) {
-			ImGui::EndDisabled();
-			
-			// Show message about edit mode
-			ImGui::Spacing();
-			ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.8f, 0.3f, 1.0f));
-			ImGui::TextWrapped("Enable Edit Mode above to modify settings. Changes will apply instantly while playing.");
-			ImGui::PopStyleColor();
-		}
-		
 		ImGui::Separator();
 		DrawSaveLoadButtons();
 	}
@@ -89,23 +74,9 @@ namespace Menu
 	{
 		auto* settings = Settings::GetSingleton();
 		
-		// Edit Mode toggle - prominent at the top
-		ImGui::PushStyleColor(ImGuiCol_Text, State::editMode ? ImVec4(0.2f, 1.0f, 0.2f, 1.0f) : ImVec4(0.7f, 0.7f, 0.7f, 1.0f));
-		if (ImGui::Checkbox("Edit Mode", &State::editMode)) {
-			settings->SetEditMode(State::editMode);
-		}
-		ImGui::PopStyleColor();
-		if (ImGui::IsItemHovered()) {
-			ImGui::SetTooltip("When enabled, changes apply instantly while playing.\nDisable for better performance when not editing.");
-		}
-		
-		ImGui::SameLine();
-		ImGui::Text("|");
-		ImGui::SameLine();
-		
 		// Enabled toggle
 		if (ImGui::Checkbox("Enabled", &settings->enabled)) {
-			MarkSettingsChanged();
+			MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
 		}
 		
 		ImGui::SameLine();
@@ -141,6 +112,28 @@ namespace Menu
 			ImGui::SameLine();
 			ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "(Unsaved changes)");
 		}
+		
+		// Profile selector - switching is instant
+		auto profileNames = settings->GetProfileNames();
+		const int activeProfile = settings->GetActiveProfile();
+		if (activeProfile < static_cast<int>(profileNames.size())) {
+			ImGui::SetNextItemWidth(200.0f);
+			if (ImGui::BeginCombo("Profile", profileNames[activeProfile].c_str())) {
+				for (int i = 0; i < static_cast<int>(profileNames.size()); ++i) {
+					bool isSelected = (activeProfile == i);
+					if (ImGui::Selectable(profileNames[i].c_str(), isSelected) && !isSelected) {
+						settings->SelectProfile(i);
+					}
+					if (isSelected) {
+						ImGui::SetItemDefaultFocus();
+					}
+				}
+				ImGui::EndCombo();
+			}
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("Profiles are [Profile.<Name>.<Section>] sections in the INI. Save writes the active profile.");
+			}
+		}
 	}
 	
 	void DrawGeneralSettings()
@@ -152,12 +145,12 @@ namespace Menu
 			
 			if (SliderFloatWithTooltip("Global Intensity", &settings->globalIntensity, 0.0f, 5.0f, "%.2f",
 				"Master multiplier for all camera settle effects")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
 			}
 			
 			if (SliderFloatWithTooltip("Smoothing Factor", &settings->smoothingFactor, 0.0f, 1.0f, "%.2f",
 				"Input smoothing (0 = no smoothing, 1 = maximum)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
 			}
 			
 			ImGui::Spacing();
@@ -166,23 +159,74 @@ namespace Menu
 				"Disable camera effects when the game is paused (menus, console, etc.).\n\n"
 				"When enabled, opening any menu will reset and disable camera offsets,\n"
 				"preventing jarring jumps when you close the menu.")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
 			}
 			
 			ImGui::Spacing();
 			ImGui::Separator();
 			ImGui::Text("Performance:");
 			
+			const char* integratorNames[] = { "Euler (Sub-stepped)", "Closed-Form (Exact)", "Implicit Euler", "Velocity Verlet" };
+			if (ImGui::Combo("Spring Integrator", &settings->springIntegrator, integratorNames, static_cast<int>(SpringIntegrator::kTotal))) {
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
+			}
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("How spring physics are advanced each frame (actions can override this).\n\n"
+					"Euler: classic sub-stepped integration (uses Spring Substeps)\n"
+					"Closed-Form: exact damped-spring solution, one step per frame.\n"
+					"Behaves the same at 30 fps and 144 fps and never needs sub-steps.\n"
+					"Implicit Euler: one step per frame, never blows up at high stiffness\n"
+					"(settles slightly faster than the other integrators).\n"
+					"Velocity Verlet: sub-stepped like Euler (uses Spring Substeps), more accurate per step.");
+			}
+			
+			// Sub-steps only apply to the Euler and Verlet integrators
+			ImGui::BeginDisabled(settings->springIntegrator != static_cast<int>(SpringIntegrator::Euler) &&
+				settings->springIntegrator != static_cast<int>(SpringIntegrator::Verlet));
 			if (SliderIntWithTooltip("Spring Substeps", &settings->springSubsteps, 1, 8, "%d",
 				"Number of physics sub-steps per frame.\n\n"
 				"Higher values = more stable/accurate spring physics\n"
 				"Lower values = better performance\n\n"
 				"1-2: Fast, may be jittery with large movements\n"
 				"3-4: Balanced (recommended)\n"
-				"5-8: Very stable, higher CPU cost")) {
+				"5-8: Very stable, higher CPU cost\n\n"
+				"With Auto Substeps this is the most any single action may use.")) {
 				settings->springSubsteps = std::clamp(settings->springSubsteps, 1, 8);
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
 			}
+			
+			if (CheckboxWithTooltip("Auto Substeps", &settings->autoSubsteps,
+				"Pick sub-steps per action from its stiffness and damping.\n\n"
+				"Soft springs (walking) run a single step, stiff ones (hits)\n"
+				"run as many as they need to stay stable, up to Spring Substeps.")) {
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
+			}
+			ImGui::EndDisabled();
+			
+			if (CheckboxWithTooltip("Fixed Timestep", &settings->fixedTimestep,
+				"Simulate springs at a fixed rate and interpolate between steps.\n\n"
+				"Spring motion is identical at any frame rate, and the step cap\n"
+				"limits the cost of long frames (loading hitches, alt-tab).")) {
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
+			}
+			
+			ImGui::BeginDisabled(!settings->fixedTimestep);
+			if (SliderIntWithTooltip("Fixed Step Rate (Hz)", &settings->fixedStepRate, 60, 480, "%d",
+				"Internal simulation rate.\n\n"
+				"240: Smooth and stable (recommended)\n"
+				"120: Cheaper, fine for soft springs\n"
+				"480: Very stiff springs only")) {
+				settings->fixedStepRate = std::clamp(settings->fixedStepRate, 60, 480);
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
+			}
+			if (SliderIntWithTooltip("Max Steps per Frame", &settings->maxFixedSteps, 1, 16, "%d",
+				"Upper bound on fixed steps run in one frame.\n\n"
+				"Time beyond this is dropped, so a hitch slows the\n"
+				"springs down briefly instead of spiking CPU cost.")) {
+				settings->maxFixedSteps = std::clamp(settings->maxFixedSteps, 1, 16);
+				MarkSettingsChanged(Ini::SectionBit(Ini::kGeneral));
+			}
+			ImGui::EndDisabled();
 		} else {
 			State::generalExpanded = false;
 		}
@@ -200,13 +244,13 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable When Drawn", &settings->weaponDrawnEnabled,
 				"Enable camera settle effects when weapon is drawn")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kWeaponState));
 			}
 			
 			if (settings->weaponDrawnEnabled) {
 				if (SliderFloatWithTooltip("Drawn Multiplier", &settings->weaponDrawnMult, 0.0f, 5.0f, "%.2f",
 					"Effect intensity multiplier when weapon is drawn")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kWeaponState));
 				}
 			}
 			
@@ -214,13 +258,13 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable When Sheathed", &settings->weaponSheathedEnabled,
 				"Enable camera settle effects when weapon is sheathed")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kWeaponState));
 			}
 			
 			if (settings->weaponSheathedEnabled) {
 				if (SliderFloatWithTooltip("Sheathed Multiplier", &settings->weaponSheathedMult, 0.0f, 5.0f, "%.2f",
 					"Effect intensity multiplier when weapon is sheathed")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kWeaponState));
 				}
 			}
 		} else {
@@ -242,7 +286,7 @@ namespace Menu
 				"Blend walk/run impulses based on actual controller input magnitude.\n\n"
 				"When enabled: Analog sticks will smoothly blend between walk and run\n"
 				"When disabled: Binary walk/run based on toggle key only")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kMovement));
 			}
 			
 			ImGui::Spacing();
@@ -252,7 +296,7 @@ namespace Menu
 				"the walk impulse is skipped.\n\n"
 				"Prevents jarring walk impulse when you intend to immediately sprint/run.\n"
 				"Set to 0 to disable (always trigger walk impulse).")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kMovement));
 			}
 		} else {
 			State::movementExpanded = false;
@@ -273,7 +317,7 @@ namespace Menu
 				"Scale landing impulse based on how long you were in the air.\n\n"
 				"Also prevents jump impulse when walking off ledges\n"
 				"(only actual jumps trigger the jump impulse).")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kJump));
 			}
 			
 			if (settings->scaleJumpByAirTime) {
@@ -285,13 +329,13 @@ namespace Menu
 					"Minimum air time to trigger any landing impulse.\n\n"
 					"Drops shorter than this are ignored (stairs, small bumps).\n"
 					"0.1-0.15 = good for most cases")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kJump));
 				}
 				
 				if (SliderFloatWithTooltip("Max Air Time Scale", &settings->jumpMaxAirTimeScale, 0.5f, 5.0f, "%.1f sec",
 					"Air time above this is capped for scaling purposes.\n\n"
 					"Higher = longer falls can have bigger impacts")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kJump));
 				}
 				
 				ImGui::Spacing();
@@ -301,14 +345,14 @@ namespace Menu
 				if (SliderFloatWithTooltip("Base Scale", &settings->landBaseScale, 0.0f, 1.0f, "%.2f",
 					"Base landing impulse scale (always applied above min air time).\n\n"
 					"0.3 = 30% of configured landing impulse for minimum falls")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kJump));
 				}
 				
 				if (SliderFloatWithTooltip("Air Time Scale", &settings->landAirTimeScale, 0.0f, 2.0f, "%.2f",
 					"Additional scale based on air time (added to base).\n\n"
 					"At max air time: total scale = Base + this value\n"
 					"0.7 = adds up to 70% more based on fall duration")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kJump));
 				}
 			}
 		} else {
@@ -328,17 +372,17 @@ namespace Menu
 			
 			if (SliderFloatWithTooltip("Settle Delay", &settings->settleDelay, 0.0f, 2.0f, "%.2f sec",
 				"Delay before extra settling damping kicks in")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kSettling));
 			}
 			
 			if (SliderFloatWithTooltip("Settle Speed", &settings->settleSpeed, 0.5f, 10.0f, "%.1f",
 				"How fast the extra damping increases")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kSettling));
 			}
 			
 			if (SliderFloatWithTooltip("Settle Damping Mult", &settings->settleDampingMult, 1.0f, 10.0f, "%.1fx",
 				"Maximum damping multiplier when fully settled")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kSettling));
 			}
 		} else {
 			State::settlingExpanded = false;
@@ -355,14 +399,12 @@ namespace Menu
 			ImGui::TextWrapped("Subtle breathing/sway motion when standing idle. Separate settings for weapon drawn vs sheathed.");
 			ImGui::Spacing();
 			
-			ImGui::BeginDisabled(!State::editMode);
-			
 			// Shared blend time setting
 			if (SliderFloatWithTooltip("Blend Time", &settings->idleNoiseBlendTime, 0.05f, 1.0f, "%.2f sec",
 				"How long to blend in/out the idle noise when transitioning\n"
 				"Lower = faster transition\n"
 				"Higher = smoother, slower transition")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoise));
 			}
 			
 			// Dialogue/Map disable option
@@ -370,7 +412,7 @@ namespace Menu
 				"Disable idle camera noise when in dialogue or map menu.\n\n"
 				"When enabled, the idle noise will smoothly blend out\n"
 				"when entering these menus and blend back in after leaving.")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoise));
 			}
 			
 			ImGui::Spacing();
@@ -380,14 +422,14 @@ namespace Menu
 			if (CheckboxWithTooltip("Scale While Drawing Bow", &settings->idleNoiseScaleDuringArchery,
 				"Smoothly scale idle noise down while drawing a bow or crossbow,\n"
 				"then scale back up after release.")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoise));
 			}
 			
 			ImGui::BeginDisabled(!settings->idleNoiseScaleDuringArchery || settings->idleNoiseArcheryScaleBySkill);
 			if (SliderFloatWithTooltip("Draw Scale Amount", &settings->idleNoiseArcheryScaleAmount, 0.0f, 1.0f, "%.2f",
 				"Idle noise scale while drawing (0 = none, 1 = full).\n"
 				"Default 0.10 = 10% of normal noise.")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoise));
 			}
 			ImGui::EndDisabled();
 			
@@ -395,7 +437,7 @@ namespace Menu
 			if (CheckboxWithTooltip("Scale by Archery Skill", &settings->idleNoiseArcheryScaleBySkill,
 				"When enabled, the scale amount is based on Archery skill.\n"
 				"100 Archery = 0 (no idle noise while drawing).")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoise));
 			}
 			ImGui::EndDisabled();
 			
@@ -408,7 +450,7 @@ namespace Menu
 				
 				if (CheckboxWithTooltip("Enabled##IdleDrawn", &settings->idleNoiseEnabledDrawn,
 					"Enable idle camera noise when weapon is drawn")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseDrawn));
 				}
 				
 				if (settings->idleNoiseEnabledDrawn) {
@@ -417,15 +459,15 @@ namespace Menu
 					
 					if (SliderFloatWithTooltip("X (Left/Right)##IdleDrawn", &settings->idleNoisePosAmpXDrawn, 0.0f, 0.5f, "%.3f",
 						"Side-to-side position noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseDrawn));
 					}
 					if (SliderFloatWithTooltip("Y (Forward/Back)##IdleDrawn", &settings->idleNoisePosAmpYDrawn, 0.0f, 0.5f, "%.3f",
 						"Forward/backward position noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseDrawn));
 					}
 					if (SliderFloatWithTooltip("Z (Up/Down)##IdleDrawn", &settings->idleNoisePosAmpZDrawn, 0.0f, 0.5f, "%.3f",
 						"Up/down position noise amplitude (breathing)")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseDrawn));
 					}
 					
 					ImGui::Separator();
@@ -433,21 +475,21 @@ namespace Menu
 					
 					if (SliderFloatWithTooltip("Pitch##IdleDrawn", &settings->idleNoiseRotAmpXDrawn, 0.0f, 2.0f, "%.2f",
 						"Head pitch noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseDrawn));
 					}
 					if (SliderFloatWithTooltip("Roll##IdleDrawn", &settings->idleNoiseRotAmpYDrawn, 0.0f, 2.0f, "%.2f",
 						"Head roll noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseDrawn));
 					}
 					if (SliderFloatWithTooltip("Yaw##IdleDrawn", &settings->idleNoiseRotAmpZDrawn, 0.0f, 2.0f, "%.2f",
 						"Head yaw noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseDrawn));
 					}
 					
 					ImGui::Separator();
 					if (SliderFloatWithTooltip("Frequency##IdleDrawn", &settings->idleNoiseFrequencyDrawn, 0.1f, 1.0f, "%.2f",
 						"Noise frequency (cycles per second). Lower = slower, more relaxed")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseDrawn));
 					}
 				}
 				
@@ -465,7 +507,7 @@ namespace Menu
 				
 				if (CheckboxWithTooltip("Enabled##IdleSheathed", &settings->idleNoiseEnabledSheathed,
 					"Enable idle camera noise when weapon is sheathed")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseSheathed));
 				}
 				
 				if (settings->idleNoiseEnabledSheathed) {
@@ -474,15 +516,15 @@ namespace Menu
 					
 					if (SliderFloatWithTooltip("X (Left/Right)##IdleSheathed", &settings->idleNoisePosAmpXSheathed, 0.0f, 0.5f, "%.3f",
 						"Side-to-side position noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseSheathed));
 					}
 					if (SliderFloatWithTooltip("Y (Forward/Back)##IdleSheathed", &settings->idleNoisePosAmpYSheathed, 0.0f, 0.5f, "%.3f",
 						"Forward/backward position noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseSheathed));
 					}
 					if (SliderFloatWithTooltip("Z (Up/Down)##IdleSheathed", &settings->idleNoisePosAmpZSheathed, 0.0f, 0.5f, "%.3f",
 						"Up/down position noise amplitude (breathing)")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseSheathed));
 					}
 					
 					ImGui::Separator();
@@ -490,21 +532,21 @@ namespace Menu
 					
 					if (SliderFloatWithTooltip("Pitch##IdleSheathed", &settings->idleNoiseRotAmpXSheathed, 0.0f, 2.0f, "%.2f",
 						"Head pitch noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseSheathed));
 					}
 					if (SliderFloatWithTooltip("Roll##IdleSheathed", &settings->idleNoiseRotAmpYSheathed, 0.0f, 2.0f, "%.2f",
 						"Head roll noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseSheathed));
 					}
 					if (SliderFloatWithTooltip("Yaw##IdleSheathed", &settings->idleNoiseRotAmpZSheathed, 0.0f, 2.0f, "%.2f",
 						"Head yaw noise amplitude")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseSheathed));
 					}
 					
 					ImGui::Separator();
 					if (SliderFloatWithTooltip("Frequency##IdleSheathed", &settings->idleNoiseFrequencySheathed, 0.1f, 1.0f, "%.2f",
 						"Noise frequency (cycles per second). Lower = slower, more relaxed")) {
-						MarkSettingsChanged();
+						MarkSettingsChanged(Ini::SectionBit(Ini::kIdleNoiseSheathed));
 					}
 				}
 				
@@ -512,8 +554,6 @@ namespace Menu
 			} else {
 				ImGui::PopStyleColor();
 			}
-			
-			ImGui::EndDisabled();
 		} else {
 			State::idleNoiseExpanded = false;
 		}
@@ -529,25 +569,23 @@ namespace Menu
 			ImGui::TextWrapped("Visual effects applied when sprinting: FOV increase and radial blur.");
 			ImGui::Spacing();
 			
-			ImGui::BeginDisabled(!State::editMode);
-			
 			// === FOV SETTINGS ===
 			ImGui::Separator();
 			ImGui::Text("Field of View:");
 			
 			if (CheckboxWithTooltip("Enable FOV Effect", &settings->sprintFovEnabled,
 				"Increase FOV when sprinting for a sense of speed")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 			}
 			
 			if (settings->sprintFovEnabled) {
 				if (SliderFloatWithTooltip("FOV Delta", &settings->sprintFovDelta, 0.0f, 30.0f, "+%.1f degrees",
 					"Amount to increase FOV when sprinting\n(added to current first-person FOV)")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 				}
 				if (SliderFloatWithTooltip("Blend Speed##FOV", &settings->sprintFovBlendSpeed, 0.5f, 10.0f, "%.1f",
 					"How fast to blend in/out the FOV change\n(higher = faster transition)")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 				}
 			}
 			
@@ -559,40 +597,38 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable Radial Blur", &settings->sprintBlurEnabled,
 				"Apply radial blur effect when sprinting")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 			}
 			
 			if (settings->sprintBlurEnabled) {
 				if (SliderFloatWithTooltip("Blur Strength", &settings->sprintBlurStrength, 0.0f, 3.0f, "%.2f",
 					"Intensity of the radial blur effect\n(0 = none, 1 = normal, 3 = intense)")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 				}
 				if (SliderFloatWithTooltip("Blend Speed##Blur", &settings->sprintBlurBlendSpeed, 0.5f, 10.0f, "%.1f",
 					"How fast the blur strength transitions\n(higher = faster blend in/out)")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 				}
 				if (SliderFloatWithTooltip("Ramp Up Time", &settings->sprintBlurRampUp, 0.0f, 0.5f, "%.2f sec",
 					"How quickly the blur effect ramps up when triggered\n"
 					"Lower = snappier blur appearance\n"
 					"Higher = gradual blur fade-in")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 				}
 				if (SliderFloatWithTooltip("Ramp Down Time", &settings->sprintBlurRampDown, 0.0f, 0.5f, "%.2f sec",
 					"How quickly the blur effect fades when stopping\n"
 					"Lower = snappier blur disappearance\n"
 					"Higher = lingering blur fade-out")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 				}
 				if (SliderFloatWithTooltip("Center Clarity", &settings->sprintBlurRadius, 0.0f, 1.0f, "%.2f",
 					"How much of the screen center stays unblurred\n"
 					"0 = blur starts from center (full blur)\n"
 					"0.5 = center half stays clear\n"
 					"1 = only edges are blurred")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kSprintEffects));
 				}
 			}
-			
-			ImGui::EndDisabled();
 		} else {
 			State::sprintEffectsExpanded = false;
 		}
@@ -608,11 +644,9 @@ namespace Menu
 			ImGui::TextWrapped("Quick FOV punch that dips in, overshoots, then returns to normal.");
 			ImGui::Spacing();
 			
-			ImGui::BeginDisabled(!State::editMode);
-			
 			if (SliderFloatWithTooltip("Punch Duration", &settings->fovPunchDuration, 0.05f, 1.0f, "%.2f sec",
 				"Total time for the full punch (in, overshoot, return).")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kFOVPunch));
 			}
 			
 			ImGui::Spacing();
@@ -621,13 +655,13 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable Hit Punch", &settings->fovPunchHitEnabled,
 				"Apply a quick FOV punch when the player takes a hit (excludes damage over time).")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kFOVPunch));
 			}
 			
 			if (settings->fovPunchHitEnabled) {
 				if (SliderFloatWithTooltip("Hit Strength", &settings->fovPunchHitStrength, 0.0f, 15.0f, "%.1f%%",
 					"Percent of current FOV to punch in/out.\nExample: 5.0 = -5% then +5%.")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kFOVPunch));
 				}
 			}
 			
@@ -637,17 +671,15 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable Arrow Punch", &settings->fovPunchArrowEnabled,
 				"Apply a quick FOV punch when firing a bow or crossbow.")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kFOVPunch));
 			}
 			
 			if (settings->fovPunchArrowEnabled) {
 				if (SliderFloatWithTooltip("Arrow Strength", &settings->fovPunchArrowStrength, 0.0f, 15.0f, "%.1f%%",
 					"Percent of current FOV to punch in/out.\nExample: 3.0 = -3% then +3%.")) {
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::SectionBit(Ini::kFOVPunch));
 				}
 			}
-			
-			ImGui::EndDisabled();
 		} else {
 			State::fovPunchExpanded = false;
 		}
@@ -662,24 +694,34 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Debug Logging", &settings->debugLogging,
 				"Enable detailed debug messages in the log file")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kDebug));
 			}
 			
 			if (CheckboxWithTooltip("Debug On Screen", &settings->debugOnScreen,
 				"Show debug information on screen")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(Ini::SectionBit(Ini::kDebug));
 			}
 			
-			ImGui::Spacing();
+			if (CheckboxWithTooltip("Replay Recorder", &settings->replayRecording,
+				"Keep the last minute of camera frames in memory so it can be saved\nand replayed offline with settle_replay")) {
+				MarkSettingsChanged(Ini::SectionBit(Ini::kDebug));
+			}
 			
-			if (CheckboxWithTooltip("Enable Hot Reload", &settings->enableHotReload,
-				"Automatically reload INI when file changes")) {
-				MarkSettingsChanged();
+			ImGui::BeginDisabled(!settings->replayRecording);
+			if (ImGui::Button("Save Replay")) {
+				CameraSettle::CameraSettleManager::GetSingleton()->RequestReplayDump();
+				RE::DebugNotification("FP Camera Settle: Replay saved");
+			}
+			if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled)) {
+				ImGui::SetTooltip("Write the recorded frames to Data/SKSE/Plugins/FPCameraSettle_Replay_<time>.fpcr");
 			}
+			ImGui::EndDisabled();
 			
-			if (SliderFloatWithTooltip("Hot Reload Interval", &settings->hotReloadIntervalSec, 1.0f, 60.0f, "%.0f sec",
-				"How often to check for INI changes")) {
-				MarkSettingsChanged();
+			ImGui::Spacing();
+			
+			if (CheckboxWithTooltip("Enable Hot Reload", &settings->enableHotReload,
+				"Automatically reload INI when file changes (watched on a background thread)")) {
+				MarkSettingsChanged(Ini::SectionBit(Ini::kDebug));
 			}
 			
 			ImGui::Spacing();
@@ -787,7 +829,7 @@ namespace Menu
 					ActionSettings& sourceSettings = settings->GetActionSettingsForState(selectedAction, State::showingDrawnSettings);
 					ActionSettings& destSettings = settings->GetActionSettingsForState(selectedAction, State::copyToDrawn);
 					destSettings.CopyFrom(sourceSettings);
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::ActionSectionBit(State::copyToDrawn ? SettingsData::kDrawn : SettingsData::kSheathed, State::selectedActionIndex));
 					RE::DebugNotification(fmt::format("Copied {} to {}", sourceName, destName).c_str());
 					ImGui::CloseCurrentPopup();
 				}
@@ -876,7 +918,7 @@ namespace Menu
 					ActionType targetAction = static_cast<ActionType>(State::copyTargetActionIndex);
 					ActionSettings& destSettings = settings->GetActionSettingsForState(targetAction, State::copyTargetIsDrawn);
 					destSettings.CopyFrom(sourceSettings);
-					MarkSettingsChanged();
+					MarkSettingsChanged(Ini::ActionSectionBit(State::copyTargetIsDrawn ? SettingsData::kDrawn : SettingsData::kSheathed, State::copyTargetActionIndex));
 					
 					const char* targetStateName = State::copyTargetIsDrawn ? "Drawn" : "Sheathed";
 					RE::DebugNotification(fmt::format("Copied {} to {} ({})", 
@@ -907,10 +949,14 @@ namespace Menu
 		ImGui::PushID(label);
 		ImGui::PushID(isDrawn ? "drawn" : "sheathed");
 		
+		// INI section being edited, from the entry's place in the [weapon state][action] table
+		const auto* table = &Settings::GetSingleton()->actionSettings[0][0];
+		const auto section = Ini::SectionBit(Ini::kGlobalSectionCount + static_cast<int>(&settings - table));
+		
 		// Master enable
 		ImGui::PushStyleColor(ImGuiCol_Text, settings.enabled ? ImVec4(0.4f, 1.0f, 0.4f, 1.0f) : ImVec4(1.0f, 0.4f, 0.4f, 1.0f));
 		if (ImGui::Checkbox("Enable", &settings.enabled)) {
-			MarkSettingsChanged();
+			MarkSettingsChanged(section);
 		}
 		ImGui::PopStyleColor();
 		if (ImGui::IsItemHovered()) {
@@ -920,18 +966,18 @@ namespace Menu
 		// Per-action intensity multiplier (0-10x)
 		ImGui::SameLine();
 		ImGui::SetNextItemWidth(150.0f);
-		if (SliderFloatWithTooltip("Multiplier", &settings.multiplier, 0.0f, 10.0f, "%.1fx",
+		if (SliderFloatWithTooltip("Multiplier", &settings.Multiplier(), 0.0f, 10.0f, "%.1fx",
 			"Per-action intensity multiplier (0 = disabled, 10 = maximum)")) {
-			settings.multiplier = std::clamp(settings.multiplier, 0.0f, 10.0f);
-			MarkSettingsChanged();
+			settings.Multiplier() = std::clamp(settings.Multiplier(), 0.0f, 10.0f);
+			MarkSettingsChanged(section);
 		}
 		
 		ImGui::SameLine();
 		ImGui::SetNextItemWidth(100.0f);
-		if (SliderFloatWithTooltip("Blend", &settings.blendTime, 0.0f, 1.0f, "%.2fs",
+		if (SliderFloatWithTooltip("Blend", &settings.BlendTime(), 0.0f, 1.0f, "%.2fs",
 			"Time to blend impulse into spring (0 = instant, up to 1.0 sec)")) {
-			settings.blendTime = std::clamp(settings.blendTime, 0.0f, 1.0f);
-			MarkSettingsChanged();
+			settings.BlendTime() = std::clamp(settings.BlendTime(), 0.0f, 1.0f);
+			MarkSettingsChanged(section);
 		}
 		
 		if (!settings.enabled) {
@@ -942,24 +988,38 @@ namespace Menu
 		
 		// Spring parameters
 		if (ImGui::TreeNodeEx("Spring Parameters", ImGuiTreeNodeFlags_DefaultOpen)) {
-			if (SliderFloatWithTooltip("Stiffness", &settings.stiffness, 10.0f, 500.0f, "%.0f",
+			if (SliderFloatWithTooltip("Stiffness", &settings.Stiffness(), 10.0f, 500.0f, "%.0f",
 				"Spring stiffness (higher = faster return to center)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
-			if (SliderFloatWithTooltip("Damping", &settings.damping, 1.0f, 50.0f, "%.1f",
+			if (SliderFloatWithTooltip("Damping", &settings.Damping(), 1.0f, 50.0f, "%.1f",
 				"Damping (higher = less oscillation)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
-			if (SliderFloatWithTooltip("Position Strength", &settings.positionStrength, 0.0f, 30.0f, "%.1f",
+			if (SliderFloatWithTooltip("Position Strength", &settings.PositionStrength(), 0.0f, 30.0f, "%.1f",
 				"Maximum position offset strength")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
-			if (SliderFloatWithTooltip("Rotation Strength", &settings.rotationStrength, 0.0f, 20.0f, "%.1f deg",
+			if (SliderFloatWithTooltip("Rotation Strength", &settings.RotationStrength(), 0.0f, 20.0f, "%.1f deg",
 				"Maximum rotation offset strength (degrees)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
+			}
+			
+			// Combo index 0 = global default (-1)
+			const char* integratorNames[] = { "Global Default", "Euler (Sub-stepped)", "Closed-Form (Exact)", "Implicit Euler", "Velocity Verlet" };
+			int integratorIndex = settings.integrator + 1;
+			if (ImGui::Combo("Integrator", &integratorIndex, integratorNames, static_cast<int>(SpringIntegrator::kTotal) + 1)) {
+				settings.integrator = integratorIndex - 1;
+				MarkSettingsChanged(section);
+			}
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("Spring integrator for this action.\n\n"
+					"Implicit Euler or Closed-Form keep stiff springs stable at one step per frame,\n"
+					"so they do not need a high Spring Substeps value. Euler and Velocity Verlet\n"
+					"are sub-stepped (Spring Substeps / Auto Substeps).");
 			}
 			
 			ImGui::TreePop();
@@ -969,19 +1029,19 @@ namespace Menu
 		if (ImGui::TreeNodeEx("Position Impulse", ImGuiTreeNodeFlags_DefaultOpen)) {
 			ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Direction of initial camera movement");
 			
-			if (SliderFloatWithTooltip("X (Left/Right)", &settings.impulseX, -20.0f, 20.0f, "%.1f",
+			if (SliderFloatWithTooltip("X (Left/Right)", &settings.ImpulseX(), -20.0f, 20.0f, "%.1f",
 				"Horizontal impulse (-left, +right)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
-			if (SliderFloatWithTooltip("Y (Forward/Back)", &settings.impulseY, -20.0f, 20.0f, "%.1f",
+			if (SliderFloatWithTooltip("Y (Forward/Back)", &settings.ImpulseY(), -20.0f, 20.0f, "%.1f",
 				"Depth impulse (+forward, -back)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
-			if (SliderFloatWithTooltip("Z (Up/Down)", &settings.impulseZ, -20.0f, 20.0f, "%.1f",
+			if (SliderFloatWithTooltip("Z (Up/Down)", &settings.ImpulseZ(), -20.0f, 20.0f, "%.1f",
 				"Vertical impulse (+up, -down)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
 			ImGui::TreePop();
@@ -991,19 +1051,19 @@ namespace Menu
 		if (ImGui::TreeNodeEx("Rotation Impulse", ImGuiTreeNodeFlags_DefaultOpen)) {
 			ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "Direction of initial camera rotation");
 			
-			if (SliderFloatWithTooltip("Pitch (X)", &settings.rotImpulseX, -15.0f, 15.0f, "%.1f deg",
+			if (SliderFloatWithTooltip("Pitch (X)", &settings.RotImpulseX(), -15.0f, 15.0f, "%.1f deg",
 				"Pitch impulse (+look up, -look down)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
-			if (SliderFloatWithTooltip("Roll (Y)", &settings.rotImpulseY, -15.0f, 15.0f, "%.1f deg",
+			if (SliderFloatWithTooltip("Roll (Y)", &settings.RotImpulseY(), -15.0f, 15.0f, "%.1f deg",
 				"Roll impulse (+tilt right, -tilt left)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
-			if (SliderFloatWithTooltip("Yaw (Z)", &settings.rotImpulseZ, -15.0f, 15.0f, "%.1f deg",
+			if (SliderFloatWithTooltip("Yaw (Z)", &settings.RotImpulseZ(), -15.0f, 15.0f, "%.1f deg",
 				"Yaw impulse (+look left, -look right)")) {
-				MarkSettingsChanged();
+				MarkSettingsChanged(section);
 			}
 			
 			ImGui::TreePop();
@@ -1013,19 +1073,20 @@ namespace Menu
 		ImGui::Spacing();
 		if (ImGui::Button("Reset to Defaults")) {
 			settings.enabled = true;
-			settings.multiplier = 1.0f;
-			settings.blendTime = 0.1f;
-			settings.stiffness = 100.0f;
-			settings.damping = 8.0f;
-			settings.positionStrength = 5.0f;
-			settings.rotationStrength = 3.0f;
-			settings.impulseX = 0.0f;
-			settings.impulseY = 0.0f;
-			settings.impulseZ = 0.0f;
-			settings.rotImpulseX = 0.0f;
-			settings.rotImpulseY = 0.0f;
-			settings.rotImpulseZ = 0.0f;
-			MarkSettingsChanged();
+			settings.Multiplier() = 1.0f;
+			settings.BlendTime() = 0.1f;
+			settings.Stiffness() = 100.0f;
+			settings.Damping() = 8.0f;
+			settings.PositionStrength() = 5.0f;
+			settings.RotationStrength() = 3.0f;
+			settings.ImpulseX() = 0.0f;
+			settings.ImpulseY() = 0.0f;
+			settings.ImpulseZ() = 0.0f;
+			settings.RotImpulseX() = 0.0f;
+			settings.RotImpulseY() = 0.0f;
+			settings.RotImpulseZ() = 0.0f;
+			settings.integrator = -1;
+			MarkSettingsChanged(section);
 		}
 		if (ImGui::IsItemHovered()) {
 			ImGui::SetTooltip("Reset this action to default values");
@@ -1074,7 +1135,7 @@ namespace Menu
 			RE::DebugNotification("FP Camera Settle: Settings saved");
 		}
 		if (ImGui::IsItemHovered()) {
-			ImGui::SetTooltip("Save all settings to FPCameraSettle.ini");
+			ImGui::SetTooltip("Save the active profile's settings to FPCameraSettle.ini");
 		}
 		
 		ImGui::SameLine();
@@ -1094,7 +1155,7 @@ namespace Menu
 		// Reset All button
 		if (ImGui::Button("Reset All to Defaults")) {
 			settings->Load();  // This reloads from INI which has defaults
-			MarkSettingsChanged();
+			MarkSettingsChanged(Ini::kAllSections);
 			RE::DebugNotification("FP Camera Settle: Settings reset");
 		}
 		if (ImGui::IsItemHovered()) {
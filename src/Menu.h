@@ -5,6 +5,8 @@
 
 namespace Menu
 {
+	namespace Ini = SettleCore::SettingsIni;
+	
 	// Register with SKSE Menu Framework
 	void Register();
 	
@@ -35,7 +37,6 @@ namespace Menu
 	{
 		static inline bool initialized{ false };
 		static inline bool hasUnsavedChanges{ false };
-		static inline bool editMode{ false };  // When true, settings changes apply immediately
 		
 		// Expansion states
 		static inline bool generalExpanded{ true };
@@ -63,14 +64,11 @@ namespace Menu
 		static inline bool copyTargetIsDrawn{ true };
 	};
 	
-	// Mark settings as changed (invalidates caches and marks unsaved)
-	inline void MarkSettingsChanged()
+	// Mark settings as changed (publishes them live and marks unsaved); a_sections are the INI sections the edit touched
+	inline void MarkSettingsChanged(Ini::SectionMask a_sections)
 	{
 		State::hasUnsavedChanges = true;
-		// Only mark dirty for live updates if edit mode is enabled
-		if (State::editMode) {
-			Settings::GetSingleton()->MarkDirty();
-		}
+		Settings::GetSingleton()->MarkDirty(a_sections);
 	}
 }
 
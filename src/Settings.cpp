@@ -1,157 +1,186 @@
 #include "Settings.h"
+#include "Core/MappedFile.h"
+#include "Core/SettingsIni.h"
+#include "Core/SettleCore.h"
+
+#include <bit>
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <span>
+#include <utility>
 
 namespace
 {
 	constexpr auto INI_PATH = L"Data/SKSE/Plugins/FPCameraSettle.ini";
-	
-	// Action names for display and INI sections
-	const char* ActionNames[] = {
-		"WalkForward",
-		"WalkBackward",
-		"WalkLeft",
-		"WalkRight",
-		"RunForward",
-		"RunBackward",
-		"RunLeft",
-		"RunRight",
-		"SprintForward",
-		"SneakWalkForward",
-		"SneakWalkBackward",
-		"SneakWalkLeft",
-		"SneakWalkRight",
-		"SneakRunForward",
-		"SneakRunBackward",
-		"SneakRunLeft",
-		"SneakRunRight",
-		"Jump",
-		"Land",
-		"Sneak",
-		"UnSneak",
-		"TakingHit",
-		"Hitting",
-		"ArrowRelease"
+	constexpr auto CACHE_PATH = L"Data/SKSE/Plugins/FPCameraSettle.ini.cache";
+	
+	// Binary settings cache layout; bump CACHE_VERSION whenever SettingsData's fields change.
+	// New default values need no bump: the header carries a hash of the defaults.
+	constexpr std::uint32_t CACHE_MAGIC = 0x53435046;  // "FPCS"
+	constexpr std::uint32_t CACHE_VERSION = 6;  // 6: defaults hash
+	
+	// Followed by the default SettingsData, then per profile its name length, name and SettingsData
+	struct CacheHeader
+	{
+		std::uint32_t magic{ CACHE_MAGIC };
+		std::uint32_t version{ CACHE_VERSION };
+		std::uint32_t dataSize{ sizeof(SettingsData) };
+		std::uint32_t profileCount{ 0 };
+		std::uint64_t iniSize{ 0 };
+		std::int64_t iniTime{ 0 };  // INI last_write_time ticks
+		std::uint64_t defaultsHash{ 0 };  // Settings::DefaultsHash() of the build that wrote it
 	};
-}
-
-void ActionSettings::Load(CSimpleIniA& a_ini, const char* a_section)
-{
-	enabled = a_ini.GetBoolValue(a_section, "bEnabled", enabled);
-	multiplier = static_cast<float>(a_ini.GetDoubleValue(a_section, "fMultiplier", multiplier));
-	multiplier = std::clamp(multiplier, 0.0f, 10.0f);  // Clamp to valid range
-	blendTime = static_cast<float>(a_ini.GetDoubleValue(a_section, "fBlendTime", blendTime));
-	blendTime = std::clamp(blendTime, 0.0f, 1.0f);  // Clamp to valid range
-	stiffness = static_cast<float>(a_ini.GetDoubleValue(a_section, "fStiffness", stiffness));
-	damping = static_cast<float>(a_ini.GetDoubleValue(a_section, "fDamping", damping));
-	positionStrength = static_cast<float>(a_ini.GetDoubleValue(a_section, "fPositionStrength", positionStrength));
-	rotationStrength = static_cast<float>(a_ini.GetDoubleValue(a_section, "fRotationStrength", rotationStrength));
-	impulseX = static_cast<float>(a_ini.GetDoubleValue(a_section, "fImpulseX", impulseX));
-	impulseY = static_cast<float>(a_ini.GetDoubleValue(a_section, "fImpulseY", impulseY));
-	impulseZ = static_cast<float>(a_ini.GetDoubleValue(a_section, "fImpulseZ", impulseZ));
-	rotImpulseX = static_cast<float>(a_ini.GetDoubleValue(a_section, "fRotImpulseX", rotImpulseX));
-	rotImpulseY = static_cast<float>(a_ini.GetDoubleValue(a_section, "fRotImpulseY", rotImpulseY));
-	rotImpulseZ = static_cast<float>(a_ini.GetDoubleValue(a_section, "fRotImpulseZ", rotImpulseZ));
-}
-
-void ActionSettings::Save(CSimpleIniA& a_ini, const char* a_section) const
-{
-	a_ini.SetBoolValue(a_section, "bEnabled", enabled, "; Enable settle effect for this action");
-	a_ini.SetDoubleValue(a_section, "fMultiplier", multiplier, "; Per-action intensity multiplier (0.0 - 10.0)");
-	a_ini.SetDoubleValue(a_section, "fBlendTime", blendTime, "; Time to blend impulse into spring (0 = instant, up to 1.0 sec)");
-	a_ini.SetDoubleValue(a_section, "fStiffness", stiffness, "; Spring stiffness (higher = faster return)");
-	a_ini.SetDoubleValue(a_section, "fDamping", damping, "; Damping coefficient (higher = less oscillation)");
-	a_ini.SetDoubleValue(a_section, "fPositionStrength", positionStrength, "; Position offset strength");
-	a_ini.SetDoubleValue(a_section, "fRotationStrength", rotationStrength, "; Rotation offset strength (degrees)");
-	a_ini.SetDoubleValue(a_section, "fImpulseX", impulseX, "; Initial X impulse (left/right)");
-	a_ini.SetDoubleValue(a_section, "fImpulseY", impulseY, "; Initial Y impulse (forward/back)");
-	a_ini.SetDoubleValue(a_section, "fImpulseZ", impulseZ, "; Initial Z impulse (up/down)");
-	a_ini.SetDoubleValue(a_section, "fRotImpulseX", rotImpulseX, "; Pitch impulse (+look up, -look down)");
-	a_ini.SetDoubleValue(a_section, "fRotImpulseY", rotImpulseY, "; Roll impulse (+tilt right, -tilt left)");
-	a_ini.SetDoubleValue(a_section, "fRotImpulseZ", rotImpulseZ, "; Yaw impulse (+look left, -look right)");
-}
-
-void ActionSettings::CopyFrom(const ActionSettings& other)
-{
-	enabled = other.enabled;
-	multiplier = other.multiplier;
-	blendTime = other.blendTime;
-	stiffness = other.stiffness;
-	damping = other.damping;
-	positionStrength = other.positionStrength;
-	rotationStrength = other.rotationStrength;
-	impulseX = other.impulseX;
-	impulseY = other.impulseY;
-	impulseZ = other.impulseZ;
-	rotImpulseX = other.rotImpulseX;
-	rotImpulseY = other.rotImpulseY;
-	rotImpulseZ = other.rotImpulseZ;
-}
-
-ActionSettings ActionSettings::Blend(const ActionSettings& a, const ActionSettings& b, float t)
-{
-	t = std::clamp(t, 0.0f, 1.0f);
-	float invT = 1.0f - t;
-	
-	ActionSettings result;
-	// Use the enabled state of whichever has higher weight, or both if equal
-	result.enabled = t < 0.5f ? a.enabled : b.enabled;
-	result.multiplier = a.multiplier * invT + b.multiplier * t;
-	result.blendTime = a.blendTime * invT + b.blendTime * t;
-	result.stiffness = a.stiffness * invT + b.stiffness * t;
-	result.damping = a.damping * invT + b.damping * t;
-	result.positionStrength = a.positionStrength * invT + b.positionStrength * t;
-	result.rotationStrength = a.rotationStrength * invT + b.rotationStrength * t;
-	result.impulseX = a.impulseX * invT + b.impulseX * t;
-	result.impulseY = a.impulseY * invT + b.impulseY * t;
-	result.impulseZ = a.impulseZ * invT + b.impulseZ * t;
-	result.rotImpulseX = a.rotImpulseX * invT + b.rotImpulseX * t;
-	result.rotImpulseY = a.rotImpulseY * invT + b.rotImpulseY * t;
-	result.rotImpulseZ = a.rotImpulseZ * invT + b.rotImpulseZ * t;
-	return result;
+	
+	constexpr std::uint32_t MAX_PROFILE_NAME = 256;
+	
+	static_assert(std::is_trivially_copyable_v<SettingsData>, "SettingsData is cached with a raw copy");
+	
+	// === INI LAYOUT ===
+	// The key tables live in SettingsIni, shared with the loader. Each key is a byte
+	// offset into SettingsData (or ActionSettings), so Save() compares those bytes
+	// against what it last wrote to find the sections that need rewriting.
+	namespace Ini = SettleCore::SettingsIni;
+	using IniKey = Ini::Key;
+	using IniType = Ini::Type;
+	
+	// One dirty bit per INI section, in Ini's section order
+	constexpr int GLOBAL_GROUP_COUNT = Ini::kGlobalSectionCount;
+	constexpr int ACTION_COUNT = Ini::kActionCount;
+	constexpr int SECTION_COUNT = Ini::kSectionCount;
+	
+	std::string ActionSectionName(int a_state, int a_action)
+	{
+		return std::string(Ini::ActionName(static_cast<ActionType>(a_action))) + Ini::StateSuffix(a_state);
+	}
+	
+	void WriteKeys(CSimpleIniA& a_ini, const char* a_section, std::span<const IniKey> a_keys, const void* a_base)
+	{
+		const auto* base = static_cast<const std::uint8_t*>(a_base);
+		for (const auto& key : a_keys) {
+			switch (key.type) {
+			case IniType::kBool:
+				a_ini.SetBoolValue(a_section, key.name, *reinterpret_cast<const bool*>(base + key.offset), key.comment);
+				break;
+			case IniType::kInt:
+				a_ini.SetLongValue(a_section, key.name, *reinterpret_cast<const int*>(base + key.offset), key.comment);
+				break;
+			case IniType::kFloat:
+				a_ini.SetDoubleValue(a_section, key.name, *reinterpret_cast<const float*>(base + key.offset), key.comment);
+				break;
+			}
+		}
+	}
+	
+	// [AnimationEvents] has no fixed keys: every binding is a "<tag> = <action>" line
+	void WriteBindings(CSimpleIniA& a_ini, const char* a_section, const SettingsData& a_data)
+	{
+		// The section is created with its comment even while it holds no bindings, so it can be found
+		a_ini.SetValue(a_section, nullptr, nullptr, "; Extra animation event tags that trigger an action: <tag> = <action section without _Drawn/_Sheathed>");
+		for (const auto& binding : a_data.animEventBindings) {
+			if (binding.tag[0] != '\0') {
+				a_ini.SetValue(a_section, binding.tag, Ini::ActionName(binding.action));
+			}
+		}
+	}
+	
+	// a_profile empty writes the plain sections, otherwise that profile's [Profile.<name>.*] copies
+	void WriteSections(CSimpleIniA& a_ini, std::string_view a_profile, const SettingsData& a_data, Ini::SectionMask a_sections)
+	{
+		const auto globalGroups = Ini::GlobalGroups();
+		for (int group = 0; group < GLOBAL_GROUP_COUNT; ++group) {
+			if (a_sections & Ini::SectionBit(group)) {
+				WriteKeys(a_ini, Ini::ProfileSection(a_profile, globalGroups[group].section).c_str(), globalGroups[group].keys, &a_data);
+			}
+		}
+		if (a_sections & Ini::SectionBit(Ini::kAnimationEvents)) {
+			WriteBindings(a_ini, Ini::ProfileSection(a_profile, globalGroups[Ini::kAnimationEvents].section).c_str(), a_data);
+		}
+		// Drawn first, then sheathed, as the INI has always been laid out
+		for (int state : { static_cast<int>(SettingsData::kDrawn), static_cast<int>(SettingsData::kSheathed) }) {
+			for (int action = 0; action < ACTION_COUNT; ++action) {
+				if (a_sections & Ini::ActionSectionBit(state, action)) {
+					WriteKeys(a_ini, Ini::ProfileSection(a_profile, ActionSectionName(state, action)).c_str(), Ini::ActionKeys(), &a_data.actionSettings[state][action]);
+				}
+			}
+		}
+	}
+	
+	bool SameProfileName(std::string_view a_lhs, std::string_view a_rhs)
+	{
+		return std::ranges::equal(a_lhs, a_rhs, [](char a_l, char a_r) {
+			return std::tolower(static_cast<unsigned char>(a_l)) == std::tolower(static_cast<unsigned char>(a_r));
+		});
+	}
 }
 
 const char* Settings::GetActionName(ActionType a_type)
 {
-	int idx = static_cast<int>(a_type);
-	if (idx >= 0 && idx < static_cast<int>(ActionType::kTotal)) {
-		return ActionNames[idx];
-	}
-	return "Unknown";
+	return SettleCore::SettingsIni::ActionName(a_type);
 }
 
-void Settings::InitializeDefaults()
+void Settings::InitializeDefaults(SettingsData& a_data)
 {
+	// Defaults are authored on the drawn table, then copied to sheathed
+	auto drawn = [&](ActionType a_type) -> ActionSettings& { return a_data.actionSettings[kDrawn][static_cast<int>(a_type)]; };
+	auto& walkForwardDrawn = drawn(ActionType::WalkForward);
+	auto& walkBackwardDrawn = drawn(ActionType::WalkBackward);
+	auto& walkLeftDrawn = drawn(ActionType::WalkLeft);
+	auto& walkRightDrawn = drawn(ActionType::WalkRight);
+	auto& runForwardDrawn = drawn(ActionType::RunForward);
+	auto& runBackwardDrawn = drawn(ActionType::RunBackward);
+	auto& runLeftDrawn = drawn(ActionType::RunLeft);
+	auto& runRightDrawn = drawn(ActionType::RunRight);
+	auto& sprintForwardDrawn = drawn(ActionType::SprintForward);
+	auto& jumpDrawn = drawn(ActionType::Jump);
+	auto& landDrawn = drawn(ActionType::Land);
+	auto& sneakDrawn = drawn(ActionType::Sneak);
+	auto& unSneakDrawn = drawn(ActionType::UnSneak);
+	auto& takingHitDrawn = drawn(ActionType::TakingHit);
+	auto& hittingDrawn = drawn(ActionType::Hitting);
+	auto& arrowReleaseDrawn = drawn(ActionType::ArrowRelease);
+	auto& sneakWalkForwardDrawn = drawn(ActionType::SneakWalkForward);
+	auto& sneakWalkBackwardDrawn = drawn(ActionType::SneakWalkBackward);
+	auto& sneakWalkLeftDrawn = drawn(ActionType::SneakWalkLeft);
+	auto& sneakWalkRightDrawn = drawn(ActionType::SneakWalkRight);
+	auto& sneakRunForwardDrawn = drawn(ActionType::SneakRunForward);
+	auto& sneakRunBackwardDrawn = drawn(ActionType::SneakRunBackward);
+	auto& sneakRunLeftDrawn = drawn(ActionType::SneakRunLeft);
+	auto& sneakRunRightDrawn = drawn(ActionType::SneakRunRight);
+	
 	// Walk actions - subtle camera sway
 	auto initWalk = [](ActionSettings& s, float xDir, float yDir) {
 		s.enabled = true;
-		s.multiplier = 1.0f;
-		s.blendTime = 0.1f;  // Smooth blend in
-		s.stiffness = 80.0f;
-		s.damping = 6.0f;
-		s.positionStrength = 2.0f;
-		s.rotationStrength = 1.5f;
-		s.impulseX = xDir * 3.0f;
-		s.impulseY = yDir * 2.0f;
-		s.impulseZ = 0.5f;
-		s.rotImpulseX = yDir * 0.5f;  // Subtle pitch when moving forward/back
-		s.rotImpulseY = xDir * 0.3f;  // Subtle yaw when strafing
-		s.rotImpulseZ = xDir * 0.8f;  // Roll when strafing
+		s.Multiplier() = 1.0f;
+		s.BlendTime() = 0.1f;  // Smooth blend in
+		s.Stiffness() = 80.0f;
+		s.Damping() = 6.0f;
+		s.PositionStrength() = 2.0f;
+		s.RotationStrength() = 1.5f;
+		s.ImpulseX() = xDir * 3.0f;
+		s.ImpulseY() = yDir * 2.0f;
+		s.ImpulseZ() = 0.5f;
+		s.RotImpulseX() = yDir * 0.5f;  // Subtle pitch when moving forward/back
+		s.RotImpulseY() = xDir * 0.3f;  // Subtle yaw when strafing
+		s.RotImpulseZ() = xDir * 0.8f;  // Roll when strafing
 	};
 	
 	// Run actions - more pronounced
 	auto initRun = [](ActionSettings& s, float xDir, float yDir) {
 		s.enabled = true;
-		s.multiplier = 1.0f;
-		s.blendTime = 0.08f;  // Slightly faster blend for running
-		s.stiffness = 100.0f;
-		s.damping = 7.0f;
-		s.positionStrength = 4.0f;
-		s.rotationStrength = 2.5f;
-		s.impulseX = xDir * 5.0f;
-		s.impulseY = yDir * 3.0f;
-		s.impulseZ = 1.0f;
-		s.rotImpulseX = yDir * 1.0f;
-		s.rotImpulseY = xDir * 0.5f;
-		s.rotImpulseZ = xDir * 1.5f;
+		s.Multiplier() = 1.0f;
+		s.BlendTime() = 0.08f;  // Slightly faster blend for running
+		s.Stiffness() = 100.0f;
+		s.Damping() = 7.0f;
+		s.PositionStrength() = 4.0f;
+		s.RotationStrength() = 2.5f;
+		s.ImpulseX() = xDir * 5.0f;
+		s.ImpulseY() = yDir * 3.0f;
+		s.ImpulseZ() = 1.0f;
+		s.RotImpulseX() = yDir * 1.0f;
+		s.RotImpulseY() = xDir * 0.5f;
+		s.RotImpulseZ() = xDir * 1.5f;
 	};
 	
 	// Initialize walk settings (drawn)
@@ -168,142 +197,142 @@ void Settings::InitializeDefaults()
 	
 	// Sprint - strong forward momentum settle
 	sprintForwardDrawn.enabled = true;
-	sprintForwardDrawn.stiffness = 60.0f;
-	sprintForwardDrawn.damping = 5.0f;
-	sprintForwardDrawn.positionStrength = 8.0f;
-	sprintForwardDrawn.rotationStrength = 4.0f;
-	sprintForwardDrawn.impulseX = 0.0f;
-	sprintForwardDrawn.impulseY = 10.0f;
-	sprintForwardDrawn.impulseZ = -3.0f;
-	sprintForwardDrawn.rotImpulseX = 3.0f;  // Forward tilt
-	sprintForwardDrawn.rotImpulseY = 0.0f;
-	sprintForwardDrawn.rotImpulseZ = 0.0f;
+	sprintForwardDrawn.Stiffness() = 60.0f;
+	sprintForwardDrawn.Damping() = 5.0f;
+	sprintForwardDrawn.PositionStrength() = 8.0f;
+	sprintForwardDrawn.RotationStrength() = 4.0f;
+	sprintForwardDrawn.ImpulseX() = 0.0f;
+	sprintForwardDrawn.ImpulseY() = 10.0f;
+	sprintForwardDrawn.ImpulseZ() = -3.0f;
+	sprintForwardDrawn.RotImpulseX() = 3.0f;  // Forward tilt
+	sprintForwardDrawn.RotImpulseY() = 0.0f;
+	sprintForwardDrawn.RotImpulseZ() = 0.0f;
 	
 	// Jump - upward momentum, then settle
 	jumpDrawn.enabled = true;
-	jumpDrawn.stiffness = 40.0f;
-	jumpDrawn.damping = 3.0f;
-	jumpDrawn.positionStrength = 6.0f;
-	jumpDrawn.rotationStrength = 3.0f;
-	jumpDrawn.impulseX = 0.0f;
-	jumpDrawn.impulseY = 4.0f;
-	jumpDrawn.impulseZ = 8.0f;
-	jumpDrawn.rotImpulseX = -2.0f;  // Look up slightly
-	jumpDrawn.rotImpulseY = 0.0f;
-	jumpDrawn.rotImpulseZ = 0.0f;
+	jumpDrawn.Stiffness() = 40.0f;
+	jumpDrawn.Damping() = 3.0f;
+	jumpDrawn.PositionStrength() = 6.0f;
+	jumpDrawn.RotationStrength() = 3.0f;
+	jumpDrawn.ImpulseX() = 0.0f;
+	jumpDrawn.ImpulseY() = 4.0f;
+	jumpDrawn.ImpulseZ() = 8.0f;
+	jumpDrawn.RotImpulseX() = -2.0f;  // Look up slightly
+	jumpDrawn.RotImpulseY() = 0.0f;
+	jumpDrawn.RotImpulseZ() = 0.0f;
 	
 	// Land - downward compression, then settle
 	landDrawn.enabled = true;
-	landDrawn.stiffness = 120.0f;
-	landDrawn.damping = 10.0f;
-	landDrawn.positionStrength = 10.0f;
-	landDrawn.rotationStrength = 5.0f;
-	landDrawn.impulseX = 0.0f;
-	landDrawn.impulseY = 2.0f;
-	landDrawn.impulseZ = -12.0f;
-	landDrawn.rotImpulseX = 4.0f;  // Downward nod
-	landDrawn.rotImpulseY = 0.0f;
-	landDrawn.rotImpulseZ = 0.0f;
+	landDrawn.Stiffness() = 120.0f;
+	landDrawn.Damping() = 10.0f;
+	landDrawn.PositionStrength() = 10.0f;
+	landDrawn.RotationStrength() = 5.0f;
+	landDrawn.ImpulseX() = 0.0f;
+	landDrawn.ImpulseY() = 2.0f;
+	landDrawn.ImpulseZ() = -12.0f;
+	landDrawn.RotImpulseX() = 4.0f;  // Downward nod
+	landDrawn.RotImpulseY() = 0.0f;
+	landDrawn.RotImpulseZ() = 0.0f;
 	
 	// Sneak - slow settle down
 	sneakDrawn.enabled = true;
-	sneakDrawn.stiffness = 50.0f;
-	sneakDrawn.damping = 8.0f;
-	sneakDrawn.positionStrength = 4.0f;
-	sneakDrawn.rotationStrength = 2.0f;
-	sneakDrawn.impulseX = 0.0f;
-	sneakDrawn.impulseY = 1.0f;
-	sneakDrawn.impulseZ = -5.0f;
-	sneakDrawn.rotImpulseX = 2.0f;
-	sneakDrawn.rotImpulseY = 0.0f;
-	sneakDrawn.rotImpulseZ = 0.0f;
+	sneakDrawn.Stiffness() = 50.0f;
+	sneakDrawn.Damping() = 8.0f;
+	sneakDrawn.PositionStrength() = 4.0f;
+	sneakDrawn.RotationStrength() = 2.0f;
+	sneakDrawn.ImpulseX() = 0.0f;
+	sneakDrawn.ImpulseY() = 1.0f;
+	sneakDrawn.ImpulseZ() = -5.0f;
+	sneakDrawn.RotImpulseX() = 2.0f;
+	sneakDrawn.RotImpulseY() = 0.0f;
+	sneakDrawn.RotImpulseZ() = 0.0f;
 	
 	// Un-Sneak - rise up
 	unSneakDrawn.enabled = true;
-	unSneakDrawn.stiffness = 60.0f;
-	unSneakDrawn.damping = 7.0f;
-	unSneakDrawn.positionStrength = 4.0f;
-	unSneakDrawn.rotationStrength = 2.0f;
-	unSneakDrawn.impulseX = 0.0f;
-	unSneakDrawn.impulseY = -1.0f;
-	unSneakDrawn.impulseZ = 4.0f;
-	unSneakDrawn.rotImpulseX = -1.5f;
-	unSneakDrawn.rotImpulseY = 0.0f;
-	unSneakDrawn.rotImpulseZ = 0.0f;
+	unSneakDrawn.Stiffness() = 60.0f;
+	unSneakDrawn.Damping() = 7.0f;
+	unSneakDrawn.PositionStrength() = 4.0f;
+	unSneakDrawn.RotationStrength() = 2.0f;
+	unSneakDrawn.ImpulseX() = 0.0f;
+	unSneakDrawn.ImpulseY() = -1.0f;
+	unSneakDrawn.ImpulseZ() = 4.0f;
+	unSneakDrawn.RotImpulseX() = -1.5f;
+	unSneakDrawn.RotImpulseY() = 0.0f;
+	unSneakDrawn.RotImpulseZ() = 0.0f;
 	
 	// Taking hit - violent shake
 	takingHitDrawn.enabled = true;
-	takingHitDrawn.stiffness = 150.0f;
-	takingHitDrawn.damping = 12.0f;
-	takingHitDrawn.positionStrength = 12.0f;
-	takingHitDrawn.rotationStrength = 8.0f;
-	takingHitDrawn.impulseX = 0.0f;  // Direction will be set based on hit
-	takingHitDrawn.impulseY = -5.0f;
-	takingHitDrawn.impulseZ = -3.0f;
-	takingHitDrawn.rotImpulseX = 5.0f;
-	takingHitDrawn.rotImpulseY = 0.0f;
-	takingHitDrawn.rotImpulseZ = 3.0f;
+	takingHitDrawn.Stiffness() = 150.0f;
+	takingHitDrawn.Damping() = 12.0f;
+	takingHitDrawn.PositionStrength() = 12.0f;
+	takingHitDrawn.RotationStrength() = 8.0f;
+	takingHitDrawn.ImpulseX() = 0.0f;  // Direction will be set based on hit
+	takingHitDrawn.ImpulseY() = -5.0f;
+	takingHitDrawn.ImpulseZ() = -3.0f;
+	takingHitDrawn.RotImpulseX() = 5.0f;
+	takingHitDrawn.RotImpulseY() = 0.0f;
+	takingHitDrawn.RotImpulseZ() = 3.0f;
 	
 	// Hitting something - recoil
 	hittingDrawn.enabled = true;
-	hittingDrawn.stiffness = 180.0f;
-	hittingDrawn.damping = 14.0f;
-	hittingDrawn.positionStrength = 6.0f;
-	hittingDrawn.rotationStrength = 4.0f;
-	hittingDrawn.impulseX = 0.0f;
-	hittingDrawn.impulseY = -4.0f;
-	hittingDrawn.impulseZ = 2.0f;
-	hittingDrawn.rotImpulseX = -2.0f;
-	hittingDrawn.rotImpulseY = 0.0f;
-	hittingDrawn.rotImpulseZ = 0.0f;
+	hittingDrawn.Stiffness() = 180.0f;
+	hittingDrawn.Damping() = 14.0f;
+	hittingDrawn.PositionStrength() = 6.0f;
+	hittingDrawn.RotationStrength() = 4.0f;
+	hittingDrawn.ImpulseX() = 0.0f;
+	hittingDrawn.ImpulseY() = -4.0f;
+	hittingDrawn.ImpulseZ() = 2.0f;
+	hittingDrawn.RotImpulseX() = -2.0f;
+	hittingDrawn.RotImpulseY() = 0.0f;
+	hittingDrawn.RotImpulseZ() = 0.0f;
 	
 	// Arrow release - bow/crossbow shot recoil
 	arrowReleaseDrawn.enabled = true;
-	arrowReleaseDrawn.multiplier = 1.0f;
-	arrowReleaseDrawn.blendTime = 0.0f;  // Instant for snappy bow feel
-	arrowReleaseDrawn.stiffness = 150.0f;
-	arrowReleaseDrawn.damping = 10.0f;
-	arrowReleaseDrawn.positionStrength = 5.0f;
-	arrowReleaseDrawn.rotationStrength = 4.0f;
-	arrowReleaseDrawn.impulseX = 0.0f;
-	arrowReleaseDrawn.impulseY = -3.0f;   // Slight backward push
-	arrowReleaseDrawn.impulseZ = 2.0f;    // Slight upward kick
-	arrowReleaseDrawn.rotImpulseX = -3.0f; // Pitch up from recoil
-	arrowReleaseDrawn.rotImpulseY = 0.0f;
-	arrowReleaseDrawn.rotImpulseZ = 0.0f;
+	arrowReleaseDrawn.Multiplier() = 1.0f;
+	arrowReleaseDrawn.BlendTime() = 0.0f;  // Instant for snappy bow feel
+	arrowReleaseDrawn.Stiffness() = 150.0f;
+	arrowReleaseDrawn.Damping() = 10.0f;
+	arrowReleaseDrawn.PositionStrength() = 5.0f;
+	arrowReleaseDrawn.RotationStrength() = 4.0f;
+	arrowReleaseDrawn.ImpulseX() = 0.0f;
+	arrowReleaseDrawn.ImpulseY() = -3.0f;   // Slight backward push
+	arrowReleaseDrawn.ImpulseZ() = 2.0f;    // Slight upward kick
+	arrowReleaseDrawn.RotImpulseX() = -3.0f; // Pitch up from recoil
+	arrowReleaseDrawn.RotImpulseY() = 0.0f;
+	arrowReleaseDrawn.RotImpulseZ() = 0.0f;
 	
 	// Sneak walk actions - even more subtle than normal walk
 	auto initSneakWalk = [](ActionSettings& s, float xDir, float yDir) {
 		s.enabled = true;
-		s.multiplier = 1.0f;
-		s.blendTime = 0.15f;  // Slower blend for stealth
-		s.stiffness = 60.0f;
-		s.damping = 7.0f;
-		s.positionStrength = 1.5f;
-		s.rotationStrength = 1.0f;
-		s.impulseX = xDir * 2.0f;
-		s.impulseY = yDir * 1.5f;
-		s.impulseZ = 0.3f;
-		s.rotImpulseX = yDir * 0.3f;
-		s.rotImpulseY = xDir * 0.2f;
-		s.rotImpulseZ = xDir * 0.5f;
+		s.Multiplier() = 1.0f;
+		s.BlendTime() = 0.15f;  // Slower blend for stealth
+		s.Stiffness() = 60.0f;
+		s.Damping() = 7.0f;
+		s.PositionStrength() = 1.5f;
+		s.RotationStrength() = 1.0f;
+		s.ImpulseX() = xDir * 2.0f;
+		s.ImpulseY() = yDir * 1.5f;
+		s.ImpulseZ() = 0.3f;
+		s.RotImpulseX() = yDir * 0.3f;
+		s.RotImpulseY() = xDir * 0.2f;
+		s.RotImpulseZ() = xDir * 0.5f;
 	};
 	
 	// Sneak run actions - between walk and normal run
 	auto initSneakRun = [](ActionSettings& s, float xDir, float yDir) {
 		s.enabled = true;
-		s.multiplier = 1.0f;
-		s.blendTime = 0.1f;
-		s.stiffness = 70.0f;
-		s.damping = 6.5f;
-		s.positionStrength = 2.5f;
-		s.rotationStrength = 1.8f;
-		s.impulseX = xDir * 3.5f;
-		s.impulseY = yDir * 2.5f;
-		s.impulseZ = 0.7f;
-		s.rotImpulseX = yDir * 0.7f;
-		s.rotImpulseY = xDir * 0.4f;
-		s.rotImpulseZ = xDir * 1.0f;
+		s.Multiplier() = 1.0f;
+		s.BlendTime() = 0.1f;
+		s.Stiffness() = 70.0f;
+		s.Damping() = 6.5f;
+		s.PositionStrength() = 2.5f;
+		s.RotationStrength() = 1.8f;
+		s.ImpulseX() = xDir * 3.5f;
+		s.ImpulseY() = yDir * 2.5f;
+		s.ImpulseZ() = 0.7f;
+		s.RotImpulseX() = yDir * 0.7f;
+		s.RotImpulseY() = xDir * 0.4f;
+		s.RotImpulseZ() = xDir * 1.0f;
 	};
 	
 	// Initialize sneak walk settings (drawn)
@@ -319,440 +348,559 @@ void Settings::InitializeDefaults()
 	initSneakRun(sneakRunRightDrawn, 1.0f, 0.0f);
 	
 	// Initialize sheathed versions (same as drawn but will be scaled by weaponSheathedMult)
-	walkForwardSheathed = walkForwardDrawn;
-	walkBackwardSheathed = walkBackwardDrawn;
-	walkLeftSheathed = walkLeftDrawn;
-	walkRightSheathed = walkRightDrawn;
-	runForwardSheathed = runForwardDrawn;
-	runBackwardSheathed = runBackwardDrawn;
-	runLeftSheathed = runLeftDrawn;
-	runRightSheathed = runRightDrawn;
-	sprintForwardSheathed = sprintForwardDrawn;
-	sneakWalkForwardSheathed = sneakWalkForwardDrawn;
-	sneakWalkBackwardSheathed = sneakWalkBackwardDrawn;
-	sneakWalkLeftSheathed = sneakWalkLeftDrawn;
-	sneakWalkRightSheathed = sneakWalkRightDrawn;
-	sneakRunForwardSheathed = sneakRunForwardDrawn;
-	sneakRunBackwardSheathed = sneakRunBackwardDrawn;
-	sneakRunLeftSheathed = sneakRunLeftDrawn;
-	sneakRunRightSheathed = sneakRunRightDrawn;
-	jumpSheathed = jumpDrawn;
-	landSheathed = landDrawn;
-	sneakSheathed = sneakDrawn;
-	unSneakSheathed = unSneakDrawn;
-	takingHitSheathed = takingHitDrawn;
-	hittingSheathed = hittingDrawn;
-	arrowReleaseSheathed = arrowReleaseDrawn;
+	std::copy(std::begin(a_data.actionSettings[kDrawn]), std::end(a_data.actionSettings[kDrawn]), std::begin(a_data.actionSettings[kSheathed]));
+}
+
+void Settings::ParseIniText(std::string_view a_text, IniContents& a_ini)
+{
+	a_ini.defaults = SettingsData{};
+	InitializeDefaults(a_ini.defaults);
+	Ini::Parse(a_text, a_ini.defaults);
+	a_ini.profiles = Ini::ParseProfiles(a_text, a_ini.defaults);
+	
+	// The plain sections already are the default profile
+	std::erase_if(a_ini.profiles, [](const Ini::Profile& a_profile) {
+		if (SameProfileName(a_profile.name, kDefaultProfile)) {
+			logger::warn("[FPCameraSettle] Ignoring [Profile.{}.*] sections; the plain sections are the default profile", a_profile.name);
+			return true;
+		}
+		return false;
+	});
+}
+
+bool Settings::ReadIni(IniContents& a_ini)
+{
+	// Parsed straight out of the mapping; see SettleCore::SettingsIni
+	SettleCore::MappedFile file;
+	if (!file.Open(std::filesystem::path(INI_PATH))) {
+		ParseIniText({}, a_ini);
+		return false;
+	}
+	ParseIniText(file.View(), a_ini);
+	return true;
 }
 
 void Settings::Load()
 {
-	// Initialize with sensible defaults first
-	InitializeDefaults();
-	
-	CSimpleIniA ini;
-	ini.SetUnicode();
+	// Unchanged INI: take the binary snapshot written after the last parse or save
+	auto ini = std::make_unique<IniContents>();
+	IniStamp stamp;
+	const bool stamped = GetIniStamp(std::filesystem::path(INI_PATH), stamp);
+	if (stamped && LoadCache(stamp, *ini)) {
+		InstallIni(*ini);
+		logger::info("[FPCameraSettle] Settings loaded from cache ({} profiles)", ini->profiles.size() + 1);
+		return;
+	}
 	
-	SI_Error rc = ini.LoadFile(INI_PATH);
-	if (rc < 0) {
+	if (!ReadIni(*ini)) {
 		logger::info("[FPCameraSettle] No INI file found, creating with defaults");
+		InstallIni(*ini);
 		Save();
 		return;
 	}
 	
-	// Load general settings
-	enabled = ini.GetBoolValue("General", "bEnabled", enabled);
-	globalIntensity = static_cast<float>(ini.GetDoubleValue("General", "fGlobalIntensity", globalIntensity));
-	smoothingFactor = static_cast<float>(ini.GetDoubleValue("General", "fSmoothingFactor", smoothingFactor));
-	resetOnPause = ini.GetBoolValue("General", "bResetOnPause", resetOnPause);
-	springSubsteps = static_cast<int>(ini.GetLongValue("General", "iSpringSubsteps", springSubsteps));
-	springSubsteps = std::clamp(springSubsteps, 1, 8);
-	
-	// Load walk/run blending settings
-	speedBasedBlending = ini.GetBoolValue("Movement", "bSpeedBasedBlending", speedBasedBlending);
-	walkToRunGracePeriod = static_cast<float>(ini.GetDoubleValue("Movement", "fWalkToRunGracePeriod", walkToRunGracePeriod));
-	
-	// Load jump/land scaling settings
-	scaleJumpByAirTime = ini.GetBoolValue("Jump", "bScaleByAirTime", scaleJumpByAirTime);
-	jumpMinAirTime = static_cast<float>(ini.GetDoubleValue("Jump", "fMinAirTime", jumpMinAirTime));
-	jumpMaxAirTimeScale = static_cast<float>(ini.GetDoubleValue("Jump", "fMaxAirTimeScale", jumpMaxAirTimeScale));
-	landBaseScale = static_cast<float>(ini.GetDoubleValue("Jump", "fLandBaseScale", landBaseScale));
-	landAirTimeScale = static_cast<float>(ini.GetDoubleValue("Jump", "fLandAirTimeScale", landAirTimeScale));
-	
-	// Load weapon state settings
-	weaponDrawnEnabled = ini.GetBoolValue("WeaponState", "bWeaponDrawnEnabled", weaponDrawnEnabled);
-	weaponSheathedEnabled = ini.GetBoolValue("WeaponState", "bWeaponSheathedEnabled", weaponSheathedEnabled);
-	weaponDrawnMult = static_cast<float>(ini.GetDoubleValue("WeaponState", "fWeaponDrawnMult", weaponDrawnMult));
-	weaponSheathedMult = static_cast<float>(ini.GetDoubleValue("WeaponState", "fWeaponSheathedMult", weaponSheathedMult));
-	
-	// Load settling behavior
-	settleDelay = static_cast<float>(ini.GetDoubleValue("Settling", "fSettleDelay", settleDelay));
-	settleSpeed = static_cast<float>(ini.GetDoubleValue("Settling", "fSettleSpeed", settleSpeed));
-	settleDampingMult = static_cast<float>(ini.GetDoubleValue("Settling", "fSettleDampingMult", settleDampingMult));
-	
-	// Load idle noise settings (weapon drawn)
-	idleNoiseEnabledDrawn = ini.GetBoolValue("IdleNoise_Drawn", "bEnabled", idleNoiseEnabledDrawn);
-	idleNoisePosAmpXDrawn = static_cast<float>(ini.GetDoubleValue("IdleNoise_Drawn", "fPosAmpX", idleNoisePosAmpXDrawn));
-	idleNoisePosAmpYDrawn = static_cast<float>(ini.GetDoubleValue("IdleNoise_Drawn", "fPosAmpY", idleNoisePosAmpYDrawn));
-	idleNoisePosAmpZDrawn = static_cast<float>(ini.GetDoubleValue("IdleNoise_Drawn", "fPosAmpZ", idleNoisePosAmpZDrawn));
-	idleNoiseRotAmpXDrawn = static_cast<float>(ini.GetDoubleValue("IdleNoise_Drawn", "fRotAmpX", idleNoiseRotAmpXDrawn));
-	idleNoiseRotAmpYDrawn = static_cast<float>(ini.GetDoubleValue("IdleNoise_Drawn", "fRotAmpY", idleNoiseRotAmpYDrawn));
-	idleNoiseRotAmpZDrawn = static_cast<float>(ini.GetDoubleValue("IdleNoise_Drawn", "fRotAmpZ", idleNoiseRotAmpZDrawn));
-	idleNoiseFrequencyDrawn = static_cast<float>(ini.GetDoubleValue("IdleNoise_Drawn", "fFrequency", idleNoiseFrequencyDrawn));
-	
-	// Load idle noise settings (weapon sheathed)
-	idleNoiseEnabledSheathed = ini.GetBoolValue("IdleNoise_Sheathed", "bEnabled", idleNoiseEnabledSheathed);
-	idleNoisePosAmpXSheathed = static_cast<float>(ini.GetDoubleValue("IdleNoise_Sheathed", "fPosAmpX", idleNoisePosAmpXSheathed));
-	idleNoisePosAmpYSheathed = static_cast<float>(ini.GetDoubleValue("IdleNoise_Sheathed", "fPosAmpY", idleNoisePosAmpYSheathed));
-	idleNoisePosAmpZSheathed = static_cast<float>(ini.GetDoubleValue("IdleNoise_Sheathed", "fPosAmpZ", idleNoisePosAmpZSheathed));
-	idleNoiseRotAmpXSheathed = static_cast<float>(ini.GetDoubleValue("IdleNoise_Sheathed", "fRotAmpX", idleNoiseRotAmpXSheathed));
-	idleNoiseRotAmpYSheathed = static_cast<float>(ini.GetDoubleValue("IdleNoise_Sheathed", "fRotAmpY", idleNoiseRotAmpYSheathed));
-	idleNoiseRotAmpZSheathed = static_cast<float>(ini.GetDoubleValue("IdleNoise_Sheathed", "fRotAmpZ", idleNoiseRotAmpZSheathed));
-	idleNoiseFrequencySheathed = static_cast<float>(ini.GetDoubleValue("IdleNoise_Sheathed", "fFrequency", idleNoiseFrequencySheathed));
-	
-	// Load shared idle noise settings
-	idleNoiseBlendTime = static_cast<float>(ini.GetDoubleValue("IdleNoise", "fBlendTime", idleNoiseBlendTime));
-	dialogueDisableIdleNoise = ini.GetBoolValue("IdleNoise", "bDialogueDisableIdleNoise", dialogueDisableIdleNoise);
-	idleNoiseScaleDuringArchery = ini.GetBoolValue("IdleNoise", "bScaleDuringArchery", idleNoiseScaleDuringArchery);
-	idleNoiseArcheryScaleAmount = static_cast<float>(ini.GetDoubleValue("IdleNoise", "fArcheryScaleAmount", idleNoiseArcheryScaleAmount));
-	idleNoiseArcheryScaleBySkill = ini.GetBoolValue("IdleNoise", "bArcheryScaleBySkill", idleNoiseArcheryScaleBySkill);
-	idleNoiseArcheryScaleAmount = std::clamp(idleNoiseArcheryScaleAmount, 0.0f, 1.0f);
-	
-	// Load sprint effects settings
-	sprintFovEnabled = ini.GetBoolValue("SprintEffects", "bFovEnabled", sprintFovEnabled);
-	sprintFovDelta = static_cast<float>(ini.GetDoubleValue("SprintEffects", "fFovDelta", sprintFovDelta));
-	sprintFovBlendSpeed = static_cast<float>(ini.GetDoubleValue("SprintEffects", "fFovBlendSpeed", sprintFovBlendSpeed));
-	sprintBlurEnabled = ini.GetBoolValue("SprintEffects", "bBlurEnabled", sprintBlurEnabled);
-	sprintBlurStrength = static_cast<float>(ini.GetDoubleValue("SprintEffects", "fBlurStrength", sprintBlurStrength));
-	sprintBlurBlendSpeed = static_cast<float>(ini.GetDoubleValue("SprintEffects", "fBlurBlendSpeed", sprintBlurBlendSpeed));
-	sprintBlurRampUp = static_cast<float>(ini.GetDoubleValue("SprintEffects", "fBlurRampUp", sprintBlurRampUp));
-	sprintBlurRampDown = static_cast<float>(ini.GetDoubleValue("SprintEffects", "fBlurRampDown", sprintBlurRampDown));
-	sprintBlurRadius = static_cast<float>(ini.GetDoubleValue("SprintEffects", "fBlurRadius", sprintBlurRadius));
-
-	// Load FOV punch settings
-	fovPunchHitEnabled = ini.GetBoolValue("FOVPunch", "bHitEnabled", fovPunchHitEnabled);
-	fovPunchArrowEnabled = ini.GetBoolValue("FOVPunch", "bArrowEnabled", fovPunchArrowEnabled);
-	fovPunchHitStrength = static_cast<float>(ini.GetDoubleValue("FOVPunch", "fHitStrength", fovPunchHitStrength));
-	fovPunchArrowStrength = static_cast<float>(ini.GetDoubleValue("FOVPunch", "fArrowStrength", fovPunchArrowStrength));
-	fovPunchDuration = static_cast<float>(ini.GetDoubleValue("FOVPunch", "fDuration", fovPunchDuration));
-	fovPunchHitStrength = std::clamp(fovPunchHitStrength, 0.0f, 20.0f);
-	fovPunchArrowStrength = std::clamp(fovPunchArrowStrength, 0.0f, 20.0f);
-	fovPunchDuration = std::clamp(fovPunchDuration, 0.05f, 1.0f);
-	
-	// Load debug settings
-	debugLogging = ini.GetBoolValue("Debug", "bDebugLogging", debugLogging);
-	debugOnScreen = ini.GetBoolValue("Debug", "bDebugOnScreen", debugOnScreen);
-	enableHotReload = ini.GetBoolValue("Debug", "bEnableHotReload", enableHotReload);
-	hotReloadIntervalSec = static_cast<float>(ini.GetDoubleValue("Debug", "fHotReloadInterval", hotReloadIntervalSec));
-	
-	// Load per-action settings (weapon drawn)
-	walkForwardDrawn.Load(ini, "WalkForward_Drawn");
-	walkBackwardDrawn.Load(ini, "WalkBackward_Drawn");
-	walkLeftDrawn.Load(ini, "WalkLeft_Drawn");
-	walkRightDrawn.Load(ini, "WalkRight_Drawn");
-	runForwardDrawn.Load(ini, "RunForward_Drawn");
-	runBackwardDrawn.Load(ini, "RunBackward_Drawn");
-	runLeftDrawn.Load(ini, "RunLeft_Drawn");
-	runRightDrawn.Load(ini, "RunRight_Drawn");
-	sprintForwardDrawn.Load(ini, "SprintForward_Drawn");
-	jumpDrawn.Load(ini, "Jump_Drawn");
-	landDrawn.Load(ini, "Land_Drawn");
-	sneakDrawn.Load(ini, "Sneak_Drawn");
-	unSneakDrawn.Load(ini, "UnSneak_Drawn");
-	takingHitDrawn.Load(ini, "TakingHit_Drawn");
-	hittingDrawn.Load(ini, "Hitting_Drawn");
-	arrowReleaseDrawn.Load(ini, "ArrowRelease_Drawn");
-	sneakWalkForwardDrawn.Load(ini, "SneakWalkForward_Drawn");
-	sneakWalkBackwardDrawn.Load(ini, "SneakWalkBackward_Drawn");
-	sneakWalkLeftDrawn.Load(ini, "SneakWalkLeft_Drawn");
-	sneakWalkRightDrawn.Load(ini, "SneakWalkRight_Drawn");
-	sneakRunForwardDrawn.Load(ini, "SneakRunForward_Drawn");
-	sneakRunBackwardDrawn.Load(ini, "SneakRunBackward_Drawn");
-	sneakRunLeftDrawn.Load(ini, "SneakRunLeft_Drawn");
-	sneakRunRightDrawn.Load(ini, "SneakRunRight_Drawn");
-	
-	// Load per-action settings (weapon sheathed)
-	walkForwardSheathed.Load(ini, "WalkForward_Sheathed");
-	walkBackwardSheathed.Load(ini, "WalkBackward_Sheathed");
-	walkLeftSheathed.Load(ini, "WalkLeft_Sheathed");
-	walkRightSheathed.Load(ini, "WalkRight_Sheathed");
-	runForwardSheathed.Load(ini, "RunForward_Sheathed");
-	runBackwardSheathed.Load(ini, "RunBackward_Sheathed");
-	runLeftSheathed.Load(ini, "RunLeft_Sheathed");
-	runRightSheathed.Load(ini, "RunRight_Sheathed");
-	sprintForwardSheathed.Load(ini, "SprintForward_Sheathed");
-	jumpSheathed.Load(ini, "Jump_Sheathed");
-	landSheathed.Load(ini, "Land_Sheathed");
-	sneakSheathed.Load(ini, "Sneak_Sheathed");
-	unSneakSheathed.Load(ini, "UnSneak_Sheathed");
-	takingHitSheathed.Load(ini, "TakingHit_Sheathed");
-	hittingSheathed.Load(ini, "Hitting_Sheathed");
-	arrowReleaseSheathed.Load(ini, "ArrowRelease_Sheathed");
-	sneakWalkForwardSheathed.Load(ini, "SneakWalkForward_Sheathed");
-	sneakWalkBackwardSheathed.Load(ini, "SneakWalkBackward_Sheathed");
-	sneakWalkLeftSheathed.Load(ini, "SneakWalkLeft_Sheathed");
-	sneakWalkRightSheathed.Load(ini, "SneakWalkRight_Sheathed");
-	sneakRunForwardSheathed.Load(ini, "SneakRunForward_Sheathed");
-	sneakRunBackwardSheathed.Load(ini, "SneakRunBackward_Sheathed");
-	sneakRunLeftSheathed.Load(ini, "SneakRunLeft_Sheathed");
-	sneakRunRightSheathed.Load(ini, "SneakRunRight_Sheathed");
-	
-	// Track file modification time
-	try {
-		lastModifiedTime = std::filesystem::last_write_time(INI_PATH);
-	} catch (...) {
-		// File doesn't exist, will be created on save
-	}
-	
-	// Increment version to invalidate caches
-	settingsVersion++;
-	
-	logger::info("[FPCameraSettle] Settings loaded from INI");
+	// Derived per-action data, then publish (bumps the version to invalidate caches)
+	InstallIni(*ini);
+	
+	if (stamped) {
+		SaveCache(stamp, *ini);
+	}
+	logger::info("[FPCameraSettle] Settings loaded from INI ({} profiles)", ini->profiles.size() + 1);
 }
 
 void Settings::Save()
 {
-	CSimpleIniA ini;
-	ini.SetUnicode();
-	
-	// General settings
-	ini.SetBoolValue("General", "bEnabled", enabled, "; Master toggle for all camera settle effects");
-	ini.SetDoubleValue("General", "fGlobalIntensity", globalIntensity, "; Global intensity multiplier (1.0 = normal)");
-	ini.SetDoubleValue("General", "fSmoothingFactor", smoothingFactor, "; Input smoothing (0 = none, 1 = maximum)");
-	ini.SetBoolValue("General", "bResetOnPause", resetOnPause, "; Disable camera effects when game is paused (menus, console, etc.)");
-	ini.SetLongValue("General", "iSpringSubsteps", springSubsteps, "; Number of physics sub-steps per frame (1-8, higher = more stable but slower)");
-	
-	// Movement settings
-	ini.SetBoolValue("Movement", "bSpeedBasedBlending", speedBasedBlending, "; Blend walk/run impulse based on actual speed instead of binary toggle");
-	ini.SetDoubleValue("Movement", "fWalkToRunGracePeriod", walkToRunGracePeriod, "; Skip walk impulse if player reaches run speed within this time (seconds)");
-	
-	// Jump/land scaling settings
-	ini.SetBoolValue("Jump", "bScaleByAirTime", scaleJumpByAirTime, "; Scale landing impulse based on air time (also prevents jump impulse when walking off ledges)");
-	ini.SetDoubleValue("Jump", "fMinAirTime", jumpMinAirTime, "; Minimum air time to trigger landing impulse (ignores short drops)");
-	ini.SetDoubleValue("Jump", "fMaxAirTimeScale", jumpMaxAirTimeScale, "; Air time above this is capped for scaling purposes");
-	ini.SetDoubleValue("Jump", "fLandBaseScale", landBaseScale, "; Base landing impulse scale (always applied above min air time)");
-	ini.SetDoubleValue("Jump", "fLandAirTimeScale", landAirTimeScale, "; Additional scale from air time (0 to this based on air time)");
-	
-	// Weapon state settings
-	ini.SetBoolValue("WeaponState", "bWeaponDrawnEnabled", weaponDrawnEnabled, "; Enable effects when weapon is drawn");
-	ini.SetBoolValue("WeaponState", "bWeaponSheathedEnabled", weaponSheathedEnabled, "; Enable effects when weapon is sheathed");
-	ini.SetDoubleValue("WeaponState", "fWeaponDrawnMult", weaponDrawnMult, "; Effect multiplier when weapon is drawn");
-	ini.SetDoubleValue("WeaponState", "fWeaponSheathedMult", weaponSheathedMult, "; Effect multiplier when weapon is sheathed");
-	
-	// Settling behavior
-	ini.SetDoubleValue("Settling", "fSettleDelay", settleDelay, "; Delay before settling starts (seconds)");
-	ini.SetDoubleValue("Settling", "fSettleSpeed", settleSpeed, "; How fast settling occurs");
-	ini.SetDoubleValue("Settling", "fSettleDampingMult", settleDampingMult, "; Max damping multiplier when settled");
-	
-	// Idle noise settings (weapon drawn)
-	ini.SetBoolValue("IdleNoise_Drawn", "bEnabled", idleNoiseEnabledDrawn, "; Enable subtle camera motion when standing idle (weapon drawn)");
-	ini.SetDoubleValue("IdleNoise_Drawn", "fPosAmpX", idleNoisePosAmpXDrawn, "; Position amplitude X (left/right)");
-	ini.SetDoubleValue("IdleNoise_Drawn", "fPosAmpY", idleNoisePosAmpYDrawn, "; Position amplitude Y (forward/back)");
-	ini.SetDoubleValue("IdleNoise_Drawn", "fPosAmpZ", idleNoisePosAmpZDrawn, "; Position amplitude Z (up/down breathing)");
-	ini.SetDoubleValue("IdleNoise_Drawn", "fRotAmpX", idleNoiseRotAmpXDrawn, "; Rotation amplitude pitch (degrees)");
-	ini.SetDoubleValue("IdleNoise_Drawn", "fRotAmpY", idleNoiseRotAmpYDrawn, "; Rotation amplitude roll (degrees)");
-	ini.SetDoubleValue("IdleNoise_Drawn", "fRotAmpZ", idleNoiseRotAmpZDrawn, "; Rotation amplitude yaw (degrees)");
-	ini.SetDoubleValue("IdleNoise_Drawn", "fFrequency", idleNoiseFrequencyDrawn, "; Noise frequency (cycles per second)");
-	
-	// Idle noise settings (weapon sheathed)
-	ini.SetBoolValue("IdleNoise_Sheathed", "bEnabled", idleNoiseEnabledSheathed, "; Enable subtle camera motion when standing idle (weapon sheathed)");
-	ini.SetDoubleValue("IdleNoise_Sheathed", "fPosAmpX", idleNoisePosAmpXSheathed, "; Position amplitude X (left/right)");
-	ini.SetDoubleValue("IdleNoise_Sheathed", "fPosAmpY", idleNoisePosAmpYSheathed, "; Position amplitude Y (forward/back)");
-	ini.SetDoubleValue("IdleNoise_Sheathed", "fPosAmpZ", idleNoisePosAmpZSheathed, "; Position amplitude Z (up/down breathing)");
-	ini.SetDoubleValue("IdleNoise_Sheathed", "fRotAmpX", idleNoiseRotAmpXSheathed, "; Rotation amplitude pitch (degrees)");
-	ini.SetDoubleValue("IdleNoise_Sheathed", "fRotAmpY", idleNoiseRotAmpYSheathed, "; Rotation amplitude roll (degrees)");
-	ini.SetDoubleValue("IdleNoise_Sheathed", "fRotAmpZ", idleNoiseRotAmpZSheathed, "; Rotation amplitude yaw (degrees)");
-	ini.SetDoubleValue("IdleNoise_Sheathed", "fFrequency", idleNoiseFrequencySheathed, "; Noise frequency (cycles per second)");
-	
-	// Shared idle noise settings
-	ini.SetDoubleValue("IdleNoise", "fBlendTime", idleNoiseBlendTime, "; Blend in/out time in seconds");
-	ini.SetBoolValue("IdleNoise", "bDialogueDisableIdleNoise", dialogueDisableIdleNoise, "; Disable idle camera noise in dialogue and map menus (blends out smoothly)");
-	ini.SetBoolValue("IdleNoise", "bScaleDuringArchery", idleNoiseScaleDuringArchery, "; Scale idle noise down while drawing bow/crossbow");
-	ini.SetDoubleValue("IdleNoise", "fArcheryScaleAmount", idleNoiseArcheryScaleAmount, "; Scale amount while drawing (0-1, e.g., 0.1 = 10%)");
-	ini.SetBoolValue("IdleNoise", "bArcheryScaleBySkill", idleNoiseArcheryScaleBySkill, "; Scale amount based on Archery skill (100 = 0)");
-	
-	// Sprint effects
-	ini.SetBoolValue("SprintEffects", "bFovEnabled", sprintFovEnabled, "; Enable FOV increase when sprinting");
-	ini.SetDoubleValue("SprintEffects", "fFovDelta", sprintFovDelta, "; FOV increase when sprinting (degrees)");
-	ini.SetDoubleValue("SprintEffects", "fFovBlendSpeed", sprintFovBlendSpeed, "; How fast to blend FOV (higher = faster)");
-	ini.SetBoolValue("SprintEffects", "bBlurEnabled", sprintBlurEnabled, "; Enable radial blur when sprinting");
-	ini.SetDoubleValue("SprintEffects", "fBlurStrength", sprintBlurStrength, "; Radial blur strength (0-1)");
-	ini.SetDoubleValue("SprintEffects", "fBlurBlendSpeed", sprintBlurBlendSpeed, "; How fast to blend blur (higher = faster)");
-	ini.SetDoubleValue("SprintEffects", "fBlurRampUp", sprintBlurRampUp, "; IMOD ramp up time in seconds (how fast blur appears)");
-	ini.SetDoubleValue("SprintEffects", "fBlurRampDown", sprintBlurRampDown, "; IMOD ramp down time in seconds (how fast blur fades)");
-	ini.SetDoubleValue("SprintEffects", "fBlurRadius", sprintBlurRadius, "; Blur start radius (0 = blur from center, 1 = edges only)");
-
-	// FOV punch settings
-	ini.SetBoolValue("FOVPunch", "bHitEnabled", fovPunchHitEnabled, "; Enable FOV punch when taking a hit");
-	ini.SetBoolValue("FOVPunch", "bArrowEnabled", fovPunchArrowEnabled, "; Enable FOV punch on arrow/bolt release");
-	ini.SetDoubleValue("FOVPunch", "fHitStrength", fovPunchHitStrength, "; Hit punch strength as percent of current FOV (e.g., 5.0 = +/-5%)");
-	ini.SetDoubleValue("FOVPunch", "fArrowStrength", fovPunchArrowStrength, "; Arrow punch strength as percent of current FOV (e.g., 3.0 = +/-3%)");
-	ini.SetDoubleValue("FOVPunch", "fDuration", fovPunchDuration, "; Total punch duration in seconds");
-	
-	// Debug settings
-	ini.SetBoolValue("Debug", "bDebugLogging", debugLogging, "; Enable detailed debug logging");
-	ini.SetBoolValue("Debug", "bDebugOnScreen", debugOnScreen, "; Show debug info on screen");
-	ini.SetBoolValue("Debug", "bEnableHotReload", enableHotReload, "; Auto-reload INI when changed");
-	ini.SetDoubleValue("Debug", "fHotReloadInterval", hotReloadIntervalSec, "; Hot reload check interval (seconds)");
-	
-	// Per-action settings (weapon drawn)
-	walkForwardDrawn.Save(ini, "WalkForward_Drawn");
-	walkBackwardDrawn.Save(ini, "WalkBackward_Drawn");
-	walkLeftDrawn.Save(ini, "WalkLeft_Drawn");
-	walkRightDrawn.Save(ini, "WalkRight_Drawn");
-	runForwardDrawn.Save(ini, "RunForward_Drawn");
-	runBackwardDrawn.Save(ini, "RunBackward_Drawn");
-	runLeftDrawn.Save(ini, "RunLeft_Drawn");
-	runRightDrawn.Save(ini, "RunRight_Drawn");
-	sprintForwardDrawn.Save(ini, "SprintForward_Drawn");
-	jumpDrawn.Save(ini, "Jump_Drawn");
-	landDrawn.Save(ini, "Land_Drawn");
-	sneakDrawn.Save(ini, "Sneak_Drawn");
-	unSneakDrawn.Save(ini, "UnSneak_Drawn");
-	takingHitDrawn.Save(ini, "TakingHit_Drawn");
-	hittingDrawn.Save(ini, "Hitting_Drawn");
-	arrowReleaseDrawn.Save(ini, "ArrowRelease_Drawn");
-	sneakWalkForwardDrawn.Save(ini, "SneakWalkForward_Drawn");
-	sneakWalkBackwardDrawn.Save(ini, "SneakWalkBackward_Drawn");
-	sneakWalkLeftDrawn.Save(ini, "SneakWalkLeft_Drawn");
-	sneakWalkRightDrawn.Save(ini, "SneakWalkRight_Drawn");
-	sneakRunForwardDrawn.Save(ini, "SneakRunForward_Drawn");
-	sneakRunBackwardDrawn.Save(ini, "SneakRunBackward_Drawn");
-	sneakRunLeftDrawn.Save(ini, "SneakRunLeft_Drawn");
-	sneakRunRightDrawn.Save(ini, "SneakRunRight_Drawn");
-	
-	// Per-action settings (weapon sheathed)
-	walkForwardSheathed.Save(ini, "WalkForward_Sheathed");
-	walkBackwardSheathed.Save(ini, "WalkBackward_Sheathed");
-	walkLeftSheathed.Save(ini, "WalkLeft_Sheathed");
-	walkRightSheathed.Save(ini, "WalkRight_Sheathed");
-	runForwardSheathed.Save(ini, "RunForward_Sheathed");
-	runBackwardSheathed.Save(ini, "RunBackward_Sheathed");
-	runLeftSheathed.Save(ini, "RunLeft_Sheathed");
-	runRightSheathed.Save(ini, "RunRight_Sheathed");
-	sprintForwardSheathed.Save(ini, "SprintForward_Sheathed");
-	jumpSheathed.Save(ini, "Jump_Sheathed");
-	landSheathed.Save(ini, "Land_Sheathed");
-	sneakSheathed.Save(ini, "Sneak_Sheathed");
-	unSneakSheathed.Save(ini, "UnSneak_Sheathed");
-	takingHitSheathed.Save(ini, "TakingHit_Sheathed");
-	hittingSheathed.Save(ini, "Hitting_Sheathed");
-	arrowReleaseSheathed.Save(ini, "ArrowRelease_Sheathed");
-	sneakWalkForwardSheathed.Save(ini, "SneakWalkForward_Sheathed");
-	sneakWalkBackwardSheathed.Save(ini, "SneakWalkBackward_Sheathed");
-	sneakWalkLeftSheathed.Save(ini, "SneakWalkLeft_Sheathed");
-	sneakWalkRightSheathed.Save(ini, "SneakWalkRight_Sheathed");
-	sneakRunForwardSheathed.Save(ini, "SneakRunForward_Sheathed");
-	sneakRunBackwardSheathed.Save(ini, "SneakRunBackward_Sheathed");
-	sneakRunLeftSheathed.Save(ini, "SneakRunLeft_Sheathed");
-	sneakRunRightSheathed.Save(ini, "SneakRunRight_Sheathed");
-	
-	SI_Error rc = ini.SaveFile(INI_PATH);
-	if (rc < 0) {
+	// Only the copy happens on the caller's thread; diffing and file I/O are on the writer
+	auto request = std::make_unique<SaveRequest>();
+	request->data = *this;
+	{
+		std::scoped_lock guard(profileLock);
+		if (activeProfile > 0 && activeProfile < static_cast<int>(profiles.size())) {
+			request->profile = profiles[activeProfile].name;
+		}
+	}
+	std::scoped_lock guard(saveLock);
+	saveRequest = std::move(request);
+	if (!saveRunning) {
+		// The last writer has left its loop; joining it only waits out its return
+		if (saveThread.joinable()) {
+			saveThread.join();
+		}
+		saveThread = std::thread(&Settings::SaveWorker, this);
+		saveRunning = true;
+	}
+}
+
+void Settings::SaveWorker()
+{
+	// Requests that arrive while a write is in flight collapse into the latest one; the thread
+	// exits once none is left, so it is never parked on saveLock when the process goes away
+	std::unique_lock lock(saveLock);
+	while (saveRequest) {
+		auto request = std::move(saveRequest);
+		lock.unlock();
+		WriteIniFile(*request);
+		lock.lock();
+	}
+	saveRunning = false;
+	saveIdle.notify_all();
+}
+
+void Settings::FlushSave()
+{
+	std::unique_lock lock(saveLock);
+	saveIdle.wait(lock, [this] { return !saveRunning; });
+}
+
+void Settings::WriteIniFile(const SaveRequest& a_request)
+{
+	// Start from the INI on disk, so profile sections and comments survive. Read again whenever the
+	// file is no longer the one last written here (hot reload, an outside edit, Reload from INI),
+	// or the diff and the write-back would revert it to the stale document.
+	std::error_code timeError;
+	const auto diskTime = std::filesystem::last_write_time(INI_PATH, timeError);
+	const bool firstSave = !savedIni;
+	if (firstSave || timeError || diskTime.time_since_epoch().count() != savedIniTime.load()) {
+		savedIni = std::make_unique<IniContents>();
+		saveDocument.Reset();
+		saveDocument.SetUnicode();
+		SettleCore::MappedFile file;
+		if (file.Open(std::filesystem::path(INI_PATH))) {
+			saveDocument.LoadData(file.View().data(), file.View().size());
+		}
+		ParseIniText(file.View(), *savedIni);
+	}
+	
+	// What the file holds for this profile (a profile not in the file yet starts from the defaults)
+	const SettingsData* saved = &savedIni->defaults;
+	for (const auto& profile : savedIni->profiles) {
+		if (!a_request.profile.empty() && SameProfileName(profile.name, a_request.profile)) {
+			saved = &profile.data;
+		}
+	}
+	
+	// The first save lays out every plain section; otherwise only what changed is written
+	const Ini::SectionMask dirty = firstSave && a_request.profile.empty() ? Ini::kAllSections : Ini::DiffSections(*saved, a_request.data);
+	if (dirty == 0) {
+		logger::info("[FPCameraSettle] No changes to save");
+		return;
+	}
+	WriteSections(saveDocument, a_request.profile, a_request.data, dirty);
+	
+	std::string text;
+	if (saveDocument.Save(text, true) < 0) {
 		logger::error("[FPCameraSettle] Failed to save INI file");
+		return;
+	}
+	
+	// Write a temp file and rename it over the INI, so a crash mid-write leaves the old INI intact
+	const std::filesystem::path iniPath(INI_PATH);
+	std::filesystem::path tempPath = iniPath;
+	tempPath += ".tmp";
+	{
+		std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+		file.write(text.data(), static_cast<std::streamsize>(text.size()));
+		file.flush();
+		if (!file) {
+			logger::error("[FPCameraSettle] Failed to save INI file");
+			return;
+		}
+	}
+	// Stamp the temp file (closed, and rename keeps its mtime): statting the INI after the rename
+	// could pick up someone else's write and key this text's cache on it
+	IniStamp stamp;
+	const bool stamped = GetIniStamp(tempPath, stamp) && stamp.size == text.size();
+	// A reader holding the INI open (the watcher mid-parse, an editor, a scanner) can
+	// briefly block replacing it on Windows, so retry before giving up
+	std::error_code renameError;
+	for (int attempt = 0; attempt < 5; ++attempt) {
+		std::filesystem::rename(tempPath, iniPath, renameError);
+		if (!renameError) {
+			break;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	}
+	if (renameError) {
+		std::error_code removeError;
+		std::filesystem::remove(tempPath, removeError);
+		logger::error("[FPCameraSettle] Failed to save INI file ({})", renameError.message());
+		return;
+	}
+	
+	// The watcher will see this write; remember it so it isn't parsed back in
+	savedIniTime = stamped ? stamp.time : 0;
+	
+	// Re-read what was written (microseconds), so the cache and the next diff cover every profile
+	ParseIniText(text, *savedIni);
+	if (stamped) {
+		SaveCache(stamp, *savedIni);
+	}
+	if (a_request.profile.empty()) {
+		logger::info("[FPCameraSettle] Settings saved to INI ({} of {} sections written)", std::popcount(dirty), SECTION_COUNT);
 	} else {
-		logger::info("[FPCameraSettle] Settings saved to INI");
+		logger::info("[FPCameraSettle] Profile '{}' saved to INI ({} of {} sections written)", a_request.profile, std::popcount(dirty), SECTION_COUNT);
 	}
 }
 
-void Settings::CheckForReload(float a_deltaTime)
+std::uint64_t Settings::DefaultsHash()
 {
-	if (!enableHotReload) {
-		return;
+	// The cache holds defaults for every key the INI leaves out, so a build with different
+	// defaults must not use it. Built in zeroed storage so padding hashes the same every time.
+	static const std::uint64_t hash = [] {
+		alignas(SettingsData) std::byte storage[sizeof(SettingsData)]{};
+		auto* defaults = new (storage) SettingsData{};
+		InitializeDefaults(*defaults);
+		
+		// FNV-1a
+		std::uint64_t value = 0xCBF29CE484222325ull;
+		for (const auto byte : storage) {
+			value = (value ^ static_cast<std::uint8_t>(byte)) * 0x100000001B3ull;
+		}
+		return value;
+	}();
+	return hash;
+}
+
+bool Settings::GetIniStamp(const std::filesystem::path& a_path, IniStamp& a_stamp)
+{
+	std::error_code sizeError;
+	std::error_code timeError;
+	const auto size = std::filesystem::file_size(a_path, sizeError);
+	const auto time = std::filesystem::last_write_time(a_path, timeError);
+	if (sizeError || timeError) {
+		return false;
+	}
+	a_stamp.size = size;
+	a_stamp.time = time.time_since_epoch().count();
+	return true;
+}
+
+bool Settings::LoadCache(const IniStamp& a_stamp, IniContents& a_ini)
+{
+	std::ifstream file(std::filesystem::path(CACHE_PATH), std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	
+	CacheHeader header;
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+		header.magic != CACHE_MAGIC || header.version != CACHE_VERSION || header.dataSize != sizeof(SettingsData) ||
+		header.iniSize != a_stamp.size || header.iniTime != a_stamp.time || header.defaultsHash != DefaultsHash()) {
+		return false;
 	}
 	
-	timeSinceLastCheck += a_deltaTime;
-	if (timeSinceLastCheck < hotReloadIntervalSec) {
+	// Read into a copy so a truncated cache leaves a_ini untouched
+	IniContents cached;
+	if (!file.read(reinterpret_cast<char*>(&cached.defaults), sizeof(SettingsData))) {
+		return false;
+	}
+	cached.profiles.resize(header.profileCount);
+	for (auto& profile : cached.profiles) {
+		std::uint32_t nameSize = 0;
+		if (!file.read(reinterpret_cast<char*>(&nameSize), sizeof(nameSize)) || nameSize > MAX_PROFILE_NAME) {
+			return false;
+		}
+		profile.name.resize(nameSize);
+		if (!file.read(profile.name.data(), nameSize) || !file.read(reinterpret_cast<char*>(&profile.data), sizeof(SettingsData))) {
+			return false;
+		}
+	}
+	a_ini = std::move(cached);
+	return true;
+}
+
+void Settings::SaveCache(const IniStamp& a_stamp, const IniContents& a_ini)
+{
+	CacheHeader header;
+	header.profileCount = static_cast<std::uint32_t>(a_ini.profiles.size());
+	header.iniSize = a_stamp.size;
+	header.iniTime = a_stamp.time;
+	header.defaultsHash = DefaultsHash();
+	
+	// One writer at a time, and the cache is only ever replaced whole, so Load never sees a
+	// half-written or interleaved file
+	std::scoped_lock guard(cacheLock);
+	const std::filesystem::path cachePath(CACHE_PATH);
+	std::filesystem::path tempPath = cachePath;
+	tempPath += ".tmp";
+	{
+		std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(&a_ini.defaults), sizeof(SettingsData));
+		for (const auto& profile : a_ini.profiles) {
+			const auto nameSize = static_cast<std::uint32_t>(std::min<std::size_t>(profile.name.size(), MAX_PROFILE_NAME));
+			file.write(reinterpret_cast<const char*>(&nameSize), sizeof(nameSize));
+			file.write(profile.name.data(), nameSize);
+			file.write(reinterpret_cast<const char*>(&profile.data), sizeof(SettingsData));
+		}
+		file.close();
+		if (!file) {
+			std::error_code removeError;
+			std::filesystem::remove(tempPath, removeError);
+			logger::warn("[FPCameraSettle] Failed to write settings cache");
+			return;
+		}
+	}
+	std::error_code renameError;
+	std::filesystem::rename(tempPath, cachePath, renameError);
+	if (renameError) {
+		std::error_code removeError;
+		std::filesystem::remove(tempPath, removeError);
+		logger::warn("[FPCameraSettle] Failed to write settings cache ({})", renameError.message());
+	}
+}
+
+void Settings::CheckForReload()
+{
+	// Follow the toggle; the watcher only runs while hot reload is on
+	if (enableHotReload != iniWatcher.IsRunning() && !watcherFailed) {
+		if (enableHotReload) {
+			StartWatcher();
+		} else {
+			iniWatcher.Stop();
+		}
+	}
+	
+	if (reloadPending.load(std::memory_order_acquire)) {
+		std::unique_ptr<IniContents> ini;
+		{
+			std::scoped_lock guard(pendingLock);
+			ini = std::move(pendingData);
+			reloadPending.store(false, std::memory_order_relaxed);
+		}
+		if (ini) {
+			InstallIni(*ini);
+			logger::info("[FPCameraSettle] Settings reloaded (hot reload, {} of {} sections changed, {} profiles)",
+				std::popcount(PeekSnapshot()->changedSections), SECTION_COUNT, ini->profiles.size() + 1);
+		}
+	}
+	
+	// After the reload, so a queued name finds the profiles it was checked against
+	if (profilePending.load(std::memory_order_acquire)) {
+		std::string name;
+		int steps = 0;
+		{
+			std::scoped_lock guard(pendingLock);
+			name = std::exchange(pendingProfile, {});
+			steps = std::exchange(pendingProfileSteps, 0);
+			profilePending.store(false, std::memory_order_relaxed);
+		}
+		if (!name.empty()) {
+			SelectProfile(name);
+		}
+		for (; steps > 0; --steps) {
+			SelectNextProfile();
+		}
+	}
+}
+
+void Settings::StartWatcher()
+{
+	if (!iniWatcher.Start(std::filesystem::path(INI_PATH), [this] { OnIniChanged(); })) {
+		// Don't retry every frame
+		watcherFailed = true;
+		logger::warn("[FPCameraSettle] Could not watch the INI directory, hot reload disabled");
+	}
+}
+
+void Settings::OnIniChanged()
+{
+	// Watcher thread: only touches the INI, the cache file and the pending slot
+	// Stamped before parsing: if the file changes again mid-read, the cache misses rather than lies
+	IniStamp stamp;
+	if (!GetIniStamp(std::filesystem::path(INI_PATH), stamp) || stamp.time == savedIniTime.load()) {
+		return;  // Gone (mid-replace), or our own Save()
+	}
+	
+	auto ini = std::make_unique<IniContents>();
+	if (!ReadIni(*ini)) {
 		return;
 	}
-	timeSinceLastCheck = 0.0f;
+	SaveCache(stamp, *ini);
 	
-	try {
-		auto currentTime = std::filesystem::last_write_time(INI_PATH);
-		if (currentTime != lastModifiedTime) {
-			lastModifiedTime = currentTime;
-			Load();
-			logger::info("[FPCameraSettle] Settings reloaded (hot reload)");
+	std::scoped_lock guard(pendingLock);
+	pendingData = std::move(ini);
+	reloadPending.store(true, std::memory_order_release);
+}
+
+void Settings::RefreshStepBounds(SettingsData& a_data)
+{
+	// Settling raises damping up to settleDampingMult, which only tightens the bound,
+	// so the worst case covers every frame
+	const float dampingMult = std::max(a_data.settleDampingMult, 1.0f);
+	for (auto& state : a_data.actionSettings) {
+		for (auto& s : state) {
+			s.maxStableStep = SettleCore::GetMaxStableStep(s.Stiffness(), s.Damping() * dampingMult);
 		}
-	} catch (...) {
-		// File doesn't exist or can't be accessed
 	}
 }
 
-ActionSettings& Settings::GetActionSettings(ActionType a_type)
+std::shared_ptr<const SettingsSnapshot> Settings::MakeSnapshot(const SettingsData& a_data, Ini::SectionMask a_changed)
 {
-	// Default to drawn settings
-	return GetActionSettingsForState(a_type, true);
+	auto next = std::make_shared<SettingsSnapshot>();
+	static_cast<SettingsData&>(*next) = a_data;
+	next->version = ++settingsVersion;
+	if (const auto* previous = snapshotAddress.load(std::memory_order_relaxed)) {
+		next->previousVersion = previous->version;
+		next->changedSections = a_changed;
+	}
+	return next;
 }
 
-const ActionSettings& Settings::GetActionSettings(ActionType a_type) const
+void Settings::PublishSnapshot(std::shared_ptr<const SettingsSnapshot> a_snapshot)
 {
-	return GetActionSettingsForState(a_type, true);
+	const SettingsSnapshot* address = a_snapshot.get();
+	snapshot.store(std::move(a_snapshot), std::memory_order_release);
+	snapshotAddress.store(address, std::memory_order_release);
+}
+
+void Settings::Publish(Ini::SectionMask a_sections)
+{
+	std::scoped_lock guard(profileLock);
+	auto next = MakeSnapshot(*this, a_sections);
+	if (activeProfile < static_cast<int>(profiles.size())) {
+		profiles[activeProfile].snapshot = next;  // Menu edits follow the profile when switching away and back
+	}
+	PublishSnapshot(std::move(next));
 }
 
-ActionSettings& Settings::GetActionSettingsForState(ActionType a_type, bool a_weaponDrawn)
-{
-	if (a_weaponDrawn) {
-		switch (a_type) {
-		case ActionType::WalkForward: return walkForwardDrawn;
-		case ActionType::WalkBackward: return walkBackwardDrawn;
-		case ActionType::WalkLeft: return walkLeftDrawn;
-		case ActionType::WalkRight: return walkRightDrawn;
-		case ActionType::RunForward: return runForwardDrawn;
-		case ActionType::RunBackward: return runBackwardDrawn;
-		case ActionType::RunLeft: return runLeftDrawn;
-		case ActionType::RunRight: return runRightDrawn;
-		case ActionType::SprintForward: return sprintForwardDrawn;
-		case ActionType::SneakWalkForward: return sneakWalkForwardDrawn;
-		case ActionType::SneakWalkBackward: return sneakWalkBackwardDrawn;
-		case ActionType::SneakWalkLeft: return sneakWalkLeftDrawn;
-		case ActionType::SneakWalkRight: return sneakWalkRightDrawn;
-		case ActionType::SneakRunForward: return sneakRunForwardDrawn;
-		case ActionType::SneakRunBackward: return sneakRunBackwardDrawn;
-		case ActionType::SneakRunLeft: return sneakRunLeftDrawn;
-		case ActionType::SneakRunRight: return sneakRunRightDrawn;
-		case ActionType::Jump: return jumpDrawn;
-		case ActionType::Land: return landDrawn;
-		case ActionType::Sneak: return sneakDrawn;
-		case ActionType::UnSneak: return unSneakDrawn;
-		case ActionType::TakingHit: return takingHitDrawn;
-		case ActionType::Hitting: return hittingDrawn;
-		case ActionType::ArrowRelease: return arrowReleaseDrawn;
-		default: return walkForwardDrawn;
+void Settings::InstallIni(IniContents& a_ini)
+{
+	RefreshStepBounds(a_ini.defaults);
+	for (auto& profile : a_ini.profiles) {
+		RefreshStepBounds(profile.data);
+	}
+	
+	std::scoped_lock guard(profileLock);
+	const std::string activeName = activeProfile < static_cast<int>(profiles.size()) ? profiles[activeProfile].name : std::string();
+	
+	// Stay on the selected profile if the INI still defines it
+	int active = 0;
+	for (int index = 0; index < static_cast<int>(a_ini.profiles.size()); ++index) {
+		if (SameProfileName(a_ini.profiles[index].name, activeName)) {
+			active = index + 1;
 		}
-	} else {
-		switch (a_type) {
-		case ActionType::WalkForward: return walkForwardSheathed;
-		case ActionType::WalkBackward: return walkBackwardSheathed;
-		case ActionType::WalkLeft: return walkLeftSheathed;
-		case ActionType::WalkRight: return walkRightSheathed;
-		case ActionType::RunForward: return runForwardSheathed;
-		case ActionType::RunBackward: return runBackwardSheathed;
-		case ActionType::RunLeft: return runLeftSheathed;
-		case ActionType::RunRight: return runRightSheathed;
-		case ActionType::SprintForward: return sprintForwardSheathed;
-		case ActionType::SneakWalkForward: return sneakWalkForwardSheathed;
-		case ActionType::SneakWalkBackward: return sneakWalkBackwardSheathed;
-		case ActionType::SneakWalkLeft: return sneakWalkLeftSheathed;
-		case ActionType::SneakWalkRight: return sneakWalkRightSheathed;
-		case ActionType::SneakRunForward: return sneakRunForwardSheathed;
-		case ActionType::SneakRunBackward: return sneakRunBackwardSheathed;
-		case ActionType::SneakRunLeft: return sneakRunLeftSheathed;
-		case ActionType::SneakRunRight: return sneakRunRightSheathed;
-		case ActionType::Jump: return jumpSheathed;
-		case ActionType::Land: return landSheathed;
-		case ActionType::Sneak: return sneakSheathed;
-		case ActionType::UnSneak: return unSneakSheathed;
-		case ActionType::TakingHit: return takingHitSheathed;
-		case ActionType::Hitting: return hittingSheathed;
-		case ActionType::ArrowRelease: return arrowReleaseSheathed;
-		default: return walkForwardSheathed;
+	}
+	
+	// Every profile becomes a finished snapshot now, so selecting one later costs a pointer swap.
+	// The one published records which sections the reload actually changed.
+	const auto* published = snapshotAddress.load(std::memory_order_relaxed);
+	auto makeProfile = [&](std::string a_name, const SettingsData& a_data, int a_index) {
+		const bool publish = a_index == active;
+		const auto changed = publish && published ? Ini::DiffSections(*published, a_data) : Ini::kAllSections;
+		return Profile{ std::move(a_name), MakeSnapshot(a_data, changed) };
+	};
+	profiles.clear();
+	profiles.reserve(a_ini.profiles.size() + 1);
+	profiles.push_back(makeProfile(kDefaultProfile, a_ini.defaults, 0));
+	for (int index = 0; index < static_cast<int>(a_ini.profiles.size()); ++index) {
+		profiles.push_back(makeProfile(a_ini.profiles[index].name, a_ini.profiles[index].data, index + 1));
+	}
+	
+	activeProfile = active;
+	static_cast<SettingsData&>(*this) = *profiles[activeProfile].snapshot;
+	PublishSnapshot(profiles[activeProfile].snapshot);
+}
+
+std::vector<std::string> Settings::GetProfileNames() const
+{
+	std::scoped_lock guard(profileLock);
+	std::vector<std::string> names;
+	names.reserve(profiles.size());
+	for (const auto& profile : profiles) {
+		names.push_back(profile.name);
+	}
+	return names;
+}
+
+int Settings::GetActiveProfile() const
+{
+	std::scoped_lock guard(profileLock);
+	return activeProfile;
+}
+
+bool Settings::SelectProfile(int a_index)
+{
+	std::scoped_lock guard(profileLock);
+	if (a_index < 0 || a_index >= static_cast<int>(profiles.size())) {
+		return false;
+	}
+	
+	// The game thread only sees the pointer swap; the working copy follows for the menu
+	activeProfile = a_index;
+	static_cast<SettingsData&>(*this) = *profiles[a_index].snapshot;
+	PublishSnapshot(profiles[a_index].snapshot);
+	logger::info("[FPCameraSettle] Profile '{}' selected", profiles[a_index].name);
+	return true;
+}
+
+bool Settings::SelectProfile(std::string_view a_name)
+{
+	int index = -1;
+	{
+		std::scoped_lock guard(profileLock);
+		for (int i = 0; i < static_cast<int>(profiles.size()); ++i) {
+			if (SameProfileName(profiles[i].name, a_name)) {
+				index = i;
+				break;
+			}
 		}
 	}
+	return index >= 0 && SelectProfile(index);
 }
 
-const ActionSettings& Settings::GetActionSettingsForState(ActionType a_type, bool a_weaponDrawn) const
+void Settings::SelectNextProfile()
 {
-	return const_cast<Settings*>(this)->GetActionSettingsForState(a_type, a_weaponDrawn);
+	int next = 0;
+	{
+		std::scoped_lock guard(profileLock);
+		if (profiles.size() < 2) {
+			return;
+		}
+		next = (activeProfile + 1) % static_cast<int>(profiles.size());
+	}
+	SelectProfile(next);
+}
+
+bool Settings::QueueSelectProfile(std::string_view a_name)
+{
+	{
+		std::scoped_lock guard(profileLock);
+		if (std::ranges::none_of(profiles, [&](const Profile& a_profile) { return SameProfileName(a_profile.name, a_name); })) {
+			return false;
+		}
+	}
+	std::scoped_lock guard(pendingLock);
+	pendingProfile = a_name;
+	pendingProfileSteps = 0;  // The latest named selection replaces any queued before it
+	profilePending.store(true, std::memory_order_release);
+	return true;
+}
+
+void Settings::QueueSelectNextProfile()
+{
+	std::scoped_lock guard(pendingLock);
+	++pendingProfileSteps;
+	profilePending.store(true, std::memory_order_release);
+}
+
+Settings::~Settings()
+{
+	// Runs at DLL detach, after the process has already killed a writer still running (possibly
+	// holding saveLock), so neither lock nor join here; FlushSave is the point that waits for saves
+	if (saveThread.joinable()) {
+		saveThread.detach();
+	}
+}
+
+ActionSettings& Settings::GetActionSettings(ActionType a_type)
+{
+	// Default to drawn settings
+	return GetActionSettingsForState(a_type, true);
+}
+
+const ActionSettings& Settings::GetActionSettings(ActionType a_type) const
+{
+	return GetActionSettingsForState(a_type, true);
 }
 
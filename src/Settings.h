@@ -1,65 +1,15 @@
 #pragma once
 
-// Action types that trigger camera settle effects
-enum class ActionType : int
-{
-	WalkForward = 0,
-	WalkBackward,
-	WalkLeft,
-	WalkRight,
-	RunForward,
-	RunBackward,
-	RunLeft,
-	RunRight,
-	SprintForward,
-	// Sneak movement actions
-	SneakWalkForward,
-	SneakWalkBackward,
-	SneakWalkLeft,
-	SneakWalkRight,
-	SneakRunForward,
-	SneakRunBackward,
-	SneakRunLeft,
-	SneakRunRight,
-	// Other actions
-	Jump,
-	Land,
-	Sneak,
-	UnSneak,
-	TakingHit,
-	Hitting,
-	ArrowRelease,  // Bow/crossbow shot
-	kTotal
-};
+#include "Core/FileWatcher.h"
+#include "Core/SettingsData.h"
+#include "Core/SettingsIni.h"
 
-// Settings for a specific action type
-struct ActionSettings
-{
-	bool  enabled{ true };           // Enable settle effect for this action
-	float multiplier{ 1.0f };        // Per-action intensity multiplier (0-10x)
-	float blendTime{ 0.1f };         // Time to blend impulse into spring (0 = instant, up to 1.0 sec)
-	float stiffness{ 100.0f };       // Spring stiffness (higher = faster return)
-	float damping{ 8.0f };           // Damping coefficient (higher = less oscillation)
-	float positionStrength{ 5.0f };  // Position offset strength
-	float rotationStrength{ 3.0f };  // Rotation offset strength (degrees)
-	float impulseX{ 0.0f };          // Initial impulse direction X
-	float impulseY{ 0.0f };          // Initial impulse direction Y (forward/back)
-	float impulseZ{ 0.0f };          // Initial impulse direction Z (up/down)
-	float rotImpulseX{ 0.0f };       // Initial rotation impulse (pitch)
-	float rotImpulseY{ 0.0f };       // Initial rotation impulse (yaw)
-	float rotImpulseZ{ 0.0f };       // Initial rotation impulse (roll)
-	
-	void Load(CSimpleIniA& a_ini, const char* a_section);
-	void Save(CSimpleIniA& a_ini, const char* a_section) const;
-	
-	// Copy all values from another ActionSettings
-	void CopyFrom(const ActionSettings& other);
-	
-	// Blend between two ActionSettings (t=0 returns a, t=1 returns b)
-	static ActionSettings Blend(const ActionSettings& a, const ActionSettings& b, float t);
-};
+#include <atomic>
+#include <condition_variable>
+#include <string_view>
+#include <thread>
 
-class Settings
+class Settings : public SettingsData
 {
 public:
 	static Settings* GetSingleton()
@@ -69,16 +19,32 @@ public:
 	}
 
 	void Load();
-	void Save();
-	void CheckForReload(float a_deltaTime);
+	void Save();  // Queues the write of the active profile; the INI is updated on a background thread
+	
+	// Blocks until every queued save is on disk (returns at once when none is). Called from the game
+	// thread before it can exit: the destructor can't, the writer thread is gone by then.
+	void FlushSave();
+	
+	// Game thread, once per frame: swaps in settings the INI watcher has parsed and profile selections
+	// queued from other threads (cheap when there are none)
+	void CheckForReload();
 	
-	// Settings version - incremented when any setting changes (for cache invalidation)
+	// Settings version - incremented for every snapshot made, so each one's version is unique (for cache invalidation)
 	uint32_t GetVersion() const { return settingsVersion; }
-	void MarkDirty() { settingsVersion++; }
+	// Publishes the working copy after an edit; a_sections are the INI sections it touched
+	void MarkDirty(SettleCore::SettingsIni::SectionMask a_sections = SettleCore::SettingsIni::kAllSections)
+	{
+		RefreshStepBounds(*this);
+		Publish(a_sections);
+	}
 	
-	// Edit mode - when true, check for settings changes every frame
-	bool IsEditMode() const { return editMode; }
-	void SetEditMode(bool a_enabled) { editMode = a_enabled; if (a_enabled) settingsVersion++; }
+	// The members of this object are the menu's working copy. Readers take the latest
+	// published snapshot instead and keep the shared_ptr while they use it, so a
+	// replaced snapshot is only freed once its last reader lets go.
+	std::shared_ptr<const SettingsSnapshot> GetSnapshot() const { return snapshot.load(std::memory_order_acquire); }
+	
+	// Address of the latest snapshot, to check for a new one without touching the refcount
+	const SettingsSnapshot* PeekSnapshot() const { return snapshotAddress.load(std::memory_order_acquire); }
 	
 	// Get settings for a specific action type
 	ActionSettings& GetActionSettings(ActionType a_type);
@@ -86,179 +52,178 @@ public:
 	
 	// Get action name for display
 	static const char* GetActionName(ActionType a_type);
-
-	// === MASTER TOGGLE ===
-	bool enabled{ true };
-	
-	// === WEAPON DRAWN SETTINGS ===
-	bool weaponDrawnEnabled{ true };     // Enable effects when weapon is drawn
-	bool weaponSheathedEnabled{ true };  // Enable effects when weapon is sheathed
-	float weaponDrawnMult{ 1.0f };       // Multiplier when weapon is drawn
-	float weaponSheathedMult{ 0.7f };    // Multiplier when weapon is sheathed
-	
-	// === GENERAL SETTINGS ===
-	float globalIntensity{ 1.0f };    // Global intensity multiplier
-	float smoothingFactor{ 0.3f };    // Smoothing for input (0-1)
-	
-	// === SETTLING BEHAVIOR ===
-	float settleDelay{ 0.1f };        // Delay before settling starts
-	float settleSpeed{ 3.0f };        // How fast settling occurs
-	float settleDampingMult{ 2.0f };  // Max damping multiplier when settled
-	
-	// === PERFORMANCE ===
-	int springSubsteps{ 4 };      // Number of sub-steps for spring physics (1-8, higher = more stable but slower)
-	
-	// === BEHAVIOR ===
-	bool resetOnPause{ false };   // Reset springs when game is paused (menus, console, etc.)
-	
-	// === WALK/RUN BLENDING ===
-	bool  speedBasedBlending{ true };    // Blend walk/run based on actual movement speed instead of binary toggle
-	float walkToRunGracePeriod{ 0.15f }; // Skip walk impulse if player reaches run speed within this time (seconds)
-	
-	// === JUMP/LAND SCALING ===
-	bool  scaleJumpByAirTime{ true };     // Scale jump/land impulse based on air time
-	float jumpMinAirTime{ 0.15f };        // Minimum air time to trigger any landing impulse
-	float jumpMaxAirTimeScale{ 2.0f };    // Maximum air time for scaling purposes
-	float landBaseScale{ 0.3f };          // Base landing impulse scale (always applied)
-	float landAirTimeScale{ 0.7f };       // Additional scale from air time (0 to this value)
-	
-	// === IDLE CAMERA NOISE ===
-	// Weapon Drawn
-	bool  idleNoiseEnabledDrawn{ false };
-	float idleNoisePosAmpXDrawn{ 0.0f };      // Position amplitude X (left/right)
-	float idleNoisePosAmpYDrawn{ 0.0f };      // Position amplitude Y (forward/back)
-	float idleNoisePosAmpZDrawn{ 0.02f };     // Position amplitude Z (up/down breathing)
-	float idleNoiseRotAmpXDrawn{ 0.1f };      // Rotation amplitude pitch (degrees)
-	float idleNoiseRotAmpYDrawn{ 0.0f };      // Rotation amplitude roll (degrees)
-	float idleNoiseRotAmpZDrawn{ 0.05f };     // Rotation amplitude yaw (degrees)
-	float idleNoiseFrequencyDrawn{ 0.3f };    // Noise frequency (cycles per second)
-	
-	// Weapon Sheathed
-	bool  idleNoiseEnabledSheathed{ true };
-	float idleNoisePosAmpXSheathed{ 0.0f };
-	float idleNoisePosAmpYSheathed{ 0.0f };
-	float idleNoisePosAmpZSheathed{ 0.03f };
-	float idleNoiseRotAmpXSheathed{ 0.15f };
-	float idleNoiseRotAmpYSheathed{ 0.0f };
-	float idleNoiseRotAmpZSheathed{ 0.08f };
-	float idleNoiseFrequencySheathed{ 0.25f };
 	
-	// Shared idle noise setting
-	float idleNoiseBlendTime{ 0.25f };        // Blend in/out time in seconds
-	bool  dialogueDisableIdleNoise{ false };  // Disable idle noise when in dialogue
-	
-	// Archery idle noise scaling
-	bool  idleNoiseScaleDuringArchery{ true };    // Scale idle noise down while drawing bow/crossbow
-	float idleNoiseArcheryScaleAmount{ 0.10f };  // Scale amount while drawing (0-1)
-	bool  idleNoiseArcheryScaleBySkill{ false };  // Scale amount based on Archery skill
-	
-	// === SPRINT EFFECTS ===
-	bool  sprintFovEnabled{ true };
-	float sprintFovDelta{ 10.0f };            // FOV increase when sprinting (degrees)
-	float sprintFovBlendSpeed{ 3.0f };        // How fast to blend FOV (higher = faster)
-	
-	bool  sprintBlurEnabled{ false };
-	float sprintBlurStrength{ 0.3f };         // Radial blur strength (0-1)
-	float sprintBlurBlendSpeed{ 3.0f };       // How fast to blend blur (higher = faster)
-	float sprintBlurRampUp{ 0.1f };           // IMOD ramp up time (seconds) - how fast blur fades in
-	float sprintBlurRampDown{ 0.2f };         // IMOD ramp down time (seconds) - how fast blur fades out
-	float sprintBlurRadius{ 0.5f };           // Blur start radius (0 = from center, 1 = edges only)
+	// === PROFILES ===
+	// The plain INI sections are the default profile; [Profile.<name>.<section>] sections
+	// add named ones (see SettleCore::SettingsIni). Every profile is parsed on load and kept
+	// as a ready snapshot, so selecting one publishes it with a pointer swap: no parse and no
+	// spring reset. Menu edits stay with the active profile until the next load.
+	static constexpr const char* kDefaultProfile = "Default";
+	
+	std::vector<std::string> GetProfileNames() const;  // Default first, then the INI's order
+	int GetActiveProfile() const;
+	// Selecting also replaces the menu's working copy, so these run on the game thread (menu, hotkey)
+	bool SelectProfile(int a_index);
+	bool SelectProfile(std::string_view a_name);  // Case-insensitive
+	void SelectNextProfile();                     // Wraps around to the default profile
+	
+	// Any thread (the plugin's exports): queued for the next CheckForReload. False if no profile has that name.
+	bool QueueSelectProfile(std::string_view a_name);
+	void QueueSelectNextProfile();
 
-	// === FOV PUNCH ===
-	bool  fovPunchHitEnabled{ true };         // Enable FOV punch when taking a hit
-	bool  fovPunchArrowEnabled{ true };       // Enable FOV punch on arrow/bolt release
-	float fovPunchHitStrength{ 5.0f };        // Percent of FOV (5.0 = +/-5%)
-	float fovPunchArrowStrength{ 3.0f };      // Percent of FOV (3.0 = +/-3%)
-	float fovPunchDuration{ 0.25f };          // Total punch duration in seconds
-	
-	// === DEBUG ===
-	bool debugLogging{ false };
-	bool debugOnScreen{ false };
-	
-	// === HOT RELOAD ===
-	bool  enableHotReload{ true };
-	float hotReloadIntervalSec{ 5.0f };
-	
-	// === PER-ACTION SETTINGS ===
+	// === PER-ACTION SETTINGS (named aliases into actionSettings) ===
 	// Weapon drawn actions
-	ActionSettings walkForwardDrawn;
-	ActionSettings walkBackwardDrawn;
-	ActionSettings walkLeftDrawn;
-	ActionSettings walkRightDrawn;
-	ActionSettings runForwardDrawn;
-	ActionSettings runBackwardDrawn;
-	ActionSettings runLeftDrawn;
-	ActionSettings runRightDrawn;
-	ActionSettings sprintForwardDrawn;
-	ActionSettings jumpDrawn;
-	ActionSettings landDrawn;
-	ActionSettings sneakDrawn;
-	ActionSettings unSneakDrawn;
-	ActionSettings takingHitDrawn;
-	ActionSettings hittingDrawn;
-	ActionSettings arrowReleaseDrawn;
+	ActionSettings& walkForwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::WalkForward)] };
+	ActionSettings& walkBackwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::WalkBackward)] };
+	ActionSettings& walkLeftDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::WalkLeft)] };
+	ActionSettings& walkRightDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::WalkRight)] };
+	ActionSettings& runForwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::RunForward)] };
+	ActionSettings& runBackwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::RunBackward)] };
+	ActionSettings& runLeftDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::RunLeft)] };
+	ActionSettings& runRightDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::RunRight)] };
+	ActionSettings& sprintForwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SprintForward)] };
+	ActionSettings& jumpDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::Jump)] };
+	ActionSettings& landDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::Land)] };
+	ActionSettings& sneakDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::Sneak)] };
+	ActionSettings& unSneakDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::UnSneak)] };
+	ActionSettings& takingHitDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::TakingHit)] };
+	ActionSettings& hittingDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::Hitting)] };
+	ActionSettings& arrowReleaseDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::ArrowRelease)] };
 	// Sneak movement actions (drawn)
-	ActionSettings sneakWalkForwardDrawn;
-	ActionSettings sneakWalkBackwardDrawn;
-	ActionSettings sneakWalkLeftDrawn;
-	ActionSettings sneakWalkRightDrawn;
-	ActionSettings sneakRunForwardDrawn;
-	ActionSettings sneakRunBackwardDrawn;
-	ActionSettings sneakRunLeftDrawn;
-	ActionSettings sneakRunRightDrawn;
+	ActionSettings& sneakWalkForwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SneakWalkForward)] };
+	ActionSettings& sneakWalkBackwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SneakWalkBackward)] };
+	ActionSettings& sneakWalkLeftDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SneakWalkLeft)] };
+	ActionSettings& sneakWalkRightDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SneakWalkRight)] };
+	ActionSettings& sneakRunForwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SneakRunForward)] };
+	ActionSettings& sneakRunBackwardDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SneakRunBackward)] };
+	ActionSettings& sneakRunLeftDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SneakRunLeft)] };
+	ActionSettings& sneakRunRightDrawn{ actionSettings[kDrawn][static_cast<int>(ActionType::SneakRunRight)] };
 	
 	// Weapon sheathed actions
-	ActionSettings walkForwardSheathed;
-	ActionSettings walkBackwardSheathed;
-	ActionSettings walkLeftSheathed;
-	ActionSettings walkRightSheathed;
-	ActionSettings runForwardSheathed;
-	ActionSettings runBackwardSheathed;
-	ActionSettings runLeftSheathed;
-	ActionSettings runRightSheathed;
-	ActionSettings sprintForwardSheathed;
+	ActionSettings& walkForwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::WalkForward)] };
+	ActionSettings& walkBackwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::WalkBackward)] };
+	ActionSettings& walkLeftSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::WalkLeft)] };
+	ActionSettings& walkRightSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::WalkRight)] };
+	ActionSettings& runForwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::RunForward)] };
+	ActionSettings& runBackwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::RunBackward)] };
+	ActionSettings& runLeftSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::RunLeft)] };
+	ActionSettings& runRightSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::RunRight)] };
+	ActionSettings& sprintForwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SprintForward)] };
 	// Sneak movement actions (sheathed)
-	ActionSettings sneakWalkForwardSheathed;
-	ActionSettings sneakWalkBackwardSheathed;
-	ActionSettings sneakWalkLeftSheathed;
-	ActionSettings sneakWalkRightSheathed;
-	ActionSettings sneakRunForwardSheathed;
-	ActionSettings sneakRunBackwardSheathed;
-	ActionSettings sneakRunLeftSheathed;
-	ActionSettings sneakRunRightSheathed;
+	ActionSettings& sneakWalkForwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SneakWalkForward)] };
+	ActionSettings& sneakWalkBackwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SneakWalkBackward)] };
+	ActionSettings& sneakWalkLeftSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SneakWalkLeft)] };
+	ActionSettings& sneakWalkRightSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SneakWalkRight)] };
+	ActionSettings& sneakRunForwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SneakRunForward)] };
+	ActionSettings& sneakRunBackwardSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SneakRunBackward)] };
+	ActionSettings& sneakRunLeftSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SneakRunLeft)] };
+	ActionSettings& sneakRunRightSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::SneakRunRight)] };
 	// Other sheathed actions
-	ActionSettings jumpSheathed;
-	ActionSettings landSheathed;
-	ActionSettings sneakSheathed;
-	ActionSettings unSneakSheathed;
-	ActionSettings takingHitSheathed;
-	ActionSettings hittingSheathed;
-	ActionSettings arrowReleaseSheathed;  // For consistency, though unlikely to trigger
-	
-	// Get appropriate settings based on weapon drawn state
-	ActionSettings& GetActionSettingsForState(ActionType a_type, bool a_weaponDrawn);
-	const ActionSettings& GetActionSettingsForState(ActionType a_type, bool a_weaponDrawn) const;
+	ActionSettings& jumpSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::Jump)] };
+	ActionSettings& landSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::Land)] };
+	ActionSettings& sneakSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::Sneak)] };
+	ActionSettings& unSneakSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::UnSneak)] };
+	ActionSettings& takingHitSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::TakingHit)] };
+	ActionSettings& hittingSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::Hitting)] };
+	ActionSettings& arrowReleaseSheathed{ actionSettings[kSheathed][static_cast<int>(ActionType::ArrowRelease)] };  // For consistency, though unlikely to trigger
 
 private:
 	Settings() = default;
 	Settings(const Settings&) = delete;
 	Settings(Settings&&) = delete;
-	~Settings() = default;
+	~Settings();
 
 	Settings& operator=(const Settings&) = delete;
 	Settings& operator=(Settings&&) = delete;
 
-	// Hot-reload tracking
-	std::filesystem::file_time_type lastModifiedTime{};
-	float timeSinceLastCheck{ 0.0f };
+	// Everything read from the INI: the plain sections and each named profile on top of them
+	struct IniContents
+	{
+		SettingsData defaults;
+		std::vector<SettleCore::SettingsIni::Profile> profiles;
+	};
+	
+	struct Profile
+	{
+		std::string name;
+		std::shared_ptr<const SettingsSnapshot> snapshot;  // Published as-is when the profile is selected
+	};
+	
+	// Loaded profiles ([0] is the default) and the selected one; guards publishing too
+	mutable std::mutex profileLock;
+	std::vector<Profile> profiles;
+	int activeProfile{ 0 };
+	
+	// Hot reload: the watcher thread parses the INI into pendingData, CheckForReload applies it
+	std::mutex pendingLock;
+	std::unique_ptr<IniContents> pendingData;
+	std::atomic<bool> reloadPending{ false };
+	std::atomic<std::int64_t> savedIniTime{ 0 };  // last_write_time ticks of our own last Save()
+	bool watcherFailed{ false };
+	
+	// Profile selections from other threads, applied by CheckForReload (guarded by pendingLock)
+	std::string pendingProfile;    // Empty for none
+	int pendingProfileSteps{ 0 };  // SelectNextProfile calls after it
+	std::atomic<bool> profilePending{ false };
+	
+	// Async INI writer: Save() queues a copy for saveThread (the latest request wins), starting it if it isn't running
+	struct SaveRequest
+	{
+		SettingsData data;
+		std::string profile;  // Empty for the default profile's plain sections
+	};
+	
+	std::mutex saveLock;
+	std::condition_variable saveIdle;  // Signalled when the writer runs out of requests and exits
+	std::unique_ptr<SaveRequest> saveRequest;
+	bool saveRunning{ false };  // saveThread is in SaveWorker
+	std::thread saveThread;
+	
+	// Held for the whole cache write; the writer and the watcher thread both call SaveCache
+	std::mutex cacheLock;
+	
+	// Writer thread only: the INI as last read or written, and the values it holds (read again once its mtime isn't savedIniTime)
+	CSimpleIniA saveDocument;
+	std::unique_ptr<IniContents> savedIni;
+	SettleCore::FileWatcher iniWatcher;  // Declared last so its thread stops before the members above go away
 	
 	// Version counter for cache invalidation
 	uint32_t settingsVersion{ 0 };
 	
-	// Edit mode flag
-	bool editMode{ false };
+	// Latest published snapshot; snapshotAddress is stored after snapshot
+	std::atomic<std::shared_ptr<const SettingsSnapshot>> snapshot;
+	std::atomic<const SettingsSnapshot*> snapshotAddress{ nullptr };
 	
 	// Internal helpers
-	void InitializeDefaults();
+	static void InitializeDefaults(SettingsData& a_data);
+	static void ParseIniText(std::string_view a_text, IniContents& a_ini);  // Defaults + INI text, every profile
+	static bool ReadIni(IniContents& a_ini);  // ParseIniText on the INI file; false if it can't be read. Safe off the game thread.
+	static void RefreshStepBounds(SettingsData& a_data);  // Recompute every action's maxStableStep
+	
+	// Next version, recording a_changed against the published snapshot (all sections if there is none); caller holds profileLock
+	std::shared_ptr<const SettingsSnapshot> MakeSnapshot(const SettingsData& a_data, SettleCore::SettingsIni::SectionMask a_changed);
+	void PublishSnapshot(std::shared_ptr<const SettingsSnapshot> a_snapshot);         // Caller holds profileLock
+	void Publish(SettleCore::SettingsIni::SectionMask a_sections);  // Snapshot the working copy as the active profile and swap it in
+	void InstallIni(IniContents& a_ini);  // Replace every profile, keep the selection by name, publish it
+	
+	void SaveWorker();
+	void WriteIniFile(const SaveRequest& a_request);  // Writer thread: dirty sections -> temp file -> rename over the INI
+	
+	void StartWatcher();
+	void OnIniChanged();  // Watcher thread
+	
+	// INI size and mtime, taken before the file is read so a cache is never keyed on a newer file than it holds
+	struct IniStamp
+	{
+		std::uintmax_t size{ 0 };
+		std::int64_t time{ 0 };  // last_write_time ticks
+	};
+	
+	static bool GetIniStamp(const std::filesystem::path& a_path, IniStamp& a_stamp);  // False if the file can't be stat'ed
+	
+	// Binary snapshot of SettingsData next to the INI, valid while the INI's stamp matches
+	static bool LoadCache(const IniStamp& a_stamp, IniContents& a_ini);
+	void SaveCache(const IniStamp& a_stamp, const IniContents& a_ini);  // Temp file -> rename over the cache, under cacheLock
+	static std::uint64_t DefaultsHash();  // Hash of InitializeDefaults' SettingsData, keys the cache
 };
 
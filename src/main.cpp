@@ -96,4 +96,15 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* a_s
 	return true;
 }
 
+// Profile switching for other plugins (look these up with GetProcAddress on FPCameraSettle.dll).
+// Safe to call from any thread once data is loaded; the switch is queued and takes effect on the
+// next frame, on the game thread.
+extern "C" DLLEXPORT bool SKSEAPI FPCameraSettle_SelectProfile(const char* a_name)
+{
+	return a_name && Settings::GetSingleton()->QueueSelectProfile(std::string_view(a_name));
+}
 
+extern "C" DLLEXPORT void SKSEAPI FPCameraSettle_SelectNextProfile()
+{
+	Settings::GetSingleton()->QueueSelectNextProfile();
+}
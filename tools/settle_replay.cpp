@@ -0,0 +1,529 @@
+// settle_replay - replays a recording written by the in-game replay recorder
+// (bReplayRecording, "Save Replay" in the Debug menu) through the portable
+// settle core and checks that it reproduces the recorded camera offsets.
+//
+// Replay starts at the first keyframe, then feeds every frame's layer edits,
+// layer settings and core inputs to SpringRig::Step / UpdateIdleNoise exactly
+// as Update() did. Each frame's combined offset is compared bit for bit with
+// the recorded one. The spring kernels are pure float arithmetic and replay
+// exactly on any x86-64 build. The closed-form coefficients and the idle noise
+// go through exp/sin/cos, and those can differ in the last bit between
+// C runtimes, so for those the maximum deviation is the number to look at.
+// The recorded engine inputs are turned back into PlayerStateSnapshots and run
+// through the same movement detection and action state machine as the plugin,
+// starting from the keyframe's state with the recorded detector settings; the
+// summary counts each transition, and --inputs prints the action and the
+// transitions detected on every frame. Each frame's commands are checked
+// against the recorded layer edits: an edit on a layer no command or event
+// touched, or an enabled command whose layer was not edited, is a mismatch.
+//
+// --synthetic writes a scripted session (jittered frame rates, scripted
+// movement, sprint and jump input with the detector's impulses, impulses on
+// every layer, idle noise, closed-form and fixed-timestep segments, a reset,
+// a detector settings change)
+// through the same Recorder, so the tool can be checked without the game.
+//
+// Usage: settle_replay <recording.fpcr> [--inputs]
+//        settle_replay --synthetic <out.fpcr> [frames]
+
+#include "Core/ActionStateMachine.h"
+#include "Core/PlayerState.h"
+#include "Core/Replay.h"
+#include "Core/SettingsIni.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	using namespace SettleCore;
+	using namespace SettleCore::Replay;
+
+	constexpr int kLayerCount = kSpringLayerCount;
+
+	const char* EventName(EventType a_type)
+	{
+		switch (a_type) {
+		case EventType::kHitTaken:
+			return "hit taken";
+		case EventType::kHitting:
+			return "hitting";
+		case EventType::kPrecisionHit:
+			return "precision hit";
+		case EventType::kAnimation:
+			return "animation";
+		case EventType::kTriggerAction:
+			return "trigger action";
+		case EventType::kSprintStopAnimated:
+			return "sprint stop (anim event)";
+		default:
+			return "unknown";
+		}
+	}
+
+	bool SameBits(const Vec3& a_lhs, const Vec3& a_rhs)
+	{
+		return std::memcmp(&a_lhs, &a_rhs, sizeof(Vec3)) == 0;
+	}
+
+	float MaxDeviation(const Vec3& a_lhs, const Vec3& a_rhs)
+	{
+		return std::max({ std::abs(a_lhs.x - a_rhs.x), std::abs(a_lhs.y - a_rhs.y), std::abs(a_lhs.z - a_rhs.z) });
+	}
+
+	// Whether the replayed state already matches a keyframe (it should, unless the
+	// plugin reset the springs between frames)
+	bool MatchesKeyframe(const Keyframe& a_keyframe, const SpringRig& a_rig, const IdleNoiseState& a_noise)
+	{
+		return std::memcmp(a_keyframe.springs, a_rig.springs, sizeof(a_keyframe.springs)) == 0 &&
+		       std::memcmp(a_keyframe.blends, a_rig.blends, sizeof(a_keyframe.blends)) == 0 &&
+		       std::memcmp(a_keyframe.total, a_rig.bank.total, sizeof(a_keyframe.total)) == 0 &&
+		       std::memcmp(&a_keyframe.noise, &a_noise, sizeof(IdleNoiseState)) == 0;
+	}
+
+	// Layer an event's impulse lands on, as the plugin's event sinks apply it (0 = none)
+	std::uint32_t EventLayers(const Event& a_event)
+	{
+		switch (a_event.type) {
+		case EventType::kHitTaken:
+		case EventType::kPrecisionHit:
+		case EventType::kHitting:
+			return 1u << kHitLayer;
+		case EventType::kAnimation:
+			return a_event.detail == static_cast<std::uint8_t>(AnimTag::kArrowRelease) || a_event.detail == static_cast<std::uint8_t>(AnimTag::kBoltRelease) ?
+			           1u << kArcheryLayer :
+			           0u;
+		case EventType::kSprintStopAnimated:
+			return 1u << kMovementLayer;
+		case EventType::kTriggerAction:
+			return a_event.detail < static_cast<std::uint8_t>(ActionType::kTotal) ? 1u << GetActionTraits(static_cast<ActionType>(a_event.detail)).layer : 0u;
+		default:
+			return 0u;
+		}
+	}
+
+	int RunReplay(const char* a_path, bool a_printInputs)
+	{
+		Reader reader;
+		if (!reader.Open(a_path)) {
+			std::fprintf(stderr, "settle_replay: %s: %s\n", a_path, reader.GetError());
+			return 2;
+		}
+
+		SpringRig rig;
+		IdleNoiseState noise;
+		ActionSettings layerSettings[kLayerCount];
+		bool started = false;
+		bool kernelWarned = false;
+		float time = 0.0f;
+
+		int frames = 0;
+		int exactFrames = 0;
+		int keyframes = 0;
+		int resyncedKeyframes = 0;
+		int edits = 0;
+		int events[static_cast<int>(EventType::kTotal)]{};
+		float maxDeviation = 0.0f;
+		int firstMismatch = -1;
+		float firstMismatchTime = 0.0f;
+		int movingFrames = 0;
+		int movementChanges = 0;
+		ActionType lastMovement = ActionType::kTotal;
+		ActionStateMachine detector;
+		SettingsData detectorSettings;
+		DetectorSettings detectorRecord;
+		int transitions[static_cast<int>(Transition::kTotal)]{};
+
+		// Layers (bit per SpringLayer) this frame's commands and events touched, and the ones it edited;
+		// an event landing after RecordStep shows up in the next frame's edits
+		std::uint32_t commandLayers = 0;
+		std::uint32_t requiredLayers = 0;
+		std::uint32_t eventLayers = 0;
+		std::uint32_t lastEventLayers = 0;
+		std::uint32_t editLayers = 0;
+		int commands = 0;
+		int unexplainedEdits = 0;
+		int missingEdits = 0;
+		int firstDetectorMismatch = -1;
+
+		RecordType type;
+		const std::uint8_t* payload = nullptr;
+		while (reader.Next(type, payload)) {
+			if (type == RecordType::kKeyframe) {
+				auto keyframe = Reader::Read<Keyframe>(payload);
+				if (started && !MatchesKeyframe(keyframe, rig, noise)) {
+					++resyncedKeyframes;
+				}
+				ApplyKeyframe(keyframe, rig, noise);
+				for (int layer = 0; layer < kLayerCount; ++layer) {
+					ApplyLayerParams(layerSettings[layer], keyframe.params[layer]);
+				}
+				detector = keyframe.detector;
+				detectorRecord = keyframe.detectorSettings;
+				ApplyDetectorSettings(detectorSettings, detectorRecord);
+				commandLayers = requiredLayers = eventLayers = lastEventLayers = editLayers = 0;
+				started = true;
+				++keyframes;
+				continue;
+			}
+
+			// Anything before the first keyframe has no state to apply to
+			if (!started) {
+				continue;
+			}
+
+			switch (type) {
+			case RecordType::kInput:
+				{
+					auto input = Reader::Read<InputFrame>(payload);
+					time = input.time;
+
+					const auto state = FromInputFrame(input);
+					const auto movement = DetectMovementAction(state);
+					movingFrames += movement != ActionType::kTotal;
+					movementChanges += movement != lastMovement;
+					lastMovement = movement;
+
+					// DetectActions leaves the detector alone in a disabled weapon state
+					ActionFrame detected;
+					if (state.weaponDrawn ? detectorRecord.weaponDrawnEnabled : detectorRecord.weaponSheathedEnabled) {
+						detected = detector.Step(state, detectorSettings);
+					}
+					for (int transition = 0; transition < static_cast<int>(Transition::kTotal); ++transition) {
+						transitions[transition] += detected.Fired(static_cast<Transition>(transition));
+					}
+					for (int index = 0; index < detected.commandCount; ++index) {
+						const auto& command = detected.commands[index];
+						if (command.source == ImpulseSource::kNone) {
+							continue;
+						}
+						commandLayers |= 1u << command.layer;
+						if (CommandEdits(command, state.weaponDrawn, detectorRecord)) {
+							requiredLayers |= 1u << command.layer;
+						}
+						++commands;
+					}
+
+					if (a_printInputs) {
+						std::printf("%9.3f  dt=%.5f flags=%04x move=(%+.2f,%+.2f) z=%.1f archery=%.0f  %s", input.time, input.delta,
+							input.flags, input.moveInputX, input.moveInputY, input.positionZ, input.archerySkill,
+							movement != ActionType::kTotal ? SettingsIni::ActionName(movement) : "-");
+						for (int transition = 0; transition < static_cast<int>(Transition::kTotal); ++transition) {
+							if (detected.Fired(static_cast<Transition>(transition))) {
+								std::printf("  [%s]", TransitionName(static_cast<Transition>(transition)));
+							}
+						}
+						std::printf("\n");
+					}
+					break;
+				}
+			case RecordType::kEvent:
+				{
+					auto event = Reader::Read<Event>(payload);
+					if (static_cast<int>(event.type) < static_cast<int>(std::size(events))) {
+						++events[static_cast<int>(event.type)];
+					}
+					eventLayers |= EventLayers(event);
+					if (event.type == EventType::kSprintStopAnimated) {
+						detector.SetSprintStopAnimated();
+					}
+					if (a_printInputs) {
+						std::printf("%9.3f  event: %s detail=%u scale=%.2f\n", event.time, EventName(event.type), event.detail, event.scale);
+					}
+					break;
+				}
+			case RecordType::kLayerParams:
+				{
+					auto record = Reader::Read<LayerParamsRecord>(payload);
+					if (record.layer < kLayerCount) {
+						ApplyLayerParams(layerSettings[record.layer], record.params);
+					}
+					break;
+				}
+			case RecordType::kLayerEdit:
+				{
+					auto record = Reader::Read<LayerEditRecord>(payload);
+					if (record.layer < kLayerCount) {
+						rig.springs[record.layer] = record.spring;
+						rig.blends[record.layer] = record.blend;
+						editLayers |= 1u << record.layer;
+						++edits;
+					}
+					break;
+				}
+			case RecordType::kDetectorSettings:
+				detectorRecord = Reader::Read<DetectorSettings>(payload);
+				ApplyDetectorSettings(detectorSettings, detectorRecord);
+				break;
+			case RecordType::kCore:
+				{
+					auto core = Reader::Read<CoreFrame>(payload);
+
+					auto kernel = static_cast<SpringKernel>(core.kernel);
+					if (!IsSpringKernelSupported(kernel) && !kernelWarned) {
+						std::printf("warning: recorded with the %s kernel, not supported here; using %s\n",
+							GetSpringKernelName(kernel), GetSpringKernelName(GetBestSpringKernel()));
+						kernelWarned = true;
+					}
+					SetSpringKernel(kernel);
+
+					RigFrame frame;
+					frame.delta = core.delta;
+					frame.dampingMult = core.dampingMult;
+					frame.settingsVersion = core.settingsVersion;
+					frame.integrator = static_cast<SpringIntegrator>(core.integrator);
+					frame.substeps = core.substeps;
+					frame.fixedStepRate = core.fixedStepRate;
+					frame.maxFixedSteps = core.maxFixedSteps;
+					frame.weaponDrawn = core.weaponDrawn;
+					frame.autoSubsteps = core.autoSubsteps;
+					for (int layer = 0; layer < kLayerCount; ++layer) {
+						frame.layerActions[layer] = static_cast<ActionType>(core.layerActions[layer]);
+						frame.layerSettings[layer] = &layerSettings[layer];
+					}
+
+					rig.Step(frame);
+					UpdateIdleNoise(noise, core.noise);
+
+					Vec3 position;
+					Vec3 rotation;
+					CombineOffsets(rig, noise, position, rotation);
+
+					if (SameBits(position, core.position) && SameBits(rotation, core.rotation)) {
+						++exactFrames;
+					} else {
+						float deviation = std::max(MaxDeviation(position, core.position), MaxDeviation(rotation, core.rotation));
+						maxDeviation = std::max(maxDeviation, deviation);
+						if (firstMismatch < 0) {
+							firstMismatch = frames;
+							firstMismatchTime = time;
+						}
+					}
+
+					const std::uint32_t unexplained = editLayers & ~(commandLayers | eventLayers | lastEventLayers);
+					const std::uint32_t missing = requiredLayers & ~editLayers;
+					unexplainedEdits += std::popcount(unexplained);
+					missingEdits += std::popcount(missing);
+					if ((unexplained | missing) != 0) {
+						if (firstDetectorMismatch < 0) {
+							firstDetectorMismatch = frames;
+						}
+						if (a_printInputs) {
+							std::printf("%9.3f  detector mismatch: unexplained edits %02x, missing edits %02x\n", time, unexplained, missing);
+						}
+					}
+					lastEventLayers = eventLayers;
+					commandLayers = requiredLayers = eventLayers = editLayers = 0;
+
+					++frames;
+					break;
+				}
+			default:
+				break;
+			}
+		}
+
+		if (*reader.GetError()) {
+			std::fprintf(stderr, "settle_replay: %s: %s (stopped after %d frames)\n", a_path, reader.GetError(), frames);
+		}
+		if (!started) {
+			std::fprintf(stderr, "settle_replay: %s: no keyframe found\n", a_path);
+			return 2;
+		}
+
+		std::printf("%s: %d frames (%.1fs), %d keyframes (%d resynced), %d layer edits\n", a_path, frames, time, keyframes,
+			resyncedKeyframes, edits);
+		std::printf("  events:");
+		for (int event = 0; event < static_cast<int>(std::size(events)); ++event) {
+			std::printf(" %s=%d", EventName(static_cast<EventType>(event)), events[event]);
+		}
+		std::printf("\n");
+		std::printf("  detected movement: %d moving frames, %d action changes\n", movingFrames, movementChanges);
+		std::printf("  transitions:");
+		for (int transition = 0; transition < static_cast<int>(Transition::kTotal); ++transition) {
+			if (transitions[transition] > 0) {
+				std::printf(" %s=%d", TransitionName(static_cast<Transition>(transition)), transitions[transition]);
+			}
+		}
+		std::printf("\n");
+		std::printf("  detector commands: %d, unexplained layer edits %d, missing layer edits %d\n", commands, unexplainedEdits, missingEdits);
+		if (firstDetectorMismatch >= 0) {
+			std::printf("  first detector mismatch: frame %d\n", firstDetectorMismatch);
+		}
+		std::printf("  bit-exact frames: %d/%d, max deviation %.3g\n", exactFrames, frames, static_cast<double>(maxDeviation));
+		if (firstMismatch >= 0) {
+			std::printf("  first mismatch: frame %d (t=%.3fs)\n", firstMismatch, firstMismatchTime);
+		}
+		return exactFrames == frames && unexplainedEdits == 0 && missingEdits == 0 ? 0 : 1;
+	}
+
+	ActionSettings MakeSettings(float a_stiffness, float a_damping, float a_blendTime, float a_y, float a_z, float a_rx)
+	{
+		ActionSettings s;
+		s.Stiffness() = a_stiffness;
+		s.Damping() = a_damping;
+		s.BlendTime() = a_blendTime;
+		s.ImpulseY() = a_y;
+		s.ImpulseZ() = a_z;
+		s.RotImpulseX() = a_rx;
+		return s;
+	}
+
+	int WriteSynthetic(const char* a_path, int a_frames)
+	{
+		ActionSettings settings[kLayerCount] = {
+			MakeSettings(100.0f, 7.0f, 0.08f, 3.0f, 1.0f, 1.0f),
+			MakeSettings(40.0f, 3.0f, 0.1f, 4.0f, 8.0f, -2.0f),
+			MakeSettings(50.0f, 8.0f, 0.1f, 1.0f, -5.0f, 2.0f),
+			MakeSettings(150.0f, 12.0f, 0.1f, -5.0f, -3.0f, 5.0f),
+			MakeSettings(150.0f, 10.0f, 0.0f, -3.0f, 2.0f, -3.0f)
+		};
+		constexpr ActionType LAYER_ACTIONS[kLayerCount] = {
+			ActionType::WalkForward,
+			ActionType::Jump,
+			ActionType::Sneak,
+			ActionType::TakingHit,
+			ActionType::ArrowRelease
+		};
+
+		// Stability bounds at the largest damping multiplier used below, as Settings does;
+		// the archery layer keeps 0 so Step computes it per frame
+		constexpr float MAX_DAMPING_MULT = 1.5f;
+		for (int layer = 0; layer < kArcheryLayer; ++layer) {
+			settings[layer].maxStableStep = GetMaxStableStep(settings[layer].Stiffness(), settings[layer].Damping() * MAX_DAMPING_MULT);
+		}
+
+		Recorder recorder;
+		recorder.SetEnabled(true);
+		SpringRig rig;
+		IdleNoiseState noise;
+		ActionStateMachine detector;
+		SettingsData detectorSettings;
+
+		// Small LCG so the frame-time jitter is the same on every run
+		std::uint32_t seed = 0x2545F491u;
+		auto jitter = [&seed]() {
+			seed = seed * 1664525u + 1013904223u;
+			return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24);
+		};
+
+		constexpr float RATES[] = { 60.0f, 144.0f, 30.0f, 240.0f };
+		const int segment = std::max(a_frames / 3, 1);
+
+		for (int frame = 0; frame < a_frames; ++frame) {
+			float hz = RATES[(frame / 400) % std::size(RATES)];
+			float delta = (1.0f / hz) * (0.9f + 0.2f * jitter());
+
+			// Reset mid-session, as CameraSettleManager::Reset does on a view switch
+			if (frame == a_frames / 2) {
+				rig.Reset();
+				detector.Reset();
+				recorder.RequestKeyframe();
+			}
+
+			// A detector settings change late on (shows up as a DetectorSettings record): drawn jumps off, longer falls to land
+			if (frame == a_frames * 2 / 3) {
+				detectorSettings.GetActionSettingsForState(ActionType::Jump, true).enabled = false;
+				detectorSettings.jumpMinAirTime = 0.3f;
+			}
+
+			// Walk a square (forward, right, back, left, stand), running on alternate laps and sneaking every third;
+			// running laps sprint the forward leg, and every 500 frames there's a jump (or, every other time, a fall)
+			constexpr float MOVES[5][2] = { { 0.0f, 1.0f }, { 1.0f, 0.0f }, { 0.0f, -1.0f }, { -1.0f, 0.0f }, { 0.0f, 0.0f } };
+			PlayerStateSnapshot state;
+			state.delta = delta;
+			state.weaponDrawn = true;
+			state.moveInputX = MOVES[(frame / 150) % 5][0];
+			state.moveInputY = MOVES[(frame / 150) % 5][1];
+			state.walking = (frame / 750) % 2 == 0;
+			state.sneaking = (frame / 750) % 3 == 2;
+			state.sprinting = !state.walking && !state.sneaking && (frame / 150) % 5 == 0 && frame % 150 >= 30;
+			state.inMidair = frame % 500 >= 200 && frame % 500 < 200 + 60;
+			state.jumping = frame % 500 == 200 && (frame / 500) % 2 == 0;  // Read on the takeoff frame only, as the plugin does
+			state.positionZ = state.inMidair ? 20.0f : 0.0f;
+			const auto detectorRecord = GetDetectorSettings(detectorSettings);
+			recorder.BeginFrame(ToInputFrame(state), rig, noise, detector, detectorRecord);
+
+			// The detector's commands, on the layer settings below (the plugin uses each action's own)
+			const auto detected = detector.Step(state, detectorSettings);
+			for (int index = 0; index < detected.commandCount; ++index) {
+				const auto& command = detected.commands[index];
+				if (CommandEdits(command, state.weaponDrawn, detectorRecord)) {
+					ApplyImpulse(rig.springs[command.layer], rig.blends[command.layer], settings[command.layer], command.scale);
+				}
+			}
+
+			if (frame % 37 == 0) {
+				int layer = (frame / 37) % kLayerCount;
+				ApplyImpulse(rig.springs[layer], rig.blends[layer], settings[layer], 0.5f + jitter());
+				recorder.RecordEvent({ 0.0f, EventType::kTriggerAction, static_cast<std::uint8_t>(LAYER_ACTIONS[layer]), 1.0f });
+			}
+
+			// A settings edit part way through (shows up as a LayerParams record)
+			if (frame == segment / 2) {
+				settings[kHitLayer].Stiffness() = 180.0f;
+				settings[kHitLayer].maxStableStep = GetMaxStableStep(180.0f, settings[kHitLayer].Damping() * MAX_DAMPING_MULT);
+			}
+
+			// Euler, then closed form, then Euler on the 240 Hz fixed-step clock
+			RigFrame rigFrame;
+			rigFrame.delta = delta;
+			rigFrame.dampingMult = 1.0f + 0.5f * static_cast<float>(frame % 90) / 90.0f;
+			rigFrame.settingsVersion = frame < segment / 2 ? 1 : 2;
+			rigFrame.integrator = frame / segment == 1 ? SpringIntegrator::ClosedForm : SpringIntegrator::Euler;
+			rigFrame.fixedStepRate = frame / segment >= 2 ? 240 : 0;
+			rigFrame.autoSubsteps = (frame / 200) % 2 == 1;
+			rigFrame.weaponDrawn = true;
+			for (int layer = 0; layer < kLayerCount; ++layer) {
+				rigFrame.layerActions[layer] = LAYER_ACTIONS[layer];
+				rigFrame.layerSettings[layer] = &settings[layer];
+			}
+			recorder.RecordStep(rigFrame, rig);
+			rig.Step(rigFrame);
+
+			// Idle noise fades in and out every few seconds
+			IdleNoiseFrame noiseFrame;
+			noiseFrame.delta = delta;
+			noiseFrame.frequency = 0.5f;
+			noiseFrame.enabled = (frame / 600) % 3 != 2;
+			noiseFrame.targetAmplitude = (frame / 300) % 2 == 0 ? 1.0f : 0.0f;
+			noiseFrame.rampSpeed = 3.0f;
+			noiseFrame.posAmp = { 0.1f, 0.05f, 0.1f };
+			noiseFrame.rotAmpDeg = { 0.3f, 0.2f, 0.1f };
+			UpdateIdleNoise(noise, noiseFrame);
+
+			recorder.EndFrame(rigFrame, noiseFrame, rig, noise);
+		}
+
+		if (!recorder.Dump(a_path)) {
+			std::fprintf(stderr, "settle_replay: cannot write %s\n", a_path);
+			return 2;
+		}
+		std::printf("settle_replay: wrote %d synthetic frames to %s (last %d kept)\n", a_frames, a_path,
+			std::min(a_frames, Recorder::kChunkCount * Recorder::kFramesPerChunk));
+		return 0;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc >= 3 && std::strcmp(argv[1], "--synthetic") == 0) {
+		int frames = argc > 3 ? std::atoi(argv[3]) : 6000;
+		return WriteSynthetic(argv[2], std::max(frames, 1));
+	}
+
+	if (argc < 2 || argv[1][0] == '-') {
+		std::fprintf(stderr,
+			"Usage: settle_replay <recording.fpcr> [--inputs]\n"
+			"       settle_replay --synthetic <out.fpcr> [frames]\n");
+		return 2;
+	}
+
+	bool printInputs = argc > 2 && std::strcmp(argv[2], "--inputs") == 0;
+	return RunReplay(argv[1], printInputs);
+}